@@ -19,6 +19,7 @@
 // base/sfun includes
 #include <base/sfun/BSpline.hpp>
 #include <base/sfun/TensorProduct.hpp>
+#include <base/sfun/Tabulation.hpp>
 
 //------------------------------------------------------------------------------
 namespace base{
@@ -51,13 +52,37 @@ public:
     typedef base::sfun::TensorProduct<base::sfun::BSpline<degree,continuity>,
                                       dim,base::sfun::LEXICOGRAPHIC>  Base;
 
+    //! Table of values at the registered quadrature points
+    typedef base::sfun::Tabulation<Base> Table;
+
+    //! Constructor makes sure that the table is registered
+    BSplineShapeFun() { Table::instance(); }
+
+    //--------------------------------------------------------------------------
+    //! @name Parametric evaluation, tabulated if possible
+    //@{
+    void fun( const typename Base::VecDim& xi,
+              typename Base::FunArray& values ) const
+    {
+        if ( not Table::instance().fun( xi, values ) )
+            Base::fun( xi, values );
+    }
+
+    void gradient( const typename Base::VecDim& xi,
+                   typename Base::GradArray& values ) const
+    {
+        if ( not Table::instance().gradient( xi, values ) )
+            Base::gradient( xi, values );
+    }
+    //@}
+
     //! Evaluate function in physical space
     template<typename GEOMELEMENT>
     void evaluate( const GEOMELEMENT* geomElemPtr,
                    const typename Base::VecDim& xi,
                    typename Base::FunArray &result ) const
     {
-        Base::fun( xi, result );
+        this -> fun( xi, result );
     }
 
     //! Evaluate gradient in physical space
@@ -67,7 +92,7 @@ public:
                              std::vector<typename GEOMELEM::Node::VecDim>& result ) const
     {
         typename Base::GradArray gradXiPhi;
-        Base::gradient( xi, gradXiPhi );
+        this -> gradient( xi, gradXiPhi );
 
         // Get contra-variant basis and jacobian
         typename base::ContraVariantBasis<GEOMELEM>::MatDimLDim contraBasis;
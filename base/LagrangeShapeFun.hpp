@@ -23,6 +23,7 @@
 #include <base/sfun/LagrangeTriangle.hpp>
 #include <base/sfun/LagrangeTetrahedron.hpp>
 #include <base/sfun/TensorProduct.hpp>
+#include <base/sfun/Tabulation.hpp>
 
 //------------------------------------------------------------------------------
 namespace base{
@@ -145,6 +146,30 @@ public:
     //! Base class contains the parametric shape function implementation
     typedef typename detail_::LagrangeShapeFunImpl<DEGREE,SHAPE>::Type Base;
 
+    //! Table of values at the registered quadrature points
+    typedef base::sfun::Tabulation<Base> Table;
+
+    //! Constructor makes sure that the table is registered
+    LagrangeShapeFun() { Table::instance(); }
+
+    //--------------------------------------------------------------------------
+    //! @name Parametric evaluation, tabulated if possible
+    //@{
+    void fun( const typename Base::VecDim& xi,
+              typename Base::FunArray& values ) const
+    {
+        if ( not Table::instance().fun( xi, values ) )
+            Base::fun( xi, values );
+    }
+
+    void gradient( const typename Base::VecDim& xi,
+                   typename Base::GradArray& values ) const
+    {
+        if ( not Table::instance().gradient( xi, values ) )
+            Base::gradient( xi, values );
+    }
+    //@}
+
     //--------------------------------------------------------------------------
     /** Evaluate function in physical space.
      *  The function values in the physical coordinate system are defined by
@@ -162,7 +187,7 @@ public:
                    const typename Base::VecDim& xi,
                    typename Base::FunArray &result ) const
     {
-        Base::fun( xi, result );
+        this -> fun( xi, result );
     }
 
     //--------------------------------------------------------------------------
@@ -185,7 +210,7 @@ public:
     {
         // get local gradient
         typename Base::GradArray gradXiPhi;
-        Base::gradient( xi, gradXiPhi );
+        this -> gradient( xi, gradXiPhi );
 
         // Get contra-variant basis and jacobian
         typename base::ContraVariantBasis<GEOMELEM>::MatDimLDim contraBasis;
@@ -239,7 +264,7 @@ public:
     {
         // parameter space gradient
         typename Base::GradArray gradXi;
-        Base::gradient(xi, gradXi );
+        this -> gradient( xi, gradXi );
 
         // parameter space Hessian
         typename Base::HessianArray hessXi;
@@ -18,6 +18,8 @@
 #include <base/quad/GaussTetrahedron.hpp>
 #include <base/quad/TensorProduct.hpp>
 #include <base/shape.hpp>
+// base/sfun includes
+#include <base/sfun/Tabulation.hpp>
 
 //------------------------------------------------------------------------------
 namespace base{
@@ -117,6 +119,12 @@ namespace base{
         typedef typename base::detail_::QuadratureBase<DEGREE,SHAPE>::Type Base;
         
     public:
+        //! Constructor registers the points for shape function tabulation
+        Quadrature()
+        {
+            base::sfun::detail_::registerQuadraturePoints( *this );
+        }
+
         //----------------------------------------------------------------------
         /** Generic apply function.
          *  Evaluate provided kernel function object at every pair of weight and
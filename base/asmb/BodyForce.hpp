@@ -19,6 +19,7 @@
 // base/asmb includes
 #include <base/asmb/ForceIntegrator.hpp>
 #include <base/auxi/FunEvaluationPolicy.hpp>
+#include <base/auxi/Profiler.hpp>
 
 //------------------------------------------------------------------------------
 namespace base{
@@ -70,6 +71,7 @@ namespace base{
             const FIELDBINDER& fieldBinder,
             const FUN& forceFun )
         {
+            PROFILE_REGION( "asmb::bodyForce" );
             typedef base::auxi::EvaluateDirectly<
                 typename FIELDTUPLEBINDER::Tuple::GeomElement,FUN> Evaluate;
             
@@ -96,6 +98,7 @@ namespace base{
             const FIELDBINDER& fieldBinder,
             const FUN& forceFun )
         {
+            PROFILE_REGION( "asmb::bodyForce" );
             typedef base::auxi::EvaluateViaElement<
                 typename FIELDTUPLEBINDER::Tuple::GeomElement,FUN> Evaluate;
             
@@ -21,6 +21,7 @@
 #include <boost/function.hpp>
 // base includes
 #include <base/linearAlgebra.hpp>
+#include <base/auxi/Profiler.hpp>
 // base/asmb includes
 #include <base/asmb/collectFromDoFs.hpp>
 #include <base/asmb/assembleForces.hpp>
@@ -42,6 +43,7 @@ namespace base{
                                     const FIELDBINDER& fieldBinder,
                                     const KERNEL& kernelObj )
         {
+            PROFILE_REGION( "asmb::residualForces" );
             typedef ForceIntegrator<QUADRATURE,SOLVER,
                                     typename FIELDTUPLEBINDER::Tuple>
                 ForceIntegrator;
@@ -110,6 +112,12 @@ public:
                                    const double,
                                    base::VectorD& )>  ForceKernel;
 
+    //! @name Generic names of kernel and result types
+    //@{
+    typedef ForceKernel   Kernel;
+    typedef base::VectorD Result;
+    //@}
+
     //--------------------------------------------------------------------------
     //! Constructor setting all references
     ForceIntegrator( ForceKernel&         forceKernel,
@@ -132,9 +140,7 @@ public:
         std::vector<base::dof::DoFStatus> doFStatus;
         std::vector<std::size_t> doFIDs;
         std::vector<base::number> prescribedValues; // placeholder
-        std::vector<
-            std::pair<unsigned,std::vector<std::pair<base::number,std::size_t> > >
-            > constraints;
+        base::asmb::ElementConstraints constraints;
 
         //  get all dof data
         const bool doSomething = 
@@ -0,0 +1,295 @@
+//------------------------------------------------------------------------------
+// <preamble>
+// </preamble>
+//------------------------------------------------------------------------------
+
+//! @file   FusedAssembly.hpp
+//! @author agent
+//! @date   2026
+
+#ifndef base_asmb_fusedassembly_hpp
+#define base_asmb_fusedassembly_hpp
+
+//------------------------------------------------------------------------------
+// std includes
+#include <vector>
+#include <utility>
+// boost includes
+#include <boost/bind.hpp>
+#include <boost/function.hpp>
+// base includes
+#include <base/linearAlgebra.hpp>
+#include <base/auxi/EqualPointers.hpp>
+#include <base/auxi/parallel.hpp>
+#include <base/auxi/Profiler.hpp>
+// base/asmb includes
+#include <base/asmb/collectFromDoFs.hpp>
+#include <base/asmb/assembleMatrix.hpp>
+#include <base/asmb/assembleForces.hpp>
+
+//------------------------------------------------------------------------------
+namespace base{
+    namespace asmb{
+
+        template<typename QUAD, typename SOLVER, typename FIELDTUPLE>
+        class FusedAssembly;
+
+        //----------------------------------------------------------------------
+        /** Convenience function for a fused assembly pass.
+         *  Applies the terms collected in the given object to all elements in
+         *  one traversal.
+         *  \tparam FIELDTUPLEBINDER Binding of the right field tuple
+         *  \tparam FUSED            Type of fused assembly object
+         *  \tparam FIELDBINDER      Type of field compound
+         */
+        template<typename FIELDTUPLEBINDER, typename FUSED, typename FIELDBINDER>
+        void fusedAssembly( FUSED& fused, const FIELDBINDER& fieldBinder )
+        {
+            PROFILE_REGION( "asmb::fusedAssembly" );
+            base::auxi::applyToAllFieldTuple<FIELDTUPLEBINDER>( fieldBinder, fused );
+        }
+
+    }
+}
+
+//------------------------------------------------------------------------------
+/** Assembly of several matrix and vector terms in one pass.
+ *  A typical system in a Newton iteration or a time step is composed of
+ *  \f[
+ *       \left[ \sum_k \alpha_k K_k \right] \Delta x =
+ *       \sum_l \beta_l F_l
+ *  \f]
+ *  with element-wise integrated matrices \f$ K_k \f$ (e.g., stiffness and
+ *  mass) and vectors \f$ F_l \f$ (e.g., residual forces). Calling
+ *  base::asmb::stiffnessMatrixComputation and
+ *  base::asmb::computeResidualForces for every term means that for every
+ *  term the mesh is traversed, the DoF data are collected, the element
+ *  containers are allocated and the result is scattered to the system.
+ *  This object collects the terms for one field tuple, i.e. one pair of
+ *  test and trial fields, and does all of this once per element: the
+ *  quadrature loop calls all kernels with their factors at every point and
+ *  accumulates into one element matrix and one element vector, which are
+ *  assembled once. Data shared between the kernels at a quadrature point
+ *  (shape functions, geometry) is re-used if the tabulation of shape
+ *  functions and the geometry cache are active.
+ *
+ *  Matrix terms follow the convention of base::asmb::StiffnessMatrix,
+ *  including the incremental treatment of prescribed values, vector terms
+ *  the one of base::asmb::ForceIntegrator, i.e. a residual is added with
+ *  the factor \f$ -1 \f$ to the right hand side (see addResidual).
+ *  Different test and trial fields need separate objects.
+ *
+ *  \tparam QUAD         Quadrature
+ *  \tparam SOLVER       Solver
+ *  \tparam FIELDTUPLE   Tuple of field element pointers
+ */
+template<typename QUAD, typename SOLVER, typename FIELDTUPLE>
+class base::asmb::FusedAssembly
+    : public boost::function<void( const FIELDTUPLE& )>
+{
+public:
+    //! @name Template parameter
+    //@{
+    typedef QUAD          Quadrature;
+    typedef SOLVER        Solver;
+    typedef FIELDTUPLE    FieldTuple;
+    //@}
+
+    //! @name Access types of the tuple
+    //@{
+    typedef typename FieldTuple::TestElement   TestElement;
+    typedef typename FieldTuple::TrialElement  TrialElement;
+    //@}
+
+    //! @name Kernel functions of the individual terms
+    //@{
+    typedef boost::function<void( const FieldTuple&,
+                                  const typename Quadrature::VecDim&,
+                                  const double,
+                                  base::MatrixD& ) >  MatrixKernel;
+
+    typedef boost::function<void( const FieldTuple&,
+                                  const typename Quadrature::VecDim&,
+                                  const double,
+                                  base::VectorD& ) >  VectorKernel;
+    //@}
+
+    //! Element matrix and vector
+    struct ElementData
+    {
+        base::MatrixD matrix;
+        base::VectorD vector;
+    };
+
+    //! Constructor with quadrature and solver
+    FusedAssembly( const Quadrature&    quadrature,
+                   Solver&              solver,
+                   const bool           incremental = false )
+        : quadrature_(      quadrature ),
+          solver_(          solver ),
+          incremental_(     incremental )
+    { }
+
+    //--------------------------------------------------------------------------
+    //! @name Addition of terms
+    //@{
+    void addMatrixTerm( const MatrixKernel& kernel, const double factor = 1. )
+    {
+        matrixTerms_.push_back( std::make_pair( kernel, factor ) );
+    }
+
+    void addVectorTerm( const VectorKernel& kernel, const double factor = 1. )
+    {
+        vectorTerms_.push_back( std::make_pair( kernel, factor ) );
+    }
+
+    //! Add the tangent stiffness of a kernel object
+    template<typename KERNEL>
+    void addStiffness( const KERNEL& kernelObj, const double factor = 1. )
+    {
+        this -> addMatrixTerm( boost::bind( &KERNEL::tangentStiffness,
+                                            &kernelObj, _1, _2, _3, _4 ),
+                               factor );
+    }
+
+    //! Add the residual forces of a kernel object (moved to the RHS)
+    template<typename KERNEL>
+    void addResidual( const KERNEL& kernelObj, const double factor = -1. )
+    {
+        this -> addVectorTerm( boost::bind( &KERNEL::residualForce,
+                                            &kernelObj, _1, _2, _3, _4 ),
+                               factor );
+    }
+    //@}
+
+    //--------------------------------------------------------------------------
+    //! Integrate all terms and assemble them
+    void operator()( const FieldTuple& fieldTuple )
+    {
+        const bool hasMatrix = not matrixTerms_.empty();
+        const bool hasVector = not vectorTerms_.empty();
+
+        // extract test and trial elements from tuple
+        TestElement*  testEp  = fieldTuple.testElementPtr();
+        TrialElement* trialEp = fieldTuple.trialElementPtr();
+
+        // if pointers are identical, Galerkin-Bubnov scheme
+        const bool isBubnov =
+            base::auxi::EqualPointers<TestElement,TrialElement>::apply( testEp,
+                                                                       trialEp );
+
+        // dof activities, IDs, values and constraints
+        std::vector<base::dof::DoFStatus> rowDoFStatus, colDoFStatus;
+        std::vector<std::size_t> rowDoFIDs, colDoFIDs;
+        std::vector<base::number> rowDoFValues, colDoFValues;
+        base::asmb::ElementConstraints rowConstraints, colConstraints;
+
+        // Collect the row data once for all terms
+        const bool doRows =
+            base::asmb::collectFromDoFs( testEp, rowDoFStatus,
+                                         rowDoFIDs, rowDoFValues,
+                                         rowConstraints,
+                                         incremental_ );
+
+        // if no row dof is ACTIVE or CONSTRAINED, just return
+        if ( not doRows ) return;
+
+        // column data only for matrix terms
+        bool doMatrix = hasMatrix;
+        if ( hasMatrix ) {
+            if ( isBubnov ) {
+                colDoFStatus   = rowDoFStatus;
+                colDoFIDs      = rowDoFIDs;
+                colDoFValues   = rowDoFValues;
+            }
+            else
+                doMatrix =
+                    base::asmb::collectFromDoFs( trialEp, colDoFStatus,
+                                                 colDoFIDs, colDoFValues,
+                                                 colConstraints,
+                                                 incremental_ );
+        }
+
+        if ( not ( doMatrix or hasVector ) ) return;
+
+        // one quadrature loop for all terms
+        ElementData data;
+        data.matrix = base::MatrixD::Zero( doMatrix  ? rowDoFIDs.size() : 0,
+                                           doMatrix  ? colDoFIDs.size() : 0 );
+        data.vector = base::VectorD::Zero( hasVector ? rowDoFIDs.size() : 0 );
+
+        typedef boost::function<void( const FieldTuple&,
+                                      const typename Quadrature::VecDim&,
+                                      const double,
+                                      ElementData& ) > SumKernel;
+        SumKernel sumKernel = KernelSum_( matrixTerms_, vectorTerms_, doMatrix );
+        quadrature_.apply( sumKernel, fieldTuple, data );
+
+        // assemble element matrix to global system
+        if ( doMatrix )
+            base::asmb::assembleMatrix( data.matrix,
+                                        rowDoFStatus, colDoFStatus,
+                                        rowDoFIDs, colDoFIDs,
+                                        colDoFValues,
+                                        rowConstraints,
+                                        ( isBubnov ? rowConstraints : colConstraints ),
+                                        solver_, isBubnov );
+
+        // assemble element vector to global system
+        if ( hasVector )
+            base::asmb::assembleForces( data.vector, rowDoFStatus, rowDoFIDs,
+                                        rowConstraints, solver_ );
+
+        return;
+    }
+
+private:
+    typedef std::vector<std::pair<MatrixKernel,double> > MatrixTerms_;
+    typedef std::vector<std::pair<VectorKernel,double> > VectorTerms_;
+
+    //! Evaluation of all terms at one quadrature point
+    class KernelSum_
+    {
+    public:
+        KernelSum_( const MatrixTerms_& matrixTerms,
+                    const VectorTerms_& vectorTerms,
+                    const bool          doMatrix )
+            : matrixTerms_( matrixTerms ), vectorTerms_( vectorTerms ),
+              doMatrix_( doMatrix )
+        { }
+
+        void operator()( const FieldTuple& fieldTuple,
+                         const typename Quadrature::VecDim& xi,
+                         const double weight,
+                         ElementData& data ) const
+        {
+            if ( doMatrix_ )
+                for ( std::size_t k = 0; k < matrixTerms_.size(); k++ )
+                    matrixTerms_[k].first( fieldTuple, xi,
+                                           matrixTerms_[k].second * weight,
+                                           data.matrix );
+
+            for ( std::size_t l = 0; l < vectorTerms_.size(); l++ )
+                vectorTerms_[l].first( fieldTuple, xi,
+                                       vectorTerms_[l].second * weight,
+                                       data.vector );
+        }
+
+    private:
+        const MatrixTerms_& matrixTerms_;
+        const VectorTerms_& vectorTerms_;
+        const bool          doMatrix_;
+    };
+
+private:
+    const Quadrature&    quadrature_;    //!< Quadrature object
+    Solver&              solver_;        //!< Solver object
+
+    //! Use difference between prescribed and current value
+    const bool incremental_;
+
+    MatrixTerms_  matrixTerms_;  //!< Matrix kernels with factors
+    VectorTerms_  vectorTerms_;  //!< Vector kernels with factors
+};
+
+#endif
@@ -16,6 +16,7 @@
 // base includes
 #include <base/geometry.hpp>
 #include <base/linearAlgebra.hpp>
+#include <base/auxi/Profiler.hpp>
 // base/asmb includes
 #include <base/asmb/ForceIntegrator.hpp>
 
@@ -40,6 +41,7 @@ namespace base{
             const typename
             NeumannForce<typename FIELDTUPLEBINDER::Tuple>::ForceFun& ff )
         {
+            PROFILE_REGION( "asmb::neumannForce" );
 
             // object to compute the neumann force
             typedef NeumannForce<typename FIELDTUPLEBINDER::Tuple> NeumannForce;
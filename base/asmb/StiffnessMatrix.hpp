@@ -23,6 +23,7 @@
 #include <base/linearAlgebra.hpp>
 #include <base/auxi/EqualPointers.hpp>
 #include <base/auxi/parallel.hpp>
+#include <base/auxi/Profiler.hpp>
 // base/asmb includes
 #include <base/asmb/collectFromDoFs.hpp>
 #include <base/asmb/assembleMatrix.hpp>
@@ -55,6 +56,7 @@ namespace base{
                                          const KERNEL&      kernelObj,
                                          const bool         incremental = true )
         {
+            PROFILE_REGION( "asmb::stiffnessMatrix" );
             typedef typename FIELDTUPLEBINDER::Tuple ElementPtrTuple;
             
             // type of stiffness matrix assembly object
@@ -144,11 +146,14 @@ public:
                                    const double,
                                    base::MatrixD& ) >  Kernel;
 
+    //! Result container of the kernel function
+    typedef base::MatrixD Result;
+
     //! Constructor with kernel function, quadrature and solver
     StiffnessMatrix( Kernel&              kernel,
                      const Quadrature&    quadrature,
                      Solver&              solver,
-                     const bool           incremental )
+                     const bool           incremental = false )
         : kernel_(          kernel ),
           quadrature_(      quadrature ),
           solver_(          solver ),
@@ -156,7 +161,23 @@ public:
     { }
 
     //--------------------------------------------------------------------------
+    //! Compute the element matrix by quadrature and assemble it
     void operator()( const FieldTuple& fieldTuple )
+    {
+        this -> assemble_( fieldTuple, NULL );
+    }
+
+    //! Assemble a given element matrix, e.g. from a uniform grid
+    void assembleElementMatrix( const FieldTuple& fieldTuple,
+                                const base::MatrixD& elemMatrix )
+    {
+        this -> assemble_( fieldTuple, &elemMatrix );
+    }
+
+private:
+    //! Collect the DoF data, compute the matrix if not given, and assemble
+    void assemble_( const FieldTuple& fieldTuple,
+                    const base::MatrixD* givenMatrix )
     {
         // extract test and trial elements from tuple
         TestElement*  testEp  = fieldTuple.testElementPtr();
@@ -177,9 +198,7 @@ public:
         std::vector<base::number> rowDoFValues, colDoFValues;
 
         // dof constraints
-        typedef std::pair<unsigned, std::vector< std::pair<base::number,std::size_t> > >
-            WeightedDoFIDs;
-        std::vector<WeightedDoFIDs> rowConstraints, colConstraints;
+        base::asmb::ElementConstraints rowConstraints, colConstraints;
 
         // Collect dof entities from element
         bool doSomething = 
@@ -196,7 +215,6 @@ public:
             colDoFStatus   = rowDoFStatus;
             colDoFIDs      = rowDoFIDs;
             colDoFValues   = rowDoFValues;
-            colConstraints = rowConstraints;
         }
         else // otherwise, collect for trial space
             doSomething =
@@ -210,21 +228,26 @@ public:
 
 
         // Compute the element matrix contribution
-        base::MatrixD elemMatrix = base::MatrixD::Zero( rowDoFIDs.size(),
-                                                        colDoFIDs.size() );
-        quadrature_.apply( kernel_, fieldTuple, elemMatrix );
+        base::MatrixD computedMatrix;
+        if ( givenMatrix == NULL ) {
+            computedMatrix = base::MatrixD::Zero( rowDoFIDs.size(),
+                                                  colDoFIDs.size() );
+            quadrature_.apply( kernel_, fieldTuple, computedMatrix );
+        }
+        const base::MatrixD& elemMatrix =
+            ( givenMatrix != NULL ? *givenMatrix : computedMatrix );
 
         // assemble element matrix to global system
         base::asmb::assembleMatrix( elemMatrix,
                                     rowDoFStatus, colDoFStatus,
                                     rowDoFIDs, colDoFIDs,
                                     colDoFValues,
-                                    rowConstraints, colConstraints,
+                                    rowConstraints,
+                                    ( isBubnov ? rowConstraints : colConstraints ),
                                     solver_, isBubnov );
         return;
     }
     
-private:
     Kernel&              kernel_;        //!< Kernel function 
     const Quadrature&    quadrature_;    //!< Quadrature object
     Solver&              solver_;        //!< Solver object
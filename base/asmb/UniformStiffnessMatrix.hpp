@@ -0,0 +1,306 @@
+//------------------------------------------------------------------------------
+// <preamble>
+// </preamble>
+//------------------------------------------------------------------------------
+
+//! @file   UniformStiffnessMatrix.hpp
+//! @author agent
+//! @date   2026
+
+#ifndef base_asmb_uniformstiffnessmatrix_hpp
+#define base_asmb_uniformstiffnessmatrix_hpp
+
+//------------------------------------------------------------------------------
+// std includes
+#include <vector>
+#include <iterator>
+#include <algorithm>
+// boost includes
+#include <boost/bind.hpp>
+// base includes
+#include <base/shape.hpp>
+#include <base/linearAlgebra.hpp>
+#include <base/auxi/parallel.hpp>
+#include <base/auxi/Profiler.hpp>
+// base/asmb includes
+#include <base/asmb/StiffnessMatrix.hpp>
+
+//------------------------------------------------------------------------------
+namespace base{
+
+    namespace cut{
+        template<unsigned DEGREE, base::Shape SHAPE, typename CELL>
+        class Quadrature;
+
+        template<unsigned DEGREE, base::Shape SHAPE, typename CELL>
+        class MomentFittedQuadrature;
+    }
+
+    namespace asmb{
+
+        template<typename QUAD, typename SOLVER, typename FIELDTUPLE>
+        class UniformStiffnessMatrix;
+
+        //----------------------------------------------------------------------
+        namespace detail_{
+
+            //! Kind of integration rule a quadrature applies to an element
+            enum ElementRule
+            {
+                STANDARD_RULE, //!< Same rule as on every other element
+                SPECIAL_RULE,  //!< Element-specific rule (e.g. cut element)
+                NO_RULE        //!< Nothing to integrate
+            };
+
+            //! Standard quadratures apply the same rule everywhere
+            template<typename QUAD>
+            struct ElementRuleOf
+            {
+                static ElementRule apply( const QUAD&, const std::size_t )
+                {
+                    return STANDARD_RULE;
+                }
+            };
+
+            //! Cut-cell quadrature distinguishes full, cut and void elements
+            template<unsigned DEGREE, base::Shape SHAPE, typename CELL>
+            struct ElementRuleOf< base::cut::Quadrature<DEGREE,SHAPE,CELL> >
+            {
+                typedef base::cut::Quadrature<DEGREE,SHAPE,CELL> Quad;
+
+                static ElementRule apply( const Quad& quad,
+                                          const std::size_t elemID )
+                {
+                    if ( quad.isCut(  elemID ) ) return SPECIAL_RULE;
+                    if ( quad.isFull( elemID ) ) return STANDARD_RULE;
+                    return NO_RULE;
+                }
+            };
+
+            //! Moment-fitted cut-cell quadrature, same classification
+            template<unsigned DEGREE, base::Shape SHAPE, typename CELL>
+            struct ElementRuleOf<
+                base::cut::MomentFittedQuadrature<DEGREE,SHAPE,CELL> >
+            {
+                typedef base::cut::MomentFittedQuadrature<DEGREE,SHAPE,CELL> Quad;
+
+                static ElementRule apply( const Quad& quad,
+                                          const std::size_t elemID )
+                {
+                    if ( quad.isCut(  elemID ) ) return SPECIAL_RULE;
+                    if ( quad.isFull( elemID ) ) return STANDARD_RULE;
+                    return NO_RULE;
+                }
+            };
+
+        }
+
+        //----------------------------------------------------------------------
+        /** Convenience function for the stiffness matrix on a uniform grid.
+         *  Same interface as base::asmb::stiffnessMatrixComputation, but the
+         *  element matrix of the first element with the standard quadrature
+         *  rule is re-used for all elements with the same geometry. Only
+         *  valid for kernels which neither depend on the position nor on the
+         *  current solution, e.g. base::kernel::Laplace or
+         *  base::kernel::Mass with constant coefficients.
+         *  \tparam FIELDTUPLEBINDER Binding of the right field tuple
+         *  \tparam QUADRATURE   Type of quadrature
+         *  \tparam SOLVER       Type of solver
+         *  \tparam FIELDBINDER  Type of field compound
+         *  \tparam KERNEL       Type of object with kernel function implementation
+         */
+        template<typename FIELDTUPLEBINDER,
+                 typename QUADRATURE, typename SOLVER, typename FIELDBINDER,
+                 typename KERNEL>
+        void uniformStiffnessMatrixComputation( const QUADRATURE& quadrature,
+                                                SOLVER& solver,
+                                                const FIELDBINDER& fieldBinder,
+                                                const KERNEL&      kernelObj,
+                                                const bool         incremental = true )
+        {
+            PROFILE_REGION( "asmb::uniformStiffnessMatrix" );
+            typedef typename FIELDTUPLEBINDER::Tuple ElementPtrTuple;
+
+            // type of stiffness matrix assembly object
+            typedef UniformStiffnessMatrix<QUADRATURE,SOLVER,ElementPtrTuple> StiffMat;
+
+            // create a kernel function
+            typename StiffMat::Kernel kernel =
+                boost::bind( &KERNEL::tangentStiffness,
+                             &kernelObj, _1, _2, _3, _4 );
+
+            // Object of the stiff matrix assembler
+            StiffMat stiffness( kernel, quadrature, solver, incremental );
+
+            // Compute the reference element matrix
+            const std::size_t numElements =
+                std::distance( fieldBinder.elementsBegin(),
+                               fieldBinder.elementsEnd() );
+            for ( std::size_t e = 0; e < numElements; e++ ) {
+                if ( stiffness.setReference(
+                         FIELDTUPLEBINDER::makeTuple( fieldBinder.elementPtr( e ) ) ) )
+                    break;
+            }
+
+            // Apply to all elements
+            base::auxi::applyToAllFieldTuple<FIELDTUPLEBINDER>( fieldBinder, stiffness );
+        }
+
+    }
+}
+
+//------------------------------------------------------------------------------
+/** Stiffness matrix assembly with a re-used element matrix.
+ *  On a structured grid with equally sized cells (e.g., base::Structured
+ *  with a uniform spacing) and a kernel with constant coefficients, the
+ *  element matrices
+ *  \f[
+ *       K = \int_{\Omega_e} k dx
+ *  \f]
+ *  are all identical, because the element geometries only differ by a
+ *  translation. This object computes \f$ K \f$ once for a reference element
+ *  and assembles it for every element whose geometry nodes have the same
+ *  offsets with respect to the first node. Every other element takes the
+ *  general path of base::asmb::StiffnessMatrix. Quadratures with an
+ *  element-specific rule are classified by detail_::ElementRuleOf: in case of
+ *  a cut-cell quadrature, only the elements inside the domain re-use the
+ *  reference matrix, cut elements are integrated and elements outside are
+ *  skipped. The DoF handling (constraints, inactive DoFs) is the one of
+ *  base::asmb::StiffnessMatrix.
+ *
+ *  \tparam QUAD         Quadrature
+ *  \tparam SOLVER       Solver
+ *  \tparam FIELDTUPLE   Tuple of field element pointers
+ */
+template<typename QUAD, typename SOLVER, typename FIELDTUPLE>
+class base::asmb::UniformStiffnessMatrix
+    : public boost::function<void( const FIELDTUPLE& )>
+{
+public:
+    //! @name Template parameter
+    //@{
+    typedef QUAD          Quadrature;
+    typedef SOLVER        Solver;
+    typedef FIELDTUPLE    FieldTuple;
+    //@}
+
+    //! Assembly of general elements
+    typedef base::asmb::StiffnessMatrix<Quadrature,Solver,FieldTuple> General;
+
+    //! Kernel function
+    typedef typename General::Kernel Kernel;
+
+    //! @name Geometry access
+    //@{
+    typedef typename FieldTuple::GeomElement    GeomElement;
+    typedef typename GeomElement::Node::VecDim  VecDim;
+    //@}
+
+    //! Constructor with kernel function, quadrature and solver
+    UniformStiffnessMatrix( Kernel&              kernel,
+                            const Quadrature&    quadrature,
+                            Solver&              solver,
+                            const bool           incremental = false )
+        : kernel_(      kernel ),
+          quadrature_(  quadrature ),
+          general_(     kernel, quadrature, solver, incremental ),
+          hasReference_( false )
+    { }
+
+    //--------------------------------------------------------------------------
+    /** Compute the reference element matrix from the given element
+     *  \return False if the quadrature does not apply the standard rule here
+     */
+    bool setReference( const FieldTuple& fieldTuple )
+    {
+        const GeomElement* geomEp = fieldTuple.geomElementPtr();
+        if ( detail_::ElementRuleOf<Quadrature>::apply(
+                 quadrature_, geomEp -> getID() ) != detail_::STANDARD_RULE )
+            return false;
+
+        // offsets of the geometry nodes and their length scale
+        nodeOffsets( geomEp, refOffsets_ );
+        double scale = 0.;
+        for ( std::size_t n = 0; n < refOffsets_.size(); n++ )
+            scale = std::max( scale, refOffsets_[n].norm() );
+        tolerance_ = 1.e-10 * scale;
+
+        // integrate the element matrix once
+        const std::size_t numRows = numDoFComponents_( fieldTuple.testElementPtr()  );
+        const std::size_t numCols = numDoFComponents_( fieldTuple.trialElementPtr() );
+        refMatrix_ = base::MatrixD::Zero( numRows, numCols );
+        quadrature_.apply( kernel_, fieldTuple, refMatrix_ );
+
+        hasReference_ = true;
+        return true;
+    }
+
+    //--------------------------------------------------------------------------
+    //! Assemble the reference matrix if possible, otherwise integrate
+    void operator()( const FieldTuple& fieldTuple )
+    {
+        const GeomElement* geomEp = fieldTuple.geomElementPtr();
+        const detail_::ElementRule rule =
+            detail_::ElementRuleOf<Quadrature>::apply( quadrature_,
+                                                       geomEp -> getID() );
+
+        if ( rule == detail_::NO_RULE ) return;
+
+        if ( ( rule == detail_::STANDARD_RULE ) and
+             this -> matchesReference_( geomEp ) )
+            general_.assembleElementMatrix( fieldTuple, refMatrix_ );
+        else
+            general_( fieldTuple );
+    }
+
+    //--------------------------------------------------------------------------
+    //! Offsets of the geometry nodes with respect to the first one
+    static void nodeOffsets( const GeomElement* geomEp,
+                             std::vector<VecDim>& offsets )
+    {
+        offsets.clear();
+        typename GeomElement::NodePtrConstIter nIter = geomEp -> nodesBegin();
+        typename GeomElement::NodePtrConstIter nEnd  = geomEp -> nodesEnd();
+        const VecDim x0 = (*nIter) -> getX();
+        for ( ++nIter; nIter != nEnd; ++nIter )
+            offsets.push_back( (*nIter) -> getX() - x0 );
+    }
+
+private:
+    //! True if the element is a translated copy of the reference element
+    bool matchesReference_( const GeomElement* geomEp ) const
+    {
+        if ( not hasReference_ ) return false;
+
+        typename GeomElement::NodePtrConstIter nIter = geomEp -> nodesBegin();
+        typename GeomElement::NodePtrConstIter nEnd  = geomEp -> nodesEnd();
+        const VecDim x0 = (*nIter) -> getX();
+        std::size_t n = 0;
+        for ( ++nIter; nIter != nEnd; ++nIter, n++ ) {
+            if ( ( (*nIter) -> getX() - x0 - refOffsets_[n] ).norm() > tolerance_ )
+                return false;
+        }
+        return true;
+    }
+
+    //! Number of DoF components of a field element
+    template<typename ELEMENT>
+    static std::size_t numDoFComponents_( const ELEMENT* ep )
+    {
+        return static_cast<std::size_t>(
+            std::distance( ep -> doFsBegin(), ep -> doFsEnd() ) ) *
+            ELEMENT::DegreeOfFreedom::size;
+    }
+
+private:
+    Kernel&              kernel_;       //!< Kernel function
+    const Quadrature&    quadrature_;   //!< Quadrature object
+    General              general_;      //!< Assembly of general elements
+
+    bool                 hasReference_; //!< Reference matrix is available
+    std::vector<VecDim>  refOffsets_;   //!< Node offsets of reference element
+    double               tolerance_;    //!< Tolerance of the offsets
+    base::MatrixD        refMatrix_;    //!< Reference element matrix
+};
+
+#endif
@@ -20,6 +20,8 @@
 #include <boost/bind.hpp>
 // base includes
 #include <base/linearAlgebra.hpp>
+// base/asmb includes
+#include <base/asmb/collectFromDoFs.hpp>
 
 //------------------------------------------------------------------------------
 namespace base{
@@ -30,11 +32,7 @@ namespace base{
             void assembleForces( const base::VectorD&            forceVec,
                                  const std::vector<base::dof::DoFStatus>& doFStatus,
                                  const std::vector<std::size_t>& doFIDs,
-                                 const std::vector<
-                                     std::pair<unsigned,
-                                               std::vector<std::pair<base::number,
-                                                                     std::size_t> > > > &
-                                 constraints,
+                                 const base::asmb::ElementConstraints& constraints,
                                  SOLVER& solver );
     }
 }
@@ -59,11 +57,7 @@ template<typename SOLVER>
 void base::asmb::assembleForces( const base::VectorD&            forceVec,
                                  const std::vector<base::dof::DoFStatus>& doFStatus,
                                  const std::vector<std::size_t>& doFIDs,
-                                 const std::vector<
-                                     std::pair<unsigned,
-                                               std::vector<std::pair<base::number,
-                                                                     std::size_t> > > > &
-                                 constraints,
+                                 const base::asmb::ElementConstraints& constraints,
                                  SOLVER& solver )
     
 {
@@ -83,11 +77,9 @@ void base::asmb::assembleForces( const base::VectorD&            forceVec,
                 effectiveDoFIDs.push_back( doFIDs[d] );
 
         // contributing dofs
-        for ( unsigned d = 0; d < constraints.size(); d++ ) {
-            for ( unsigned d2 = 0; d2 < constraints[d].second.size(); d2++ ) {
-                effectiveDoFIDs.push_back( constraints[d].second[d2].second );
-            }
-        }
+        effectiveDoFIDs.insert( effectiveDoFIDs.end(),
+                                constraints.ids().begin(),
+                                constraints.ids().end() );
     }
 
     // Result container
@@ -111,18 +103,15 @@ void base::asmb::assembleForces( const base::VectorD&            forceVec,
         else if ( doFStatus[d] == base::dof::CONSTRAINED ) {
 
             // local dof ID of constrained dof (sanity check)
-            const unsigned localDoFID = constraints[ cstrCtr ].first;
+            const unsigned localDoFID = constraints.localDoF( cstrCtr );
             assert( localDoFID == d );
 
-            // array of linear constraints contributing to this dof
-            const std::vector<std::pair<base::number,std::size_t> > constraint =
-                constraints[ cstrCtr ].second;
-
-            // go through all contributors
-            for ( std::size_t d2 = 0; d2 < constraint.size(); d2++) {
+            // go through all contributors to this dof
+            const std::size_t numMasters = constraints.numMasters( cstrCtr );
+            for ( std::size_t d2 = 0; d2 < numMasters; d2++) {
 
                 // weight as mulitplier
-                const base::number weight = constraint[d2].first;
+                const base::number weight = constraints.weight( cstrCtr, d2 );
 
                 sysVector[ numActiveDoFs + extraCtr ] = weight * forceVec[ d ];
                 
@@ -22,6 +22,8 @@
 #include <base/linearAlgebra.hpp>
 // base/dof includes
 #include <base/dof/DegreeOfFreedom.hpp> // for the DoFStatus enum
+// base/asmb includes
+#include <base/asmb/collectFromDoFs.hpp>
 
 //------------------------------------------------------------------------------
 namespace base{
@@ -34,16 +36,8 @@ namespace base{
                              const std::vector<std::size_t>&  rowDoFIDs,
                              const std::vector<std::size_t>&  colDoFIDs,
                              const std::vector<base::number>& colDoFValues,
-                             const std::vector<
-                                 std::pair<unsigned,
-                                           std::vector<std::pair<base::number,
-                                                                 std::size_t> > > > &
-                             rowConstraints,
-                             const std::vector<
-                                 std::pair<unsigned,
-                                           std::vector<std::pair<base::number,
-                                                                 std::size_t> > > > &
-                             colConstraints,
+                             const base::asmb::ElementConstraints& rowConstraints,
+                             const base::asmb::ElementConstraints& colConstraints,
                              SOLVER& solver,
                              const bool isBubnov );
 
@@ -57,11 +51,7 @@ namespace base{
                               const std::size_t                numActiveColDoFs, 
                               const std::vector<base::dof::DoFStatus>& colDoFStatus,
                               const std::vector<base::number>& colDoFValues,
-                              const std::vector<
-                                  std::pair<unsigned,
-                                            std::vector<std::pair<base::number,
-                                                                  std::size_t> > > > &
-                              colConstraints,
+                              const base::asmb::ElementConstraints& colConstraints,
                               const unsigned r,
                               const unsigned rowCtr,
                               const base::number   rowWeight,
@@ -95,21 +85,19 @@ namespace base{
                             colDoFValues[ c ] * rowWeight * elemMatrix( r, c );
 
                         // local ID of the constrained DoF for sanity check only
-                        const unsigned localDofID = colConstraints[colCstrCtr].first;
+                        const unsigned localDofID = colConstraints.localDoF( colCstrCtr );
 
                         // assertion of correct ID
                         assert( localDofID == c );
 
-                        // the linear constraint of this DoF
-                        std::vector<std::pair<base::number,std::size_t> > constraints =
-                            colConstraints[ colCstrCtr ].second;
-
-                        // go through all linear constraints 
-                        for ( std::size_t c2 = 0; c2 < constraints.size(); c2++ ) {
-
+                        // go through all linear constraints of this DoF
+                        const std::size_t numMasters =
+                            colConstraints.numMasters( colCstrCtr );
+                        for ( std::size_t c2 = 0; c2 < numMasters; c2++ ) {
 
                             // multiplier of master DoF entry
-                            const base::number colWeight = constraints[c2].first;
+                            const base::number colWeight =
+                                colConstraints.weight( colCstrCtr, c2 );
 
                             // insert to additional columns
                             sysMatrix( rowCtr,
@@ -216,16 +204,8 @@ void base::asmb::assembleMatrix( const base::MatrixD&             elemMatrix,
                                  const std::vector<std::size_t>&  rowDoFIDs,
                                  const std::vector<std::size_t>&  colDoFIDs,
                                  const std::vector<base::number>& colDoFValues,
-                                 const std::vector<
-                                     std::pair<unsigned,
-                                               std::vector<std::pair<base::number,
-                                                                     std::size_t> > > > &
-                                 rowConstraints,
-                                 const std::vector<
-                                     std::pair<unsigned,
-                                               std::vector<std::pair<base::number,
-                                                                     std::size_t> > > > &
-                                 colConstraints,
+                                 const base::asmb::ElementConstraints& rowConstraints,
+                                 const base::asmb::ElementConstraints& colConstraints,
                                  SOLVER& solver,
                                  const bool isBubnov )
 {
@@ -251,11 +231,9 @@ void base::asmb::assembleMatrix( const base::MatrixD&             elemMatrix,
                 effRowDoFIDs.push_back( rowDoFIDs[r] );
 
         // collect master dof IDs from linear constraints
-        for ( unsigned r = 0; r < rowConstraints.size(); r++ ) {
-            for ( unsigned r2 = 0; r2 < (rowConstraints[r]).second.size(); r2++ ) {
-                effRowDoFIDs.push_back( (rowConstraints[r].second[r2].second) );
-            }
-        }
+        effRowDoFIDs.insert( effRowDoFIDs.end(),
+                             rowConstraints.ids().begin(),
+                             rowConstraints.ids().end() );
 
         // if test- and trial-spaces are equal, just copy the IDs
         if ( isBubnov ) effColDoFIDs = effRowDoFIDs;
@@ -265,11 +243,9 @@ void base::asmb::assembleMatrix( const base::MatrixD&             elemMatrix,
                 if ( colDoFStatus[c] == base::dof::ACTIVE )
                     effColDoFIDs.push_back( colDoFIDs[c] );
 
-            for ( unsigned c = 0; c < colConstraints.size(); c++ ) {
-                for ( unsigned c2 = 0; c2 < (colConstraints[c]).second.size(); c2++ ) {
-                    effColDoFIDs.push_back( (colConstraints[c].second[c2].second) );
-                }
-            }
+            effColDoFIDs.insert( effColDoFIDs.end(),
+                                 colConstraints.ids().begin(),
+                                 colConstraints.ids().end() );
         }
     }
     
@@ -302,18 +278,15 @@ void base::asmb::assembleMatrix( const base::MatrixD&             elemMatrix,
         else if ( rowDoFStatus[r] == base::dof::CONSTRAINED ) {
 
             // sanity check of the passed constrained array
-            const unsigned localDoFID = rowConstraints[ rowCstrCtr ].first;
+            const unsigned localDoFID = rowConstraints.localDoF( rowCstrCtr );
             assert( localDoFID == r );
 
-            // get vector of constrains for this row
-            const std::vector<std::pair<base::number,std::size_t> > constraints =
-                rowConstraints[ rowCstrCtr ].second;
-
             // go through all rows which contribute to this constrained one
-            for ( std::size_t r2 = 0; r2 < constraints.size(); r2++) {
+            const std::size_t numMasters = rowConstraints.numMasters( rowCstrCtr );
+            for ( std::size_t r2 = 0; r2 < numMasters; r2++) {
 
                 // weight multiplies the row
-                const base::number rowWeight = constraints[r2].first;
+                const base::number rowWeight = rowConstraints.weight( rowCstrCtr, r2 );
 
                 // assemble additional row due to linear constraint
                 detail_::assembleRow( colDoFIDs.size(), numActiveColDoFs, colDoFStatus,
@@ -18,11 +18,14 @@
 #include <utility>
 // base/dof includes
 #include <base/dof/DegreeOfFreedom.hpp>
+#include <base/dof/ConstraintTable.hpp>
 
 //------------------------------------------------------------------------------
 namespace base{
     namespace asmb{
 
+        class ElementConstraints;
+
         //------------------------------------------------------------------
         //! Helper to collect relevant data from the dof objects
         template<typename FELEMENT>
@@ -30,15 +33,95 @@ namespace base{
                               std::vector<base::dof::DoFStatus>& status,
                               std::vector<std::size_t>& ids,
                               std::vector<number>&      values,
-                              std::vector<
-                              std::pair<unsigned, std::vector<
-                              std::pair<number, std::size_t> >
-                              > >& constraints,
+                              ElementConstraints&       constraints,
                               const bool incremental );
         
     }
 }
 
+//------------------------------------------------------------------------------
+/** Linear constraints of the DoF components of an element.
+ *  For every constrained component, the local DoF counter and the pairs of
+ *  weight and global ID of the master DoFs are stored. All pairs are kept in
+ *  contiguous arrays, such that the collection for an element needs no memory
+ *  allocation beyond the growth of these arrays.
+ */
+class base::asmb::ElementConstraints
+{
+public:
+    //! Empty constructor
+    ElementConstraints() : offsets_( 1, 0 ) { }
+
+    //! Add the constraint of a local DoF
+    void add( const unsigned localDoF,
+              const std::size_t numMasters,
+              const number* weights,
+              const std::size_t* ids )
+    {
+        localDoFs_.push_back( localDoF );
+        weights_.insert( weights_.end(), weights, weights + numMasters );
+        ids_.insert(     ids_.end(),     ids,     ids     + numMasters );
+        offsets_.push_back( ids_.size() );
+    }
+
+    //! Add the constraint of a local DoF from a constraint object
+    template<typename CONSTRAINT>
+    void add( const unsigned localDoF, const CONSTRAINT* constraint )
+    {
+        localDoFs_.push_back( localDoF );
+        for ( std::size_t w = 0; w < constraint -> numWeightedDoFs(); w++ ) {
+            const typename CONSTRAINT::WeightedDoF& weightedDoF =
+                constraint -> getWeightedDoF( w );
+            const unsigned dir = weightedDoF.template get<1>();
+            
+            // guarantee that the master DoF is active
+            ASSERT_MSG( (weightedDoF.template get<0>()) -> isActive( dir ),
+                        "DoF with ID " +
+                        x2s( (weightedDoF.template get<0>()) -> getID() ) +
+                        " is not active" );
+
+            weights_.push_back( weightedDoF.template get<2>() );
+            ids_.push_back( (weightedDoF.template get<0>()) -> getIndex( dir ) );
+        }
+        offsets_.push_back( ids_.size() );
+    }
+
+    //! Number of constrained local DoFs
+    std::size_t size() const { return localDoFs_.size(); }
+
+    //! Local DoF counter of the c-th constraint
+    unsigned localDoF( const std::size_t c ) const { return localDoFs_[c]; }
+
+    //! Number of master DoFs of the c-th constraint
+    std::size_t numMasters( const std::size_t c ) const
+    {
+        return offsets_[c+1] - offsets_[c];
+    }
+
+    //! Weight of the m-th master DoF of the c-th constraint
+    number weight( const std::size_t c, const std::size_t m ) const
+    {
+        return weights_[ offsets_[c] + m ];
+    }
+
+    //! Global ID of the m-th master DoF of the c-th constraint
+    std::size_t id( const std::size_t c, const std::size_t m ) const
+    {
+        return ids_[ offsets_[c] + m ];
+    }
+
+    //! Total number of master DoFs
+    std::size_t numAllMasters() const { return ids_.size(); }
+
+    //! Global IDs of all master DoFs in the order of the constraints
+    const std::vector<std::size_t>& ids() const { return ids_; }
+
+private:
+    std::vector<unsigned>    localDoFs_;                //!< Local DoF counters
+    std::vector<std::size_t> offsets_;                  //!< Row pointers
+    std::vector<number>      weights_;                  //!< Weights
+    std::vector<std::size_t> ids_;                      //!< Global IDs
+};
 
 //------------------------------------------------------------------------------
 /** With access to a field element, collect all the assembly-relevant DoF-data.
@@ -65,6 +148,9 @@ namespace base{
  *       \{ j, c_{ij} \}_{j \in C(i)}
  *  \f]
  *  is associated with a local DoF counter and provided to the caller.
+ *  If a base::dof::ConstraintTable has been built for the DoFs, these pairs
+ *  are copied from its flat storage, otherwise they are taken from the
+ *  constraint objects.
  *  For immersed FE simulations it is frequently the case that there is huge
  *  number of inactive DoFs. Therefore this function returns a flag which
  *  indicates if any DoF is ACTIVE or CONSTRAINED. If this is not the case,
@@ -84,13 +170,11 @@ bool base::asmb::collectFromDoFs( const FELEMENT*           fElement,
                                   std::vector<base::dof::DoFStatus>& status,
                                   std::vector<std::size_t>& ids,
                                   std::vector<number>&      values,
-                                  std::vector< std::pair<unsigned,
-                                                         std::vector<std::pair<number,
-                                                                               std::size_t> >
-                                  > >& constraints,
+                                  ElementConstraints&       constraints,
                                   const bool incremental )
 {
     typedef typename FELEMENT::DegreeOfFreedom DegreeOfFreedom;
+    typedef base::dof::ConstraintTable<DegreeOfFreedom> ConstraintTable;
                 
     // Get the element's DoF pointers
     std::vector<DegreeOfFreedom*> doFs;
@@ -104,6 +188,9 @@ bool base::asmb::collectFromDoFs( const FELEMENT*           fElement,
         doFs[d] -> getPrescribedValues( std::back_inserter( values ), incremental );
     }
 
+    // flat storage of the constraints, if available
+    const bool useTable = ConstraintTable::anyActive();
+
     // get linear constraints
     unsigned localDoF = 0; // number of the local dof which might be constrained
 
@@ -117,12 +204,16 @@ bool base::asmb::collectFromDoFs( const FELEMENT*           fElement,
             // check if DoF is possibly constrained
             if ( status[localDoF] == base::dof::CONSTRAINED ) { 
 
-                // get pairs of weight and global DoF ID
-                std::vector<std::pair<number,std::size_t> > weightedDoFIDs;
-                doFs[d] -> getConstraint( s ) -> getWeightedDoFIDs( weightedDoFIDs );
-
-                // store pair of local ID and weighted dof IDs
-                constraints.push_back( std::make_pair( localDoF, weightedDoFIDs ) );
+                // store local ID with pairs of weight and global DoF ID
+                std::size_t row = base::invalidInt;
+                const ConstraintTable* table =
+                    ( useTable ? ConstraintTable::lookUp( doFs[d], s, row ) : NULL );
+                if ( table != NULL )
+                    constraints.add( localDoF, table -> numMasters( row ),
+                                     table -> weights( row ),
+                                     table -> indices( row ) );
+                else
+                    constraints.add( localDoF, doFs[d] -> getConstraint( s ) );
 
                 allDoFsAreInactive = false;
             }
@@ -13,6 +13,9 @@
 //------------------------------------------------------------------------------
 // std   includes
 #include <sys/sysinfo.h>
+#include <sys/resource.h>
+#include <unistd.h>
+#include <fstream>
 
 //------------------------------------------------------------------------------
 namespace base{
@@ -28,7 +31,7 @@ namespace base{
          *  results will be imprecise and can serve only as an indication.
          *  \return Number of bytes as difference betweeen total and free RAM
          */
-        unsigned long memoryUsageInBytes()
+        inline unsigned long memoryUsageInBytes()
         {
             struct sysinfo memInfo;
             sysinfo (&memInfo);
@@ -41,7 +44,7 @@ namespace base{
         }
 
         //! Return the number of MegaBytes currently in use
-        double memoryUsageInMegaBytes( )
+        inline double memoryUsageInMegaBytes( )
         {
             // get number of bytes
             const unsigned long bytes = memoryUsageInBytes();
@@ -53,6 +56,28 @@ namespace base{
             return MB;
         }
 
+        //----------------------------------------------------------------------
+        /** Return the resident set size of this process in bytes.
+         *  Unlike memoryUsageInBytes(), only the pages of this process are
+         *  counted. Read from /proc/self/statm, hence Linux only.
+         */
+        inline unsigned long residentSetInBytes()
+        {
+            std::ifstream statm( "/proc/self/statm" );
+            unsigned long size = 0, resident = 0;
+            statm >> size >> resident;
+            return resident * static_cast<unsigned long>( sysconf( _SC_PAGESIZE ) );
+        }
+
+        //! Return the peak resident set size of this process in bytes
+        inline unsigned long peakResidentSetInBytes()
+        {
+            struct rusage usage;
+            getrusage( RUSAGE_SELF, &usage );
+            // Linux reports kilo-bytes
+            return static_cast<unsigned long>( usage.ru_maxrss ) * 1024;
+        }
+
     }
 }
 
@@ -0,0 +1,520 @@
+//------------------------------------------------------------------------------
+// <preamble>
+// </preamble>
+//------------------------------------------------------------------------------
+
+//! @file   Profiler.hpp
+//! @author agent
+//! @date   2026
+
+#ifndef base_auxi_profiler_hpp
+#define base_auxi_profiler_hpp
+
+//------------------------------------------------------------------------------
+// std   includes
+#include <new>
+#include <vector>
+#include <string>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <algorithm>
+// boost includes
+#include <boost/utility.hpp>
+// base includes
+#include <base/auxi/Timer.hpp>
+#include <base/auxi/Memory.hpp>
+#include <base/auxi/parallel.hpp>
+
+//------------------------------------------------------------------------------
+/** Profiling of named regions.
+ *  With the compilation flag PROFILING, the macro PROFILE_REGION( name )
+ *  opens a region which closes at the end of the enclosing scope. Otherwise
+ *  the macro is empty and causes no overhead at all.
+ */
+#ifdef PROFILING
+#define PROFILE_REGION_CAT_( A, B ) A##B
+#define PROFILE_REGION_VAR_( LINE ) PROFILE_REGION_CAT_( profileRegion_, LINE )
+#define PROFILE_REGION( NAME )                                          \
+    base::auxi::ProfileRegion PROFILE_REGION_VAR_( __LINE__ )( NAME )
+#else
+#define PROFILE_REGION( NAME )
+#endif
+
+//------------------------------------------------------------------------------
+namespace base{
+    namespace auxi{
+
+        class Profiler;
+        class ProfileRegion;
+
+        namespace detail_{
+
+            //------------------------------------------------------------------
+            /** Process-wide counter of allocations.
+             *  It is only incremented if base/auxi/countAllocations.hpp is
+             *  included in (exactly) one translation unit.
+             */
+            inline unsigned long long& allocationCounter()
+            {
+                static unsigned long long counter = 0;
+                return counter;
+            }
+
+            //------------------------------------------------------------------
+            //! Escape a string for JSON output
+            inline std::string jsonString( const std::string& s )
+            {
+                std::string result = "\"";
+                for ( std::size_t i = 0; i < s.size(); i++ ) {
+                    if ( ( s[i] == '"' ) or ( s[i] == '\\' ) ) result += '\\';
+                    result += s[i];
+                }
+                return result + "\"";
+            }
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+/** Collection of the timings of hierarchical regions.
+ *  Every thread has its own tree of regions, a region is identified by its
+ *  name and the one of its parent. Entering and leaving a region only
+ *  touches the data of the calling thread, hence no synchronisation is
+ *  needed, and the data of every thread starts at a cache line of its own.
+ *  In addition, every closed region is stored as an event for the
+ *  trace output (up to a maximal number per thread).
+ *  The outermost regions of the worker threads, e.g. within the loops of
+ *  base::auxi::applyToAll, are attached to the region which the master
+ *  thread had open when the parallel region started. For this purpose, the
+ *  master thread keeps its innermost region outside of parallel regions.
+ *
+ *  At program exit, a summary is printed to std::cerr with the regions of
+ *  all threads merged by their path, and a trace is written to the file
+ *  given by the environment variable PROFILE_TRACE (default
+ *  'profile.json'). This file is in the Chrome trace event format and can
+ *  be viewed with chrome://tracing or similar tools. In a distributed run,
+ *  base::mpi::Environment sets the rank, which is then inserted before the
+ *  extension of the file name (e.g. 'profile.3.json').
+ */
+class base::auxi::Profiler : boost::noncopyable
+{
+public:
+    //! Maximal number of threads which are recorded
+    static const int maxNumThreads = 256;
+    //! Maximal number of trace events per thread
+    static const std::size_t maxNumEvents = 1000000;
+
+    //! Access to the single object
+    static Profiler& instance()
+    {
+        static Profiler profiler;
+        return profiler;
+    }
+
+    //--------------------------------------------------------------------------
+    //! Open a region in the calling thread
+    void enter( const char* name )
+    {
+        const int t = base::auxi::threadNum();
+        if ( t >= maxNumThreads ) return;
+        ThreadData_& data = threads_[t];
+        const unsigned long long before = this -> counter_();
+
+        // find or create the child of the current region, outermost regions
+        // of the workers are children of the master's open region
+        std::size_t parent = NONE_, masterParent = NONE_;
+        if ( not data.stack.empty() ) parent = data.stack.back().node;
+        else if ( t > 0 )             masterParent = masterNode_;
+        std::size_t node = NONE_;
+        const std::vector<std::size_t>& children =
+            ( parent == NONE_ ? data.roots : data.nodes[parent].children );
+        for ( std::size_t c = 0; c < children.size(); c++ )
+            if ( ( data.nodes[ children[c] ].name == name ) and
+                 ( data.nodes[ children[c] ].masterParent == masterParent ) ) {
+                node = children[c];
+                break;
+            }
+        if ( node == NONE_ ) {
+            node = data.nodes.size();
+            data.nodes.push_back( Node_( name, masterParent ) );
+            if ( parent == NONE_ ) data.roots.push_back( node );
+            else data.nodes[parent].children.push_back( node );
+        }
+
+        Open_ open;
+        open.node = node;
+        data.stack.push_back( open );
+
+        if ( ( t == 0 ) and ( not base::auxi::inParallelRegion() ) )
+            masterNode_ = node;
+
+        // the region starts after the book-keeping
+        this -> addOwnAllocations_( before );
+        data.stack.back().start       = detail_::getTimeInMicroSeconds();
+        data.stack.back().allocations = this -> allocations_();
+    }
+
+    //! Close the innermost region of the calling thread
+    void leave()
+    {
+        const int t = base::auxi::threadNum();
+        if ( t >= maxNumThreads ) return;
+        ThreadData_& data = threads_[t];
+        if ( data.stack.empty() ) return;
+
+        const TimeUnit           end         = detail_::getTimeInMicroSeconds();
+        const unsigned long long allocations = this -> allocations_();
+        const unsigned long long before      = this -> counter_();
+
+        const Open_ open = data.stack.back();
+        data.stack.pop_back();
+
+        if ( ( t == 0 ) and ( not base::auxi::inParallelRegion() ) )
+            masterNode_ = ( data.stack.empty() ? static_cast<std::size_t>( NONE_ ) :
+                            data.stack.back().node );
+
+        const TimeUnit duration = end - open.start;
+        Node_& node = data.nodes[ open.node ];
+        node.calls++;
+        node.time        += duration;
+        node.allocations += allocations - open.allocations;
+
+        if ( data.events.size() < maxNumEvents ) {
+            Event_ event;
+            event.node     = open.node;
+            event.start    = open.start - start_;
+            event.duration = duration;
+            data.events.push_back( event );
+        }
+        else data.numDropped++;
+
+        this -> addOwnAllocations_( before );
+    }
+
+    //--------------------------------------------------------------------------
+    /** Print the summary of all regions.
+     *  Times are summed over the threads, the self time excludes the
+     *  child regions (of all threads). The allocation counts include those
+     *  of other threads running at the same time, but not the ones of the
+     *  profiler itself.
+     */
+    void report( std::ostream& out ) const
+    {
+        const unsigned long long allocations = this -> allocations_();
+
+        // the master's regions first, their entries are parents of workers
+        const std::size_t none = NONE_;
+        std::vector<Summary_> summary;
+        std::vector<std::size_t> masterEntries( threads_[0].nodes.size(), none );
+        for ( std::size_t r = 0; r < threads_[0].roots.size(); r++ )
+            merge_( threads_[0], threads_[0].roots[r], 0, summary, NONE_,
+                    masterEntries );
+
+        std::vector<std::size_t> noEntries;
+        for ( int t = 1; t < maxNumThreads; t++ )
+            for ( std::size_t r = 0; r < threads_[t].roots.size(); r++ ) {
+                const std::size_t root = threads_[t].roots[r];
+                const std::size_t masterParent =
+                    threads_[t].nodes[root].masterParent;
+                merge_( threads_[t], root, t, summary,
+                        ( masterParent == none ? none :
+                          masterEntries[ masterParent ] ), noEntries );
+            }
+
+        const double wallTime =
+            static_cast<double>( detail_::getTimeInMicroSeconds() - start_ ) * 1.e-6;
+
+        out << "# Profile";
+        if ( rank_ >= 0 ) out << " of rank " << rank_;
+        out << ": wall time " << wallTime << " s, peak RSS "
+            << static_cast<double>( peakResidentSetInBytes() ) / 1.e6
+            << " MB, allocations " << allocations << "\n"
+            << "# " << std::left << std::setw( 40 ) << "region" << std::right
+            << std::setw( 10 ) << "calls"
+            << std::setw( 12 ) << "total[s]"
+            << std::setw( 12 ) << "self[s]"
+            << std::setw( 9 )  << "threads"
+            << std::setw( 14 ) << "allocations" << "\n";
+
+        for ( std::size_t s = 0; s < summary.size(); s++ ) {
+            if ( summary[s].parent != NONE_ ) continue;
+            print_( out, summary, s );
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    //! Write all recorded events in the Chrome trace event format
+    void writeTrace( std::ostream& out ) const
+    {
+        out << "{\"traceEvents\":[\n";
+        bool first = true;
+        for ( int t = 0; t < maxNumThreads; t++ ) {
+            const ThreadData_& data = threads_[t];
+            for ( std::size_t e = 0; e < data.events.size(); e++ ) {
+                const Event_& event = data.events[e];
+                out << ( first ? "" : ",\n" )
+                    << "{\"name\":"
+                    << detail_::jsonString( data.nodes[ event.node ].name )
+                    << ",\"ph\":\"X\",\"pid\":" << ( rank_ >= 0 ? rank_ : 0 )
+                    << ",\"tid\":" << t
+                    << ",\"ts\":"  << event.start
+                    << ",\"dur\":" << event.duration << "}";
+                first = false;
+            }
+        }
+        out << "\n],\n\"otherData\":{"
+            << "\"peakRSSBytes\":" << peakResidentSetInBytes()
+            << ",\"allocations\":" << this -> allocations_()
+            << ",\"droppedEvents\":" << numDropped_() << "}}\n";
+    }
+
+    //--------------------------------------------------------------------------
+    //! Set the rank of this process in a distributed run
+    void setRank( const int rank ) { rank_ = rank; }
+
+    //--------------------------------------------------------------------------
+    //! Write summary and trace file
+    ~Profiler()
+    {
+        // one piece of output, which is not interleaved with other ranks
+        std::ostringstream summary;
+        this -> report( summary );
+        std::cerr << summary.str() << std::flush;
+
+        const char* env = std::getenv( "PROFILE_TRACE" );
+        std::string fileName = ( env == NULL ? "profile.json" : env );
+
+        // every rank writes its own file
+        if ( rank_ >= 0 ) {
+            std::ostringstream suffix;
+            suffix << "." << rank_;
+            const std::size_t dot = fileName.find_last_of( '.' );
+            const std::size_t slash = fileName.find_last_of( '/' );
+            if ( ( dot == std::string::npos ) or
+                 ( ( slash != std::string::npos ) and ( dot < slash ) ) )
+                fileName += suffix.str();
+            else
+                fileName.insert( dot, suffix.str() );
+        }
+
+        std::ofstream trace( fileName.c_str() );
+        if ( trace.is_open() ) this -> writeTrace( trace );
+
+        for ( int t = 0; t < maxNumThreads; t++ ) threads_[t].~ThreadData_();
+        delete [] storage_;
+    }
+
+private:
+    //! Store the start time of the profile
+    Profiler()
+        : start_( detail_::getTimeInMicroSeconds() ),
+          storage_( new char[ maxNumThreads * sizeof( ThreadData_ ) + cacheLine_ ] ),
+          masterNode_( NONE_ ),
+          ownAllocations_( 0 ),
+          rank_( -1 )
+    {
+        // thread data at the cache line boundaries, no false sharing
+        const std::size_t offset =
+            reinterpret_cast<std::size_t>( storage_ ) % cacheLine_;
+        threads_ = reinterpret_cast<ThreadData_*>(
+            storage_ + ( offset == 0 ? 0 : cacheLine_ - offset ) );
+        for ( int t = 0; t < maxNumThreads; t++ )
+            new ( threads_ + t ) ThreadData_();
+    }
+
+    static const std::size_t NONE_ = static_cast<std::size_t>( -1 );
+
+    //! Size of a cache line in bytes
+    static const std::size_t cacheLine_ = 64;
+
+    //! Accumulated data of a region
+    struct Node_
+    {
+        Node_( const char* n, const std::size_t m )
+            : name( n ), masterParent( m ), calls( 0 ), time( 0 ), allocations( 0 ) { }
+        std::string              name;
+        std::size_t              masterParent; //!< Master's region, workers
+        std::vector<std::size_t> children;
+        unsigned long            calls;
+        TimeUnit                 time;
+        unsigned long long       allocations;
+    };
+
+    //! Currently open region
+    struct Open_
+    {
+        std::size_t        node;
+        TimeUnit           start;
+        unsigned long long allocations;
+    };
+
+    //! Closed region for the trace
+    struct Event_
+    {
+        std::size_t node;
+        TimeUnit    start;
+        TimeUnit    duration;
+    };
+
+    //! All data of one thread
+    struct ThreadDataBase_
+    {
+        ThreadDataBase_() : numDropped( 0 ) { }
+        std::vector<Node_>       nodes;
+        std::vector<std::size_t> roots;
+        std::vector<Open_>       stack;
+        std::vector<Event_>      events;
+        std::size_t              numDropped;
+    };
+
+    //! Thread data padded to a multiple of the cache line size
+    struct ThreadData_ : ThreadDataBase_
+    {
+        char padding[ cacheLine_ - sizeof( ThreadDataBase_ ) % cacheLine_ ];
+    };
+
+    //! Region merged over threads
+    struct Summary_
+    {
+        std::string              name;
+        std::size_t              parent;
+        std::vector<std::size_t> children;
+        unsigned long            calls;
+        TimeUnit                 time;
+        unsigned long long       allocations;
+        std::vector<int>         threads;
+    };
+
+    //--------------------------------------------------------------------------
+    //! Merge a region of a thread's tree into the summary
+    static void merge_( const ThreadData_& data, const std::size_t node,
+                        const int thread, std::vector<Summary_>& summary,
+                        const std::size_t parent,
+                        std::vector<std::size_t>& entries )
+    {
+        const Node_& n = data.nodes[node];
+
+        // find the entry with the same path
+        std::size_t s = NONE_;
+        for ( std::size_t i = 0; i < summary.size(); i++ )
+            if ( ( summary[i].parent == parent ) and ( summary[i].name == n.name ) ) {
+                s = i;
+                break;
+            }
+        if ( s == NONE_ ) {
+            s = summary.size();
+            Summary_ entry;
+            entry.name = n.name;
+            entry.parent = parent;
+            entry.calls = 0;
+            entry.time = 0;
+            entry.allocations = 0;
+            summary.push_back( entry );
+            if ( parent != NONE_ ) summary[parent].children.push_back( s );
+        }
+
+        if ( not entries.empty() ) entries[node] = s;
+        summary[s].calls       += n.calls;
+        summary[s].time        += n.time;
+        summary[s].allocations += n.allocations;
+        if ( std::find( summary[s].threads.begin(), summary[s].threads.end(),
+                        thread ) == summary[s].threads.end() )
+            summary[s].threads.push_back( thread );
+
+        for ( std::size_t c = 0; c < n.children.size(); c++ )
+            merge_( data, n.children[c], thread, summary, s, entries );
+    }
+
+    //! Print a summary entry and its children
+    static void print_( std::ostream& out, const std::vector<Summary_>& summary,
+                        const std::size_t s, const unsigned level = 0 )
+    {
+        const Summary_& entry = summary[s];
+        TimeUnit childTime = 0;
+        for ( std::size_t c = 0; c < entry.children.size(); c++ )
+            childTime += summary[ entry.children[c] ].time;
+        const TimeUnit selfTime = ( entry.time > childTime ?
+                                    entry.time - childTime : 0 );
+
+        out << "  " << std::left << std::setw( 40 )
+            << ( std::string( 2*level, ' ' ) + entry.name ) << std::right
+            << std::setw( 10 ) << entry.calls
+            << std::setw( 12 ) << std::fixed << std::setprecision( 4 )
+            << static_cast<double>( entry.time ) * 1.e-6
+            << std::setw( 12 ) << static_cast<double>( selfTime ) * 1.e-6
+            << std::setw( 9 )  << entry.threads.size()
+            << std::setw( 14 ) << entry.allocations << "\n";
+        out.unsetf( std::ios_base::floatfield );
+
+        for ( std::size_t c = 0; c < entry.children.size(); c++ )
+            print_( out, summary, entry.children[c], level+1 );
+    }
+
+    //! Current value of the allocation counter, read atomically
+    static unsigned long long counter_()
+    {
+        const unsigned long long& counter = detail_::allocationCounter();
+        unsigned long long result;
+#ifdef _OPENMP
+#pragma omp atomic read
+#endif
+        result = counter;
+        return result;
+    }
+
+    //! Allocations of the program without those of the profiler
+    unsigned long long allocations_() const
+    {
+        unsigned long long own;
+#ifdef _OPENMP
+#pragma omp atomic read
+#endif
+        own = ownAllocations_;
+        return counter_() - own;
+    }
+
+    //! Book the allocations since a counter value as the profiler's own
+    void addOwnAllocations_( const unsigned long long before )
+    {
+        const unsigned long long own = counter_() - before;
+        if ( own == 0 ) return;
+#ifdef _OPENMP
+#pragma omp atomic
+#endif
+        ownAllocations_ += own;
+    }
+
+    //! Total number of events which did not fit into the trace
+    std::size_t numDropped_() const
+    {
+        std::size_t num = 0;
+        for ( int t = 0; t < maxNumThreads; t++ ) num += threads_[t].numDropped;
+        return num;
+    }
+
+private:
+    const TimeUnit           start_;          //!< Start of the profile
+    char*                    storage_;        //!< Memory of the thread data
+    ThreadData_*             threads_;        //!< Data per thread
+    std::size_t              masterNode_;     //!< Master's region for the workers
+    unsigned long long       ownAllocations_; //!< Allocations of the profiler
+    int                      rank_;           //!< MPI rank or -1
+};
+
+//------------------------------------------------------------------------------
+/** Scoped region of the profiler.
+ *  Use via the macro PROFILE_REGION, such that the region disappears
+ *  without the flag PROFILING.
+ */
+class base::auxi::ProfileRegion : boost::noncopyable
+{
+public:
+    ProfileRegion( const char* name ) { Profiler::instance().enter( name ); }
+    ~ProfileRegion()                  { Profiler::instance().leave(); }
+};
+
+#endif
@@ -12,7 +12,7 @@
 
 //------------------------------------------------------------------------------
 // std   includes
-#include <sys/time.h>
+#include <time.h>
 #include <ctime>
 #include <iostream>
 #include <cmath>
@@ -28,12 +28,13 @@ namespace base{
 
         namespace detail_{
 
-            //! Helper function to get time from the system (in micro-s)
-            TimeUnit getTimeInMicroSeconds()
+            //! Helper function to get time from a monotonic clock (in micro-s)
+            inline TimeUnit getTimeInMicroSeconds()
             {
-                timeval tv;
-                gettimeofday(&tv, NULL);
-                TimeUnit ret = tv.tv_usec + (tv.tv_sec * 1000000);
+                timespec ts;
+                clock_gettime( CLOCK_MONOTONIC, &ts );
+                TimeUnit ret = static_cast<TimeUnit>( ts.tv_nsec / 1000 ) +
+                    static_cast<TimeUnit>( ts.tv_sec ) * 1000000;
                 return ret;
             }
         }
@@ -0,0 +1,54 @@
+//------------------------------------------------------------------------------
+// <preamble>
+// </preamble>
+//------------------------------------------------------------------------------
+
+//! @file   countAllocations.hpp
+//! @author agent
+//! @date   2026
+
+#ifndef base_auxi_countallocations_hpp
+#define base_auxi_countallocations_hpp
+
+//------------------------------------------------------------------------------
+// std   includes
+#include <new>
+#include <cstdlib>
+// base includes
+#include <base/auxi/Profiler.hpp>
+
+//------------------------------------------------------------------------------
+/** @file
+ *  Replacement of the global operators new and delete which counts every
+ *  allocation in base::auxi::detail_::allocationCounter(), reported by the
+ *  Profiler. Replacing these operators is only allowed once per program,
+ *  therefore this file has to be included in exactly one translation unit,
+ *  usually the one with the main function.
+ */
+
+namespace base{
+    namespace auxi{
+        namespace detail_{
+
+            //! Count and perform an allocation
+            inline void* countedAllocation( std::size_t size )
+            {
+#ifdef _OPENMP
+#pragma omp atomic
+#endif
+                allocationCounter()++;
+
+                void* p = std::malloc( size == 0 ? 1 : size );
+                if ( p == NULL ) throw std::bad_alloc();
+                return p;
+            }
+        }
+    }
+}
+
+void* operator new(   std::size_t size ) { return base::auxi::detail_::countedAllocation( size ); }
+void* operator new[]( std::size_t size ) { return base::auxi::detail_::countedAllocation( size ); }
+void  operator delete(   void* p ) throw() { std::free( p ); }
+void  operator delete[]( void* p ) throw() { std::free( p ); }
+
+#endif
@@ -21,40 +21,96 @@ namespace base{
     namespace auxi{
 
         //----------------------------------------------------------------------
-        //! Outsourced function from assembly routines in order to employ openMP
-        template<typename FIELDTUPLEBINDER,typename FIELDBINDER,typename OPERATOR>
-        void applyToAllFieldTuple( const FIELDBINDER& fieldBinder,
-                                   OPERATOR& op )
+        /** Set the number of openMP threads as given by NTHREADS.
+         *  \return Number of threads used by subsequent parallel regions
+         */
+        inline int setNumThreads()
         {
-            // total number of elements = size of loop
-            const std::size_t numElements =
-                std::distance( fieldBinder.elementsBegin(),
-                               fieldBinder.elementsEnd() );   
-
-
             //----------------------------------------------------------------------
             // Compilation with OPENMP shall define the '_OPENMP' flag
 #ifdef _OPENMP
-
 #ifndef NTHREADS
 #error When using OPENMP you need to define the number of threads via NTHREADS
 #endif
-
             //----------------------------------------------------------------------
 #if NTHREADS==0
             // if the number of threads is set to 0 use all processors (convention)
             omp_set_num_threads( omp_get_num_procs() );
+            return omp_get_num_procs();
 #else
             // otherwise use the number as given by the compilation
             omp_set_num_threads( NTHREADS );
+            return NTHREADS;
+#endif
+#else
+            return 1;
+#endif 
+        }
+        
+        //----------------------------------------------------------------------
+        //! Check if the caller is executed within an active parallel region
+        inline bool inParallelRegion()
+        {
+#ifdef _OPENMP
+            return ( omp_in_parallel() != 0 );
+#else
+            return false;
 #endif
+        }
+        
+        //----------------------------------------------------------------------
+        //! Number of the calling thread within the current team (0 if serial)
+        inline int threadNum()
+        {
+#ifdef _OPENMP
+            return omp_get_thread_num();
+#else
+            return 0;
+#endif
+        }
+        
+        //----------------------------------------------------------------------
+        /** Outsourced function from assembly routines in order to employ openMP.
+         *  The loop is statically scheduled, such that repeated calls with the
+         *  same field binder give every thread the same chunk of elements.
+         */
+        template<typename FIELDTUPLEBINDER,typename FIELDBINDER,typename OPERATOR>
+        void applyToAllFieldTuple( const FIELDBINDER& fieldBinder,
+                                   OPERATOR& op )
+        {
+            // total number of elements = size of loop
+            const std::size_t numElements =
+                std::distance( fieldBinder.elementsBegin(),
+                               fieldBinder.elementsEnd() );   
+
+            base::auxi::setNumThreads();
+
             //----------------------------------------------------------------------
             // PRAGMA directive for a parallel for-loop
-#pragma omp parallel for
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
 #endif 
             for ( std::size_t e = 0; e < numElements; e++ ) {
                 op( FIELDTUPLEBINDER::makeTuple( fieldBinder.elementPtr( e ) ) );
             }
+            return;
+        }
+
+        //----------------------------------------------------------------------
+        /** Apply an operator to all indices of a range in parallel.
+         *  The operator has to be thread-safe for different indices.
+         *  \param[in]     num  Size of the index range [0,num)
+         *  \param[in,out] op   Operator called as op( i )
+         */
+        template<typename OPERATOR>
+        void applyToAllIndices( const std::size_t num, OPERATOR& op )
+        {
+            base::auxi::setNumThreads();
+
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif 
+            for ( std::size_t i = 0; i < num; i++ ) op( i );
 
             return;
         }
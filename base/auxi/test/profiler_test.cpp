@@ -0,0 +1,68 @@
+#include <cstdlib>
+#include <sstream>
+#include <string>
+#include <boost/test/minimal.hpp>
+
+#include <base/auxi/Profiler.hpp>
+#include <base/auxi/parallel.hpp>
+#include <base/auxi/countAllocations.hpp>
+
+//! \cond SKIPDOX
+// loop body with a region of its own
+struct Work
+{
+    void operator()( const std::size_t i ) const
+    {
+        base::auxi::Profiler::instance().enter( "inner" );
+        volatile double sum = 0.;
+        for ( std::size_t k = 0; k < 1000 * ( i + 1 ); k++ ) sum += 1.;
+        base::auxi::Profiler::instance().leave();
+    }
+};
+
+int test_main( int, char *[] )
+{
+    // no trace file from this test
+    setenv( "PROFILE_TRACE", "/dev/null", 1 );
+
+    base::auxi::Profiler& profiler = base::auxi::Profiler::instance();
+    profiler.enter( "outer" );
+    Work work;
+    base::auxi::applyToAllIndices( 64, work );
+    delete new double;
+    profiler.leave();
+
+    std::ostringstream report;
+    profiler.report( report );
+
+    // the regions of all threads are children of the master's region
+    const std::string text = report.str();
+    std::string line;
+    std::istringstream lines( text );
+    unsigned numOuter = 0, numInner = 0;
+    while ( std::getline( lines, line ) ) {
+        // name, calls, total, self, threads, allocations
+        std::istringstream fields( line );
+        std::string name;
+        unsigned long calls, threads, allocations;
+        double total, self;
+        fields >> name >> calls >> total >> self >> threads >> allocations;
+
+        // the allocations of the profiler itself are not counted
+        if ( line.compare( 0, 7, "  outer" ) == 0 ) {
+            numOuter++;
+            BOOST_CHECK( allocations == 1 );
+        }
+        if ( line.find( "inner" ) != std::string::npos ) {
+            numInner++;
+            BOOST_CHECK( line.compare( 0, 9, "    inner" ) == 0 );
+            BOOST_CHECK( calls == 64 );
+            BOOST_CHECK( allocations == 0 );
+        }
+    }
+    BOOST_CHECK( numOuter == 1 );
+    BOOST_CHECK( numInner == 1 );
+
+    return 0;
+}
+//! \endcond
@@ -0,0 +1,423 @@
+//------------------------------------------------------------------------------
+// <preamble>
+// </preamble>
+//------------------------------------------------------------------------------
+
+//! @file   base/cut/MomentFittedQuadrature.hpp
+//! @author agent
+//! @date   2026
+
+#ifndef base_cut_momentfittedquadrature_hpp
+#define base_cut_momentfittedquadrature_hpp
+
+//------------------------------------------------------------------------------
+// std includes
+#include <vector>
+#include <cmath>
+#include <algorithm>
+// eigen includes
+#include <Eigen/QR>
+// base  includes
+#include <base/shape.hpp>
+#include <base/numbers.hpp>
+#include <base/verify.hpp>
+#include <base/Quadrature.hpp>
+// base/auxi includes
+#include <base/auxi/parallel.hpp>
+// base/cut includes
+#include <base/cut/Cell.hpp>
+
+//------------------------------------------------------------------------------
+namespace base{
+    namespace cut{
+
+        template<unsigned DEGREE, base::Shape SHAPE,
+                 typename CELL=base::cut::Cell<SHAPE> >
+        class MomentFittedQuadrature;
+
+        namespace detail_{
+
+            //------------------------------------------------------------------
+            /** Legendre polynomials on the unit interval (0,1).
+             *  \param[in]  x      Evaluation coordinate
+             *  \param[in]  degree Highest polynomial degree
+             *  \param[out] values Values of \f$ P_0, \ldots, P_{degree} \f$
+             */
+            inline void shiftedLegendre( const double x, const unsigned degree,
+                                         double* values )
+            {
+                const double t = 2. * x - 1.;
+                values[0] = 1.;
+                if ( degree > 0 ) values[1] = t;
+                for ( unsigned k = 1; k < degree; k++ )
+                    values[k+1] = ( (2.*k + 1.) * t * values[k]
+                                    - k * values[k-1] ) / (k + 1.);
+            }
+
+            //------------------------------------------------------------------
+            /** Non-negative least squares after Lawson and Hanson.
+             *  Solves \f$ \min \| A x - b \| \f$ subject to \f$ x \geq 0 \f$
+             *  by an active set method. The solution has at most as many
+             *  positive entries as A has rows.
+             *  \param[in]  A         System matrix
+             *  \param[in]  b         Right hand side
+             *  \param[out] x         Solution vector
+             *  \param[in]  tolerance Threshold of the dual variables
+             *  \return               False if the iteration limit was hit
+             */
+            inline bool nonNegativeLeastSquares( const Eigen::MatrixXd& A,
+                                                 const Eigen::VectorXd& b,
+                                                 Eigen::VectorXd& x,
+                                                 const double tolerance )
+            {
+                const int numCols = static_cast<int>( A.cols() );
+                x = Eigen::VectorXd::Zero( numCols );
+
+                std::vector<bool> passive( numCols, false );
+                std::vector<int>  passiveSet;
+
+                const int maxIter = 3 * numCols;
+                for ( int iter = 0; iter < maxIter; iter++ ) {
+
+                    // dual variables
+                    const Eigen::VectorXd w = A.transpose() * ( b - A * x );
+
+                    // most promising index of the active set
+                    int jMax = -1;
+                    double wMax = tolerance;
+                    for ( int j = 0; j < numCols; j++ ) {
+                        if ( ( not passive[j] ) and ( w[j] > wMax ) ) {
+                            wMax = w[j];
+                            jMax = j;
+                        }
+                    }
+                    if ( jMax == -1 ) return true;
+
+                    passive[jMax] = true;
+                    passiveSet.push_back( jMax );
+
+                    // inner loop: unconstrained solve on the passive set
+                    while ( true ) {
+
+                        const int numP = static_cast<int>( passiveSet.size() );
+                        Eigen::MatrixXd AP( A.rows(), numP );
+                        for ( int p = 0; p < numP; p++ )
+                            AP.col( p ) = A.col( passiveSet[p] );
+                        const Eigen::VectorXd z =
+                            AP.householderQr().solve( b );
+
+                        if ( z.minCoeff() > 0. ) {
+                            for ( int p = 0; p < numP; p++ )
+                                x[ passiveSet[p] ] = z[p];
+                            break;
+                        }
+
+                        // step towards z until a component hits zero
+                        double alpha = 1.;
+                        for ( int p = 0; p < numP; p++ ) {
+                            if ( z[p] <= 0. ) {
+                                const double xp = x[ passiveSet[p] ];
+                                alpha = std::min( alpha, xp / ( xp - z[p] ) );
+                            }
+                        }
+
+                        std::vector<int> remaining;
+                        for ( int p = 0; p < numP; p++ ) {
+                            const int j = passiveSet[p];
+                            x[j] += alpha * ( z[p] - x[j] );
+                            if ( x[j] <= 0. ) {
+                                x[j] = 0.;
+                                passive[j] = false;
+                            }
+                            else remaining.push_back( j );
+                        }
+                        passiveSet.swap( remaining );
+                        if ( passiveSet.empty() ) break;
+                    }
+                }
+                return false;
+            }
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+/** Compressed quadrature rule for possibly cut elements.
+ *  The composite rule of base::cut::Quadrature evaluates the kernel at every
+ *  quadrature point of every sub-simplex of a cut element, which easily
+ *  amounts to hundreds of kernel calls for a cut hexahedron, each with the
+ *  maps of the point and the weight to the sub-simplex. This object compresses
+ *  the composite rule once per cut-cell configuration. With a polynomial basis
+ *  \f$ \phi_b \f$ of total degree DEGREE (products of Legendre polynomials on
+ *  the unit box) and the composite points \f$ \xi_q \f$, the weights solve
+ *  the moment fitting problem
+ *  \f[
+ *       \sum_{q} \phi_b(\xi_q) w_q = \int_{\Omega_e} \phi_b d\xi,
+ *       \quad w_q \geq 0
+ *  \f]
+ *  where the moments on the right hand side are computed with the composite
+ *  rule. The system is solved by non-negative least squares, whose solution
+ *  has at most as many non-zero weights as there are basis polynomials. Hence
+ *  the compressed rule has the same polynomial exactness as the composite one,
+ *  positive weights and its points are a subset of the composite points. If
+ *  the composite rule has fewer points or the compression does not reproduce
+ *  the moments, the composite rule is kept for that element. The compression
+ *  pays off for hypercube elements, whose cut cells are formed by many
+ *  simplices, and for repeated assembly passes on the same cut cells.
+ *
+ *  The points and weights of all cut elements are stored in a flat array.
+ *  They are computed for the given cut cells by the constructor; if the cells
+ *  are generated anew (e.g., for a moving interface) update() has to be
+ *  called. The interface is the one of base::cut::Quadrature.
+ *  \tparam DEGREE Polynomial degree to be integrated exactly by the rule
+ *  \tparam SHAPE  Shape of the element
+ *  \tparam CELL   Type of cell representing the cut-element structure
+ */
+template<unsigned DEGREE, base::Shape SHAPE, typename CELL>
+class base::cut::MomentFittedQuadrature
+{
+public:
+    //!@ Template parameter
+    //@{
+    static const unsigned    degree = DEGREE;
+    static const base::Shape shape  = SHAPE;
+    typedef      CELL                 Cell;
+    //@}
+
+    //! Local dimension
+    static const unsigned dim = base::ShapeDim<shape>::value;
+
+    //! Shape of a volume simplex
+    static const base::Shape simplexShape = base::SimplexShape<dim>::value;
+
+    //!@ Quadratures to be used
+    //@{
+    typedef base::Quadrature<degree,shape>        StandardQuad;
+    typedef base::Quadrature<degree,simplexShape> SimplexQuad;
+    //@}
+
+    //! for introspection
+    typedef typename base::Vector<dim>::Type VecDim;
+
+    //! Constructor with access to cut cells and flag for in/outside
+    MomentFittedQuadrature( std::vector<Cell>& cells,
+                            const bool inside = true )
+        : cells_( cells ), inside_( inside )
+    {
+        // exponents of all polynomials with a total degree up to DEGREE
+        for ( unsigned c = 0; c < base::MToTheN<degree+1,dim>::value; c++ ) {
+            unsigned exponents[dim];
+            unsigned total = 0, aux = c;
+            for ( unsigned d = 0; d < dim; d++ ) {
+                exponents[d] = aux % (degree+1);
+                aux         /= (degree+1);
+                total       += exponents[d];
+            }
+            if ( total <= degree )
+                exponents_.insert( exponents_.end(), exponents, exponents + dim );
+        }
+
+        this -> update();
+    }
+
+    //--------------------------------------------------------------------------
+    //! Compress the rules of all cut elements (in parallel)
+    void update()
+    {
+        VERIFY_MSG( not base::auxi::inParallelRegion(),
+                    "Compressed quadrature cannot be updated in parallel" );
+
+        slots_.assign( cells_.size(), base::invalidInt );
+        std::vector<std::size_t> cutElements;
+        for ( std::size_t e = 0; e < cells_.size(); e++ ) {
+            if ( cells_[e].isCut() ) {
+                slots_[e] = cutElements.size();
+                cutElements.push_back( e );
+            }
+        }
+
+        // compress every rule separately
+        std::vector<Rule_> rules( cutElements.size() );
+        Compress_ compress( *this, cutElements, rules );
+        base::auxi::applyToAllIndices( cutElements.size(), compress );
+
+        // store in flat arrays
+        offsets_.assign( 1, 0 );
+        points_.clear();
+        weights_.clear();
+        for ( std::size_t c = 0; c < rules.size(); c++ ) {
+            points_.insert(  points_.end(),
+                             rules[c].points.begin(),  rules[c].points.end() );
+            weights_.insert( weights_.end(),
+                             rules[c].weights.begin(), rules[c].weights.end() );
+            offsets_.push_back( weights_.size() );
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    //! Main function to perform integration
+    template<typename KERNEL>
+    void apply( KERNEL& kernel,
+                typename KERNEL::arg1_type& arg1,
+                typename KERNEL::arg4_type& arg4 ) const
+    {
+        // get the ID of the element
+        const std::size_t elemID = arg1.geomElementPtr() -> getID();
+
+        // For cut-elements use the compressed rule
+        if ( cells_[elemID].isCut() ) {
+
+            const std::size_t slot = slots_[elemID];
+            for ( std::size_t q = offsets_[slot]; q < offsets_[slot+1]; q++ )
+                kernel( arg1, points_[q], weights_[q], arg4 );
+
+        }
+        else if ( this -> isFull( elemID ) ) {
+
+            // apply standard quadrature
+            standardQuad_.apply( kernel, arg1, arg4 );
+        }
+
+        return;
+    }
+
+    //! Change between inside or outside integration
+    void flipInside()
+    {
+        inside_ = not inside_;
+        this -> update();
+    }
+
+    //! @name Classification of an element
+    //@{
+    //! True if the element is cut and integrated by the compressed rule
+    bool isCut( const std::size_t elemID ) const
+    {
+        return cells_[elemID].isCut();
+    }
+
+    //! True if the standard rule is applied to the element
+    bool isFull( const std::size_t elemID ) const
+    {
+        return ( ( cells_[elemID].isInside()  and     inside_ ) or
+                 ( cells_[elemID].isOutside() and not inside_ ) );
+    }
+    //@}
+
+    //! Number of polynomials to be integrated exactly
+    std::size_t numBasis() const { return exponents_.size() / dim; }
+
+    //! Total number of points of all cut elements
+    std::size_t numCutPoints() const { return weights_.size(); }
+
+private:
+    //! Points and weights of one cut element
+    struct Rule_
+    {
+        std::vector<VecDim> points;
+        std::vector<double> weights;
+    };
+
+    //--------------------------------------------------------------------------
+    //! Evaluate all basis polynomials at a point
+    void evaluateBasis_( const VecDim& xi, double* phi ) const
+    {
+        double legendre[dim][degree+1];
+        for ( unsigned d = 0; d < dim; d++ )
+            detail_::shiftedLegendre( xi[d], degree, legendre[d] );
+
+        for ( std::size_t b = 0; b < this -> numBasis(); b++ ) {
+            phi[b] = 1.;
+            for ( unsigned d = 0; d < dim; d++ )
+                phi[b] *= legendre[d][ exponents_[b*dim + d] ];
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    //! Compression of the rule of one cut element, every call writes one rule
+    class Compress_
+    {
+    public:
+        Compress_( const MomentFittedQuadrature&   mfq,
+                   const std::vector<std::size_t>& cutElements,
+                   std::vector<Rule_>&             rules )
+            : mfq_( mfq ), cutElements_( cutElements ), rules_( rules ) { }
+
+        void operator()( const std::size_t c ) const
+        {
+            const Cell& cell  = mfq_.cells_[ cutElements_[c] ];
+            const bool inside = mfq_.inside_;
+            Rule_& rule = rules_[c];
+
+            // composite rule over the simplices of the cut element
+            const std::size_t numVolSimplices =
+                ( inside ?
+                  cell.numVolumeInElements() :
+                  cell.numVolumeOutElements() );
+
+            for ( std::size_t s = 0; s < numVolSimplices; s++ ) {
+                typename SimplexQuad::Iter sIter = mfq_.simplexQuad_.begin();
+                typename SimplexQuad::Iter sEnd  = mfq_.simplexQuad_.end();
+                for ( ; sIter != sEnd; ++sIter ) {
+                    const VecDim eta = sIter -> second;
+                    rule.points.push_back(
+                        cell.mapVolumeCoordinate( eta, s, inside ) );
+                    rule.weights.push_back(
+                        (sIter -> first) * cell.volumeJacobian( eta, s, inside ) );
+                }
+            }
+
+            // nothing to gain
+            const std::size_t numB = mfq_.numBasis();
+            const std::size_t numQ = rule.weights.size();
+            if ( numQ <= numB ) return;
+
+            // basis matrix and moments
+            Eigen::MatrixXd A( numB, numQ );
+            for ( std::size_t q = 0; q < numQ; q++ )
+                mfq_.evaluateBasis_( rule.points[q], A.col( q ).data() );
+            const Eigen::VectorXd moments =
+                A * Eigen::Map<const Eigen::VectorXd>( &( rule.weights[0] ), numQ );
+
+            // compression
+            Eigen::VectorXd x;
+            const double scale = moments.norm();
+            const bool converged =
+                detail_::nonNegativeLeastSquares( A, moments, x,
+                                                  1.e-14 * scale * A.norm() );
+            if ( ( not converged ) or
+                 ( ( A * x - moments ).norm() > 1.e-10 * scale ) ) return;
+
+            Rule_ compressed;
+            for ( std::size_t q = 0; q < numQ; q++ ) {
+                if ( x[q] > 0. ) {
+                    compressed.points.push_back(  rule.points[q] );
+                    compressed.weights.push_back( x[q] );
+                }
+            }
+            rule.points.swap(  compressed.points );
+            rule.weights.swap( compressed.weights );
+        }
+
+    private:
+        const MomentFittedQuadrature&   mfq_;
+        const std::vector<std::size_t>& cutElements_;
+        std::vector<Rule_>&             rules_;
+    };
+
+private:
+    const std::vector<Cell>&  cells_;  //!< Access to cut-cell structures
+    bool                      inside_; //!< True for integration inside only
+
+    StandardQuad  standardQuad_;       //!< Quadrature for non-cut cells
+    SimplexQuad   simplexQuad_;        //!< Composite rule for cut cells
+
+    std::vector<unsigned>     exponents_; //!< Degrees per basis polynomial
+
+    std::vector<std::size_t>  slots_;   //!< Slot per element ID
+    std::vector<std::size_t>  offsets_; //!< Begin of the rule per slot
+    std::vector<VecDim>       points_;  //!< Compressed points
+    std::vector<double>       weights_; //!< Compressed weights
+};
+
+#endif
@@ -132,6 +132,22 @@ public:
     //! Change between inside or outside integration
     void flipInside() { inside_ = not inside_; }
 
+    //! @name Classification of an element
+    //@{
+    //! True if the element is cut and integrated over sub-simplices
+    bool isCut( const std::size_t elemID ) const
+    {
+        return cells_[elemID].isCut();
+    }
+
+    //! True if the standard rule is applied to the element
+    bool isFull( const std::size_t elemID ) const
+    {
+        return ( ( cells_[elemID].isInside()  and     inside_ ) or
+                 ( cells_[elemID].isOutside() and not inside_ ) );
+    }
+    //@}
+
 private:
     const std::vector<Cell>&  cells_;  //!< Access to cut-cell structures
     bool                      inside_; //!< True for integration inside only
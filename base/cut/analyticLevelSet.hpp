@@ -15,6 +15,8 @@
 #include <vector>
 // boost includes
 #include <boost/function.hpp>
+// base/auxi includes
+#include <base/auxi/Profiler.hpp>
 // base/cut includes
 #include <base/cut/LevelSet.hpp>
 
@@ -66,6 +68,7 @@ void base::cut::analyticLevelSet( const DOMAINMESH& domainMesh,
                                   std::vector< base::cut::LevelSet<DOMAINMESH::Node::dim> >&
                                   levelSet )
 {
+    PROFILE_REGION( "cut::analyticLevelSet" );
     // convenience typedef
     typedef base::cut::LevelSet<DOMAINMESH::Node::dim> LevelSet;
     
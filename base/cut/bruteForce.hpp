@@ -13,6 +13,8 @@
 //------------------------------------------------------------------------------
 // std includes
 #include <vector>
+// base/auxi includes
+#include <base/auxi/Profiler.hpp>
 // base/mesh includes
 #include <base/mesh/Size.hpp>
 // base/cut includes
@@ -69,6 +71,7 @@ void base::cut::bruteForce( const DOMAINMESH& domainMesh,
                             levelSet,
                             const double pointIdentityTolerance )
 {
+    PROFILE_REGION( "cut::bruteForce" );
     // convenience typedef
     typedef base::cut::LevelSet<DOMAINMESH::Node::dim> LevelSet;
     
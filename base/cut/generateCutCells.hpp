@@ -19,6 +19,7 @@
 // base  includes
 #include <base/linearAlgebra.hpp>
 #include <base/mesh/HierarchicOrder.hpp>
+#include <base/auxi/Profiler.hpp>
 // base/cut includes
 #include <base/cut/LevelSet.hpp>
 #include <base/cut/Cell.hpp>
@@ -118,6 +119,7 @@ void base::cut::generateCutCells(
     const base::cut::SetOperation setOp, 
     const double epsilon  )
 {
+    PROFILE_REGION( "cut::generateCutCells" );
     // number of vertices of a cell
     static const unsigned numNodes = CELL::numElementNodes;
 
@@ -21,11 +21,16 @@
 #include <base/shape.hpp>
 #include <base/geometry.hpp>
 #include <base/dof/Constraint.hpp>
+// base/auxi includes
+#include <base/auxi/parallel.hpp>
 
 //------------------------------------------------------------------------------
 namespace base{
     namespace cut{
 
+        template<typename MESH, typename FIELD>
+        class BasisStabiliser;
+
         template<typename MESH, typename FIELD>
         void stabiliseBasis( const MESH& mesh,
                              FIELD& field,
@@ -42,11 +47,41 @@ namespace base{
         namespace detail_{
 
             //------------------------------------------------------------------
-            // Collect all element IDs of every DoF
-            template<typename FIELD>
-            void collectDoFSupports(
-                const FIELD& field,
-                std::vector<std::vector<std::size_t> >& doFSupports );
+            /** IDs of the elements in the support of every DoF.
+             *  Compressed row storage: the elements of the DoF with ID i are
+             *  elements_[ offsets_[i] ], ..., elements_[ offsets_[i+1]-1 ]
+             *  in the order of the field's element container.
+             */
+            class DoFSupports
+            {
+            public:
+                //! Construct from the field's element-DoF connectivity
+                template<typename FIELD>
+                void build( const FIELD& field );
+
+                //! Number of elements in the support of a DoF
+                std::size_t size( const std::size_t doFID ) const
+                {
+                    return offsets_[ doFID+1 ] - offsets_[ doFID ];
+                }
+
+                //! ID of the s-th element in the support of a DoF
+                std::size_t operator()( const std::size_t doFID,
+                                        const std::size_t s ) const
+                {
+                    return elements_[ offsets_[ doFID ] + s ];
+                }
+
+                //! Number of DoFs
+                std::size_t numDoFs() const
+                {
+                    return ( offsets_.empty() ? 0 : offsets_.size() - 1 );
+                }
+
+            private:
+                std::vector<std::size_t> offsets_;  //!< Row pointers
+                std::vector<std::size_t> elements_; //!< Element IDs
+            };
 
             //------------------------------------------------------------------
             // return true, if all DoFs have an active status
@@ -81,7 +116,7 @@ namespace base{
                 FIELD& field,
                 const double lowerThreshold, const double upperThreshold,
                 const std::vector<double>& supportAreas,
-                const std::vector<std::vector<std::size_t> >& doFSupports,
+                const DoFSupports& doFSupports,
                 std::vector<typename FIELD::DegreeOfFreedom*>& toBeConstrained,
                 std::vector<std::bitset<FIELD::DegreeOfFreedom::size> >& components );
 
@@ -91,17 +126,24 @@ namespace base{
                 const MESH& mesh, const FIELD& field, 
                 const std::size_t doFID,
                 const typename base::GeomTraits<typename MESH::Element>::GlobalVecDim& x,
-                const std::vector< std::vector<std::size_t> >& doFSupports );
+                const DoFSupports& doFSupports );
 
             //------------------------------------------------------------------
             template<typename GEOMELEM, typename FIELDELEM>
-            void generateConstraints(
-                typename FIELDELEM::DegreeOfFreedom* doFPtr,
-                const std::bitset<FIELDELEM::DegreeOfFreedom::size>& component,
+            void extensionWeights(
                 const GEOMELEM* geomEp, const FIELDELEM* fieldEp,
                 const typename base::GeomTraits<GEOMELEM>::GlobalVecDim& x, 
                 const double tolerance,
-                const unsigned maxIter );
+                const unsigned maxIter,
+                std::vector<double>& weights );
+
+            //------------------------------------------------------------------
+            template<typename FIELDELEM>
+            void generateConstraints(
+                typename FIELDELEM::DegreeOfFreedom* doFPtr,
+                const std::bitset<FIELDELEM::DegreeOfFreedom::size>& component,
+                const FIELDELEM* fieldEp,
+                const std::vector<double>& weights );
 
             //------------------------------------------------------------------
             template<typename ELEMENT>
@@ -116,7 +158,7 @@ namespace base{
             template<typename FIELD>
             void twoRingOfDoF(
                 const FIELD& field,
-                const std::vector< std::vector<std::size_t> >& doFSupports,
+                const DoFSupports& doFSupports,
                 const std::size_t doFID,
                 std::vector<std::size_t>& twoRing );
             
@@ -163,6 +205,9 @@ namespace base{
   *  Effectively, the value of \f$ u_i \f$ is understood as an extrapolation
   *  of the FE field \f$ u_j \phi_j \f$ from a chose element to the outside
   *  location \f$ x_i \f$.
+  *  This function carries out a single, complete stabilisation with the
+  *  object base::cut::BasisStabiliser, which should be kept instead if the
+  *  stabilisation is repeated for changing support sizes.
   *  \tparam MESH  Type of mesh for geometry representation
   *  \tparam FIELD Type of FE field whose basis has to be stabilised
   *  \param[in]     mesh           Geometry representation
@@ -187,52 +232,276 @@ void base::cut::stabiliseBasis(
     const double   upperThresholdFactor,
     const double   lowerThreshold )
 {
-    // upper threshold shall be the size of one element
-    const double upperThreshold = upperThresholdFactor *
-        base::RefSize<MESH::Element::shape>::apply()
-        - (std::sqrt( std::numeric_limits<double>::epsilon() ) );
-    
-    // Pre-process: collect the support elements of every DoF
-    std::vector< std::vector<std::size_t> > doFSupports;
-    detail_::collectDoFSupports( field, doFSupports );
-
-    // 1) Categorise the DoFs
-    std::vector<typename FIELD::DegreeOfFreedom*> toBeConstrained;
-    std::vector<std::bitset<FIELD::DegreeOfFreedom::size> > components;
-    detail_::categoriseDoFs( field, lowerThreshold, upperThreshold, supportAreas,
-                             doFSupports, toBeConstrained, components );
-
-    // 2) Go through all degenerate DoFs
-    for ( std::size_t c = 0; c < toBeConstrained.size(); c++ ) {
-        
-        // ID of the DoF
-        const std::size_t doFID = toBeConstrained[c] -> getID();
+    base::cut::BasisStabiliser<MESH,FIELD>
+        stabiliser( mesh, field, doFLocation, tolerance, maxIter,
+                    upperThresholdFactor, lowerThreshold );
+    stabiliser.apply( supportAreas, false );
+    return;
+}
 
+//------------------------------------------------------------------------------
+/** Repeated stabilisation of an FE basis for changing support sizes.
+ *  The method is the one described in base::cut::stabiliseBasis. In
+ *  simulations with moving interfaces, the stabilisation is carried out in
+ *  every step for the same mesh and field, but with new support sizes. This
+ *  object therefore keeps
+ *  - the IDs of the elements in the support of every DoF (see
+ *    detail_::DoFSupports), which are constructed once from the field;
+ *  - the extension of every degenerate DoF, i.e. the ID of the supporting
+ *    element and the weights \f$ c_{ij} \f$, together with the support sizes
+ *    of the last call.
+ *
+ *  In a call to apply(), the categorisation of the DoFs is carried out anew
+ *  for all DoFs. The extensions of the degenerate DoFs, which involve the
+ *  search in the element rings and the Newton iterations for the local
+ *  coordinates, are computed in parallel. With the incremental option, the
+ *  stored extension is reused if no DoF in its neighbourhood has a changed
+ *  support size. This neighbourhood comprises all DoFs which can be reached
+ *  via numHops steps from DoF to element to DoF and covers the three-ring
+ *  search and the categorisation of the non-primary DoFs.
+ *
+ *  The constraint objects are generated serially after the computation of
+ *  the extensions. As with base::cut::stabiliseBasis, DoF components which
+ *  are already constrained are not touched. Hence, the field's constraints
+ *  are typically cleared before every call (base::dof::clearConstraints)
+ *  and other constraints, e.g. Dirichlet conditions, applied afterwards.
+ *  The incremental update assumes that these other constraints do not
+ *  change between the calls, otherwise reset() has to be called.
+ *
+ *  \tparam MESH  Type of mesh for geometry representation
+ *  \tparam FIELD Type of FE field whose basis has to be stabilised
+ */
+template<typename MESH, typename FIELD>
+class base::cut::BasisStabiliser
+{
+public:
+    //! @name Template parameter
+    //@{
+    typedef MESH  Mesh;
+    typedef FIELD Field;
+    //@}
+
+    //! @name Derived types
+    //@{
+    typedef typename Mesh::Element                          GeomElement;
+    typedef typename Field::Element                         FieldElement;
+    typedef typename Field::DegreeOfFreedom                 DegreeOfFreedom;
+    typedef typename base::GeomTraits<GeomElement>::GlobalVecDim GlobalVecDim;
+    typedef std::vector< std::pair<std::size_t,
+                                   typename GeomElement::GeomFun::VecDim> >
+    DoFLocation;
+    typedef std::bitset<DegreeOfFreedom::size>              Component;
+    //@}
+
+    //! Number of DoF-element-DoF steps defining the neighbourhood of a DoF
+    static const unsigned numHops = 4;
+
+    /** Constructor, generates the DoF supports
+     *  \param[in] mesh        Geometry representation
+     *  \param[in] field       Field to stabilise
+     *  \param[in] doFLocation Physical location of every DoF
+     *  \param[in] tolerance   Tolerance for coordinate search
+     *  \param[in] maxIter     Number of iterations for coordinate search
+     *  \param[in] upperThresholdFactor Factor times reference element-size
+     *                         for deciding the upper threshold
+     *  \param[in] lowerThreshold Support size below this value renders
+     *                         DoFs outside
+     */
+    BasisStabiliser( const Mesh& mesh, Field& field,
+                     const DoFLocation& doFLocation,
+                     const double   tolerance      = 1.e-8,
+                     const unsigned maxIter        = 10,
+                     const double   upperThresholdFactor = 1.0,
+                     const double   lowerThreshold =
+                     std::numeric_limits<double>::min() )
+        : mesh_( mesh ), field_( field ), doFLocation_( doFLocation ),
+          tolerance_( tolerance ), maxIter_( maxIter ),
+          upperThreshold_( upperThresholdFactor *
+                           base::RefSize<GeomElement::shape>::apply()
+                           - (std::sqrt( std::numeric_limits<double>::epsilon() ) ) ),
+          lowerThreshold_( lowerThreshold ),
+          numComputed_( 0 )
+    {
+        doFSupports_.build( field_ );
+    }
+
+    //--------------------------------------------------------------------------
+    /** Categorise the DoFs and generate the constraints of degenerate DoFs
+     *  \param[in] supportAreas Size of the supports
+     *  \param[in] incremental  Reuse extensions of unaffected DoFs
+     */
+    void apply( const std::vector<double>& supportAreas,
+                const bool incremental = true )
+    {
+        const std::size_t numDoFs = doFSupports_.numDoFs();
+        VERIFY_MSG( supportAreas.size() == numDoFs,
+                    "Number of support sizes does not match the field" );
+
+        // 1) Categorise the DoFs
+        std::vector<DegreeOfFreedom*> toBeConstrained;
+        std::vector<Component>        components;
+        detail_::categoriseDoFs( field_, lowerThreshold_, upperThreshold_,
+                                 supportAreas, doFSupports_,
+                                 toBeConstrained, components );
+
+        // 2) Discard the extensions affected by changed support sizes
+        if ( ( not incremental ) or ( areas_.size() != numDoFs ) )
+            this -> reset();
+        else
+            this -> discardAffected_( supportAreas );
+
+        extensions_.resize( numDoFs );
+        areas_ = supportAreas;
+
+        // 3) Compute the missing extensions in parallel
+        std::vector<std::size_t> missing;
+        for ( std::size_t c = 0; c < toBeConstrained.size(); c++ ) {
+            const std::size_t doFID = toBeConstrained[c] -> getID();
+            if ( not extensions_[ doFID ].valid ) missing.push_back( doFID );
+        }
+
+        ComputeExtension_ computeExtension( *this, missing );
+        base::auxi::applyToAllIndices( missing.size(), computeExtension );
+        numComputed_ = missing.size();
+
+        // 4) Generate the constraints serially
+        for ( std::size_t c = 0; c < toBeConstrained.size(); c++ ) {
+            const std::size_t doFID = toBeConstrained[c] -> getID();
+            const Extension_& extension = extensions_[ doFID ];
+            detail_::generateConstraints( toBeConstrained[c], components[c],
+                                          field_.elementPtr( extension.element ),
+                                          extension.weights );
+        }
+
+        return;
+    }
+
+    //--------------------------------------------------------------------------
+    //! Forget all stored extensions and support sizes
+    void reset()
+    {
+        extensions_.clear();
+        areas_.clear();
+    }
+
+    //! Number of extensions computed in the last call to apply()
+    std::size_t numComputed() const { return numComputed_; }
+
+    //! Access to the DoF supports
+    const detail_::DoFSupports& doFSupports() const { return doFSupports_; }
+
+private:
+    //! Supporting element and weights of a degenerate DoF
+    struct Extension_
+    {
+        Extension_() : valid( false ), element( 0 ) { }
+        bool                valid;   //!< Flag for a usable extension
+        std::size_t         element; //!< ID of the supporting element
+        std::vector<double> weights; //!< Shape functions at the DoF location
+    };
+
+    //--------------------------------------------------------------------------
+    //! Compute the extension of a DoF, can be called concurrently
+    void computeExtension_( const std::size_t doFID,
+                            Extension_& extension ) const
+    {
         // Location of the doF
-        const typename base::GeomTraits<typename MESH::Element>::GlobalVecDim x = 
-            base::Geometry<typename MESH::Element>()(
-                mesh.elementPtr( doFLocation[ doFID ].first ),
-                doFLocation[ doFID ].second );
+        const GlobalVecDim x = 
+            base::Geometry<GeomElement>()(
+                mesh_.elementPtr( doFLocation_[ doFID ].first ),
+                doFLocation_[ doFID ].second );
 
         // Find closest inside element which supports this DoF
         const std::size_t elementID = 
-            detail_::findSupportingElement( mesh, field, 
-                                            toBeConstrained[c] -> getID(),
-                                            x, doFSupports );
-
-        // Retrieve element pointers of mesh and field 
-        const typename  MESH::Element*  geomEp = mesh.elementPtr(  elementID );
-        const typename FIELD::Element* fieldEp = field.elementPtr( elementID );
-
-        // Generate linear constraints for the degenerate DoF
-        detail_::generateConstraints( toBeConstrained[c],
-                                      components[c],
-                                      geomEp, fieldEp, x,
-                                      tolerance, maxIter );
+            detail_::findSupportingElement( mesh_, field_, doFID,
+                                            x, doFSupports_ );
+
+        // Evaluate the element's shape functions at the DoF location
+        extension.element = elementID;
+        detail_::extensionWeights( mesh_.elementPtr(  elementID ),
+                                   field_.elementPtr( elementID ),
+                                   x, tolerance_, maxIter_, extension.weights );
+        extension.valid   = true;
+    }
+
+    //--------------------------------------------------------------------------
+    //! Parallel computation of the extensions of the given DoFs
+    class ComputeExtension_
+    {
+    public:
+        ComputeExtension_( BasisStabiliser& stabiliser,
+                           const std::vector<std::size_t>& doFIDs )
+            : stabiliser_( stabiliser ), doFIDs_( doFIDs ) { }
+
+        //! Every index refers to a different DoF and extension
+        void operator()( const std::size_t i ) const
+        {
+            const std::size_t doFID = doFIDs_[i];
+            stabiliser_.computeExtension_( doFID,
+                                           stabiliser_.extensions_[ doFID ] );
+        }
+
+    private:
+        BasisStabiliser&                stabiliser_;
+        const std::vector<std::size_t>& doFIDs_;
+    };
+
+    //--------------------------------------------------------------------------
+    //! Invalidate the extensions in the neighbourhood of changed DoFs
+    void discardAffected_( const std::vector<double>& supportAreas )
+    {
+        // start with the DoFs whose support size has changed
+        std::vector<bool> affected( supportAreas.size(), false );
+        std::vector<std::size_t> front;
+        for ( std::size_t i = 0; i < supportAreas.size(); i++ ) {
+            if ( supportAreas[i] != areas_[i] ) {
+                affected[i] = true;
+                front.push_back( i );
+            }
+        }
+
+        // walk from DoF to element to DoF
+        for ( unsigned hop = 0; hop < numHops; hop++ ) {
+            std::vector<std::size_t> next;
+            for ( std::size_t f = 0; f < front.size(); f++ ) {
+                for ( std::size_t s = 0;
+                      s < doFSupports_.size( front[f] ); s++ ) {
+                    const FieldElement* fieldEp =
+                        field_.elementPtr( doFSupports_( front[f], s ) );
+                    typename FieldElement::DoFPtrConstIter dIter =
+                        fieldEp -> doFsBegin();
+                    typename FieldElement::DoFPtrConstIter dEnd  =
+                        fieldEp -> doFsEnd();
+                    for ( ; dIter != dEnd; ++dIter ) {
+                        const std::size_t otherDoFID = (*dIter) -> getID();
+                        if ( not affected[ otherDoFID ] ) {
+                            affected[ otherDoFID ] = true;
+                            next.push_back( otherDoFID );
+                        }
+                    }
+                }
+            }
+            front.swap( next );
+        }
+
+        for ( std::size_t i = 0; i < affected.size(); i++ )
+            if ( affected[i] ) extensions_[i] = Extension_();
     }
-    
-    return;
-}
+
+private:
+    const Mesh&                   mesh_;           //!< Geometry
+    Field&                        field_;          //!< Field to stabilise
+    const DoFLocation&            doFLocation_;    //!< DoF locations
+    const double                  tolerance_;      //!< Coordinate search
+    const unsigned                maxIter_;        //!< Coordinate search
+    const double                  upperThreshold_; //!< Above: active
+    const double                  lowerThreshold_; //!< Below: outside
+
+    detail_::DoFSupports          doFSupports_;    //!< Elements of DoFs
+    std::vector<Extension_>       extensions_;     //!< Stored extensions
+    std::vector<double>           areas_;          //!< Last support sizes
+    std::size_t                   numComputed_;    //!< Statistics
+};
 
 //==============================================================================
 // IMPLEMENTATION OF METHODS IN NAMESPACE detail_
@@ -241,63 +510,48 @@ void base::cut::stabiliseBasis(
 //------------------------------------------------------------------------------
 /** Collect the IDs of all elements which are in the support of all DoFs.
  *  In order to reduce the searches in the other functions in this context, it
- *  is useful to have an a-priori knowledge of supports of every DoF. Here, in
- *  a brute-force manner, for all DoFs of the field all elements are queried if
- *  one of their DoFs is coincident with the DoF of the outer loop. Every such
- *  element is registered in an dynamic array. For every DoF of the field, this
- *  function provides such an array of element IDs.
- *  \tparam Type of the considered field
+ *  is useful to have an a-priori knowledge of supports of every DoF. Instead
+ *  of querying every element for every DoF, the element-DoF connectivity is
+ *  inverted by two passes over the elements: the first counts the elements
+ *  of every DoF and gives the offsets, the second fills in the element IDs.
+ *  The cost is linear in the number of elements.
+ *  \tparam FIELD Type of the considered field
  *  \param[in]  field       The field to consider
- *  \param[out] doFSupports Array of all arrays of element IDs in DoF support
  */
 template<typename FIELD>
-void base::cut::detail_::collectDoFSupports(
-    const FIELD& field,
-    std::vector< std::vector<std::size_t> >& doFSupports )
+void base::cut::detail_::DoFSupports::build( const FIELD& field )
 {
-    // begin and end of DoF range
-    typename FIELD::DoFPtrConstIter dIter = field.doFsBegin();
-    typename FIELD::DoFPtrConstIter dEnd  = field.doFsEnd();
-
     // size of the storage
-    const std::size_t numDoFs = std::distance( dIter, dEnd );
-    doFSupports.resize( numDoFs );
-
-    // go through all DoFs of the field
-    for ( ; dIter != dEnd; ++dIter ) {
-
-        // the array of all elements in the support of this DoF
-        std::vector<std::size_t> thisDoFsSupport;
-
-        // go through all elements of the field
-        typename FIELD::ElementPtrConstIter eIter = field.elementsBegin();
-        typename FIELD::ElementPtrConstIter eEnd  = field.elementsEnd();
-        for ( ; eIter != eEnd; ++eIter ) {
-
-            bool isInSupport = false;
-
-            // go through all DoFs of the considered element
-            typename FIELD::Element::DoFPtrConstIter dIter2 = (*eIter) -> doFsBegin();
-            typename FIELD::Element::DoFPtrConstIter dEnd2  = (*eIter) -> doFsEnd();
-            for ( ; dIter2 != dEnd2; ++dIter2 ) {
-                // Comparison of pointers to DoFs
-                if ( (*dIter) == (*dIter2) ) {
-                    isInSupport = true;
-                    break;
-                }
-            }
-
-            // register element ID if element is DoF's support
-            if ( isInSupport )
-                thisDoFsSupport.push_back( (*eIter) -> getID() );
-        }
+    const std::size_t numDoFs = std::distance( field.doFsBegin(),
+                                               field.doFsEnd() );
+    offsets_.assign( numDoFs+1, 0 );
+
+    // count the elements of every DoF
+    typename FIELD::ElementPtrConstIter eIter = field.elementsBegin();
+    typename FIELD::ElementPtrConstIter eEnd  = field.elementsEnd();
+    for ( ; eIter != eEnd; ++eIter ) {
+        typename FIELD::Element::DoFPtrConstIter dIter = (*eIter) -> doFsBegin();
+        typename FIELD::Element::DoFPtrConstIter dEnd  = (*eIter) -> doFsEnd();
+        for ( ; dIter != dEnd; ++dIter )
+            offsets_[ (*dIter) -> getID() + 1 ]++;
+    }
 
-        // store array of element IDs for considered DoF
-        doFSupports[ (*dIter) -> getID() ] = thisDoFsSupport;
+    // row pointers
+    for ( std::size_t d = 0; d < numDoFs; d++ )
+        offsets_[d+1] += offsets_[d];
+
+    // register element IDs in the order of the elements
+    elements_.resize( offsets_[ numDoFs ] );
+    std::vector<std::size_t> position( offsets_.begin(), offsets_.end()-1 );
+    for ( eIter = field.elementsBegin(); eIter != eEnd; ++eIter ) {
+        typename FIELD::Element::DoFPtrConstIter dIter = (*eIter) -> doFsBegin();
+        typename FIELD::Element::DoFPtrConstIter dEnd  = (*eIter) -> doFsEnd();
+        for ( ; dIter != dEnd; ++dIter )
+            elements_[ position[ (*dIter) -> getID() ]++ ] = (*eIter) -> getID();
     }
 
     return;
-}                                         
+}
  
 
 //------------------------------------------------------------------------------
@@ -335,7 +589,7 @@ void base::cut::detail_::categoriseDoFs(
     FIELD& field,
     const double lowerThreshold, const double upperThreshold,
     const std::vector<double>& supportAreas,
-    const std::vector<std::vector<std::size_t> >&   doFSupports, 
+    const DoFSupports&                              doFSupports, 
     std::vector<typename FIELD::DegreeOfFreedom*>&  toBeConstrained,
     std::vector<std::bitset<FIELD::DegreeOfFreedom::size> >&components )
 {
@@ -414,10 +668,9 @@ void base::cut::detail_::categoriseDoFs(
 
             // check if any element in the support has its primary DoFs active
             bool allPrimaryActive = false;
-            const std::vector<std::size_t> doFSupport = doFSupports[ doFID ];
-            for ( std::size_t s = 0; s < doFSupport.size(); s++ ) {
+            for ( std::size_t s = 0; s < doFSupports.size( doFID ); s++ ) {
                 // ID of element in support
-                const std::size_t elementID = doFSupport[s];
+                const std::size_t elementID = doFSupports( doFID, s );
                 // are all primary DoFs of this element active
                 allPrimaryActive =
                     detail_::allDoFsActive( field.elementPtr( elementID ),
@@ -496,7 +749,7 @@ std::size_t base::cut::detail_::findSupportingElement(
     const MESH& mesh, const FIELD& field, 
     const std::size_t doFID, 
     const typename base::GeomTraits<typename MESH::Element>::GlobalVecDim& x,
-    const std::vector< std::vector<std::size_t> >& doFSupports )
+    const DoFSupports& doFSupports )
 {
     std::vector<std::size_t> candidates;
     base::cut::detail_::twoRingOfDoF( field, doFSupports, doFID, candidates );
@@ -508,12 +761,11 @@ std::size_t base::cut::detail_::findSupportingElement(
         // doFs surrounding the critical DoF
         std::set<std::size_t> surrounding;
 
-        // find all elements in the support of the DoF
-        std::vector<std::size_t> elementsInSupport = doFSupports[ doFID ];
-
-        for ( std::size_t e = 0; e < elementsInSupport.size(); e++ ) {
+        // go through all elements in the support of the DoF
+        for ( std::size_t e = 0; e < doFSupports.size( doFID ); e++ ) {
             // access to element in support
-            const typename FIELD::Element* fieldEp = field.elementPtr( elementsInSupport[e] );
+            const typename FIELD::Element* fieldEp =
+                field.elementPtr( doFSupports( doFID, e ) );
             // go through all its DoFs
             typename FIELD::Element::DoFPtrConstIter dIter = fieldEp -> doFsBegin();
             typename FIELD::Element::DoFPtrConstIter dEnd  = fieldEp -> doFsEnd();
@@ -591,7 +843,7 @@ std::size_t base::cut::detail_::findSupportingElement(
 }
 
 //------------------------------------------------------------------------------
-/** Generate a linear constraint for a given degenerate DoF.
+/** Compute the weights of the linear constraint for a degenerate DoF.
  *  The constraint reads
  *  \f[
  *       u_i = \sum{j \in J(i)} c_{ij} u_j
@@ -601,30 +853,27 @@ std::size_t base::cut::detail_::findSupportingElement(
  *  findSupportingElement() . This element \f$ \tau_i \f$ has shape functions
  *  \f$ \phi_j \f$ and, moreover the DoF \f$ u_i \f$ has the location
  *  \f$ x_i \f$. At first, the local coordinate representation of \f$ x_i \f$
- *  is found, such that \f$ x_i = x( \xi_i ) \f$ and then the constraints are
+ *  is found, such that \f$ x_i = x( \xi_i ) \f$ and then the weights are
  *  \f[
  *        c_{ij} = \phi_j( \xi_i )
  *  \f]
- *  Pairs of pointers to the DoFs \f$ u_j \f$ from \f$ \tau_i \f$ and the
- *  weights \f$ c_{ij} \f$ are added to the constraint object of \f$ u_i \f$.
  *  \tparam GEOMELEM   Type of geometry element
  *  \tparam FIELDELEM  Type of field element
- *  \param[in] doFPtr    Pointer to the degenerate DoF
- *  \param[in] geomEp    Pointer to the geometry element supporting the DoF
- *  \param[in] fieldEp   Pointer to the field element supporting the DoF
- *  \param[in] x         Physical location of the degenerate DoF
- *  \param[in] tolerance Tolerance in the coordinate search
- *  \param[in] maxIter   Maximal number of iterations in the coordinate search
- *
+ *  \param[in]  geomEp    Pointer to the geometry element supporting the DoF
+ *  \param[in]  fieldEp   Pointer to the field element supporting the DoF
+ *  \param[in]  x         Physical location of the degenerate DoF
+ *  \param[in]  tolerance Tolerance in the coordinate search
+ *  \param[in]  maxIter   Maximal number of iterations in the coordinate search
+ *  \param[out] weights   The weights \f$ c_{ij} \f$ in the order of the
+ *                        field element's DoFs
  */
 template<typename GEOMELEM, typename FIELDELEM>
-void base::cut::detail_::generateConstraints(
-    typename FIELDELEM::DegreeOfFreedom* doFPtr,
-    const std::bitset<FIELDELEM::DegreeOfFreedom::size>& component,
+void base::cut::detail_::extensionWeights(
     const GEOMELEM* geomEp, const FIELDELEM* fieldEp,
     const typename base::GeomTraits<GEOMELEM>::GlobalVecDim& x, 
     const double tolerance,
-    const unsigned maxIter )
+    const unsigned maxIter,
+    std::vector<double>& weights )
 {
     // get local coordinate of DoF
     const typename GEOMELEM::GeomFun::VecDim xi =
@@ -634,13 +883,35 @@ void base::cut::detail_::generateConstraints(
     typename FIELDELEM::FEFun::FunArray phi;
     (fieldEp -> fEFun()).evaluate( fieldEp, xi, phi );
 
+    weights.assign( phi.begin(), phi.end() );
+    return;
+}
+
+//------------------------------------------------------------------------------
+/** Generate a linear constraint for a given degenerate DoF.
+ *  Pairs of pointers to the DoFs \f$ u_j \f$ from the supporting element
+ *  \f$ \tau_i \f$ and the weights \f$ c_{ij} \f$ (see extensionWeights())
+ *  are added to the constraint object of \f$ u_i \f$.
+ *  \tparam FIELDELEM  Type of field element
+ *  \param[in] doFPtr    Pointer to the degenerate DoF
+ *  \param[in] component Components of the DoF to constrain
+ *  \param[in] fieldEp   Pointer to the field element supporting the DoF
+ *  \param[in] weights   Weights of the element's DoFs
+ */
+template<typename FIELDELEM>
+void base::cut::detail_::generateConstraints(
+    typename FIELDELEM::DegreeOfFreedom* doFPtr,
+    const std::bitset<FIELDELEM::DegreeOfFreedom::size>& component,
+    const FIELDELEM* fieldEp,
+    const std::vector<double>& weights )
+{
     // go through DoFs of the field element closest to DoF
     typename FIELDELEM::DoFPtrConstIter dIter = fieldEp -> doFsBegin();
     typename FIELDELEM::DoFPtrConstIter dEnd  = fieldEp -> doFsEnd();
     for ( unsigned f = 0; dIter != dEnd; ++dIter, f++ ) {
 
         // weight of the DoF
-        const double weight = phi[f];
+        const double weight = weights[f];
 
         // go through all DoF components
         for ( unsigned d = 0; d < FIELDELEM::DegreeOfFreedom::size; d++ ) {
@@ -743,19 +1014,18 @@ base::cut::detail_::locatePointWrtElement(
 template<typename FIELD>
 void base::cut::detail_::twoRingOfDoF(
     const FIELD& field,
-    const std::vector< std::vector<std::size_t> >& doFSupports,
+    const DoFSupports& doFSupports,
     const std::size_t doFID,
     std::vector<std::size_t>& twoRing )
 {
     // construct a temporary
     std::set<std::size_t> tmp;
 
-    // find all elements in the support of the DoF
-    std::vector<std::size_t> elementsInSupport = doFSupports[ doFID ];
-
-    for ( std::size_t e = 0; e < elementsInSupport.size(); e++ ) {
+    // go through all elements in the support of the DoF
+    for ( std::size_t e = 0; e < doFSupports.size( doFID ); e++ ) {
         // access to element in support
-        const typename FIELD::Element* fieldEp = field.elementPtr( elementsInSupport[e] );
+        const typename FIELD::Element* fieldEp =
+            field.elementPtr( doFSupports( doFID, e ) );
         // go through all its DoFs
         typename FIELD::Element::DoFPtrConstIter dIter = fieldEp -> doFsBegin();
         typename FIELD::Element::DoFPtrConstIter dEnd  = fieldEp -> doFsEnd();
@@ -767,14 +1037,11 @@ void base::cut::detail_::twoRingOfDoF(
             // avoid self-check
             if ( otherDoFID != doFID ) {
 
-                // find all elements in the support of this other DoF
-                const std::vector<std::size_t> otherElementsInSupport
-                    = doFSupports[ otherDoFID ];
-                    
-                // select only inside elements
-                for ( std::size_t b = 0; b < otherElementsInSupport.size(); b++ ) {
-                    if ( detail_::allDoFsActive( field.elementPtr( otherElementsInSupport[b] )))
-                        tmp.insert( otherElementsInSupport[b] );
+                // select only inside elements in the support of this other DoF
+                for ( std::size_t b = 0; b < doFSupports.size( otherDoFID ); b++ ) {
+                    const std::size_t otherElementID = doFSupports( otherDoFID, b );
+                    if ( detail_::allDoFsActive( field.elementPtr( otherElementID ) ) )
+                        tmp.insert( otherElementID );
 
                 }
 
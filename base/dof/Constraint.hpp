@@ -67,6 +67,7 @@ public:
                 const base::number rhs )
         : rhs_( rhs )
     {
+        DegreeOfFreedom::structureChanged();
         weightedDoFs_.push_back( boost::make_tuple( doF, dir, weight ) );
     }
     //@}
@@ -79,6 +80,7 @@ public:
     {
         ASSERT_MSG( doF -> isActive( dir ),
                     "DoF with ID " + x2s(doF->getID()) + " not active ");
+        DegreeOfFreedom::structureChanged();
         weightedDoFs_.push_back( boost::make_tuple( doF, dir, weight ) );
     }
 
@@ -106,6 +108,15 @@ public:
     //! Get just the rhs value
     base::number getValue() const { return rhs_; }
 
+    //! Number of weighted dofs contributing to this constraint
+    std::size_t numWeightedDoFs() const { return weightedDoFs_.size(); }
+
+    //! Access to a weighted dof (pointer, direction, weight)
+    const WeightedDoF& getWeightedDoF( const std::size_t w ) const
+    {
+        return weightedDoFs_[w];
+    }
+
     //! Copy the IDs of the weighted dofs
     void getWeightedDoFIDs( std::vector< std::pair<base::number,std::size_t> >&
                             weightedDoFIDs ) const
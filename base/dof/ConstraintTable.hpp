@@ -0,0 +1,401 @@
+//------------------------------------------------------------------------------
+// <preamble>
+// </preamble>
+//------------------------------------------------------------------------------
+
+//! @file   ConstraintTable.hpp
+//! @author agent
+//! @date   2026
+
+#ifndef base_dof_constrainttable_hpp
+#define base_dof_constrainttable_hpp
+
+//------------------------------------------------------------------------------
+// std includes
+#include <vector>
+#include <iterator>
+// boost includes
+#include <boost/utility.hpp>
+// base includes
+#include <base/numbers.hpp>
+#include <base/verify.hpp>
+// base/auxi includes
+#include <base/auxi/parallel.hpp>
+
+//------------------------------------------------------------------------------
+namespace base{
+    namespace dof{
+
+        template<typename DOF>
+        class ConstraintTable;
+
+        template<typename ELEMENT>
+        class Field;
+
+        //----------------------------------------------------------------------
+        //! Convenience function: build the constraint table of a field
+        template<typename FIELD>
+        void buildConstraintTable( const FIELD& field )
+        {
+            base::dof::ConstraintTable<typename FIELD::DegreeOfFreedom>::
+                create( field ).build( field );
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+/** Flat storage of all linear constraints of a field.
+ *  Every constrained DoF component \f$ u_i \f$ carries a constraint
+ *  \f[
+ *       u_i = g_i + \sum_{j \in C(i)} c_{ij} u_j
+ *  \f]
+ *  which is stored by base::dof::Constraint as a list of tuples behind a
+ *  pointer of the DoF. The assembly needs the global indices of the
+ *  \f$ u_j \f$ and the weights \f$ c_{ij} \f$ of every constrained DoF of
+ *  every element, and the distribution of the solution evaluates the
+ *  constraints. In case of many constraints (e.g., from the basis
+ *  stabilisation of cut-cell methods or periodic boundary conditions) it pays
+ *  off to collect them once in a compressed row storage: for every
+ *  constrained DoF component, there is a row with the global indices, the
+ *  weights and the pointers to the master DoFs, and an entry of the
+ *  inhomogeneity \f$ g_i \f$.
+ *
+ *  The table is built by build() after the constraints have been generated
+ *  and the DoFs have been numbered. Then base::asmb::collectFromDoFs and
+ *  base::dof::Distribute (via setDoFsFromSolver etc.) take the data from
+ *  here instead of the constraint objects; the latter evaluates all rows in
+ *  parallel. The values \f$ g_i \f$ are always read from the constraint
+ *  objects. If the numbering or the constraint equations change, the table
+ *  has to be rebuilt (base::dof::clearConstraints removes it). For this
+ *  purpose, it keeps the structure revision of the DoFs (see
+ *  base::dof::DegreeOfFreedom::structureRevision) at which it was built.
+ *  After a change of the revision, check() compares the table with the DoFs
+ *  and fails if it is outdated. Since the revision is shared by all DoFs of
+ *  this type, this check is done outside of parallel regions, e.g. when
+ *  the pattern of a solver is registered.
+ *
+ *  Every field has its own table, which is created by create() and removed
+ *  by release(). The latter is called by the destructor of the field and
+ *  when DoFs are added to it, such that no table refers to DoFs which do
+ *  not exist anymore. Since the assembly only sees the DoFs, lookUp()
+ *  searches all tables of this DoF type; within a table, the DoFs are
+ *  identified by their IDs and the address is kept in order to reject a DoF
+ *  of another field. DoFs without a table entry take their constraints from
+ *  the constraint objects. Modifications are not allowed in parallel
+ *  regions.
+ *  \tparam DOF Type of degree of freedom
+ */
+template<typename DOF>
+class base::dof::ConstraintTable
+    : public boost::noncopyable
+{
+public:
+    //! Template parameter: type of DoF
+    typedef DOF DegreeOfFreedom;
+
+    //! Number of components per DoF
+    static const unsigned doFSize = DegreeOfFreedom::size;
+
+    //--------------------------------------------------------------------------
+    //! Table of a field, created if not existing
+    template<typename ELEMENT>
+    static ConstraintTable& create( const base::dof::Field<ELEMENT>& field )
+    {
+        VERIFY_MSG( not base::auxi::inParallelRegion(),
+                    "Constraint table cannot be created in parallel" );
+        ConstraintTable* table = get( field );
+        if ( table != NULL ) return *table;
+
+        table = new ConstraintTable( &field );
+        registry_().tables.push_back( table );
+        return *table;
+    }
+
+    //! Table of a field or NULL if there is none
+    template<typename ELEMENT>
+    static ConstraintTable* get( const base::dof::Field<ELEMENT>& field )
+    {
+        const std::vector<ConstraintTable*>& tables = registry_().tables;
+        for ( std::size_t t = 0; t < tables.size(); t++ )
+            if ( tables[t] -> field_ == &field ) return tables[t];
+        return NULL;
+    }
+
+    //! Remove the table of a field, if any
+    template<typename ELEMENT>
+    static void release( const base::dof::Field<ELEMENT>& field )
+    {
+        VERIFY_MSG( not base::auxi::inParallelRegion(),
+                    "Constraint table cannot be removed in parallel" );
+        std::vector<ConstraintTable*>& tables = registry_().tables;
+        for ( std::size_t t = 0; t < tables.size(); t++ ) {
+            if ( tables[t] -> field_ == &field ) {
+                delete tables[t];
+                tables.erase( tables.begin() + t );
+                return;
+            }
+        }
+    }
+
+    //! True if any field of this DoF type has a table
+    static bool anyActive()
+    {
+        const std::vector<ConstraintTable*>& tables = registry_().tables;
+        for ( std::size_t t = 0; t < tables.size(); t++ )
+            if ( tables[t] -> isActive() ) return true;
+        return false;
+    }
+
+    //! Find the table and the row of a DoF component, NULL if not stored
+    static const ConstraintTable* lookUp( const DegreeOfFreedom* doF,
+                                          const unsigned d,
+                                          std::size_t& row )
+    {
+        const std::vector<ConstraintTable*>& tables = registry_().tables;
+        for ( std::size_t t = 0; t < tables.size(); t++ ) {
+            row = tables[t] -> find( doF, d );
+            if ( row != base::invalidInt ) {
+                if ( not tables[t] -> isCurrent_() ) tables[t] -> check();
+                return tables[t];
+            }
+        }
+        return NULL;
+    }
+
+    //--------------------------------------------------------------------------
+    //! Collect the constraints of all DoFs of the field
+    template<typename ELEMENT>
+    void build( const base::dof::Field<ELEMENT>& field )
+    {
+        VERIFY_MSG( not base::auxi::inParallelRegion(),
+                    "Constraint table cannot be built in parallel" );
+        VERIFY_MSG( field_ == &field,
+                    "Constraint table belongs to another field" );
+        this -> clear();
+
+        const std::size_t numDoFs = std::distance( field.doFsBegin(),
+                                                   field.doFsEnd() );
+        doFs_.assign(  numDoFs, NULL );
+        rowOf_.assign( numDoFs * doFSize, base::invalidInt );
+        offsets_.push_back( 0 );
+
+        typedef typename base::dof::Field<ELEMENT>::DoFPtrConstIter DoFIter;
+        DoFIter dIter = field.doFsBegin();
+        DoFIter dEnd  = field.doFsEnd();
+        for ( ; dIter != dEnd; ++dIter ) {
+
+            DegreeOfFreedom* doF = *dIter;
+            const std::size_t doFID = doF -> getID();
+            doFs_[ doFID ] = doF;
+
+            for ( unsigned d = 0; d < doFSize; d++ ) {
+                if ( not doF -> isConstrained( d ) ) continue;
+
+                const typename DegreeOfFreedom::Constraint* constraint =
+                    doF -> getConstraint( d );
+
+                rowOf_[ doFID * doFSize + d ] = slaves_.size();
+                slaves_.push_back(    doF );
+                slaveDirs_.push_back( d );
+
+                for ( std::size_t w = 0; w < constraint -> numWeightedDoFs(); w++ ) {
+                    DegreeOfFreedom* master =
+                        constraint -> getWeightedDoF( w ).template get<0>();
+                    const unsigned dir =
+                        constraint -> getWeightedDoF( w ).template get<1>();
+
+                    masters_.push_back(    master );
+                    masterDirs_.push_back( dir );
+                    indices_.push_back(    master -> getIndex( dir ) );
+                    weights_.push_back(
+                        constraint -> getWeightedDoF( w ).template get<2>() );
+                }
+                offsets_.push_back( masters_.size() );
+            }
+        }
+
+        revision_ = DegreeOfFreedom::structureRevision();
+    }
+
+    //--------------------------------------------------------------------------
+    /** Make sure that the table agrees with the numbering and constraints.
+     *  Only after a change of the structure revision of the DoFs, all rows
+     *  are compared with the DoFs. Fails if the table is outdated.
+     */
+    void check()
+    {
+        if ( this -> isCurrent_() ) return;
+        VERIFY_MSG( not base::auxi::inParallelRegion(),
+                    "Constraint table has to be checked or rebuilt before "
+                    "entering a parallel region" );
+        VERIFY_MSG( this -> isCurrent(),
+                    "Constraint table is outdated: rebuild it after changing "
+                    "the numbering or the constraints" );
+        revision_ = DegreeOfFreedom::structureRevision();
+    }
+
+    //! True if the table agrees with the numbering and the constraints
+    bool isCurrent() const
+    {
+        return ( this -> isCurrent_() or this -> agrees_() );
+    }
+
+    //! Remove all data
+    void clear()
+    {
+        doFs_.clear();       rowOf_.clear();
+        offsets_.clear();    masters_.clear();  masterDirs_.clear();
+        indices_.clear();    weights_.clear();
+        slaves_.clear();     slaveDirs_.clear();
+    }
+
+    //! True if a table has been built
+    bool isActive() const { return not doFs_.empty(); }
+
+    //--------------------------------------------------------------------------
+    //! Row of a DoF component or base::invalidInt if not in the table
+    std::size_t find( const DegreeOfFreedom* doF, const unsigned d ) const
+    {
+        const std::size_t doFID = doF -> getID();
+        if ( ( doFID >= doFs_.size() ) or ( doFs_[ doFID ] != doF ) )
+            return base::invalidInt;
+        return rowOf_[ doFID * doFSize + d ];
+    }
+
+    //! @name Access to a row
+    //@{
+    std::size_t numConstraints() const { return slaves_.size(); }
+
+    std::size_t numMasters( const std::size_t row ) const
+    {
+        return offsets_[ row+1 ] - offsets_[ row ];
+    }
+
+    const number*      weights( const std::size_t row ) const
+    {
+        return ( weights_.empty() ? NULL : &( weights_[0] ) + offsets_[ row ] );
+    }
+
+    const std::size_t* indices( const std::size_t row ) const
+    {
+        return ( indices_.empty() ? NULL : &( indices_[0] ) + offsets_[ row ] );
+    }
+
+    number rhs( const std::size_t row ) const
+    {
+        return slaves_[ row ] -> getConstraint( slaveDirs_[ row ] ) -> getValue();
+    }
+    //@}
+
+    //--------------------------------------------------------------------------
+    //! Evaluate the constraint equation of a row with the current DoF values
+    number evaluate( const std::size_t row, const bool useRhsTerm = true ) const
+    {
+        number result = ( useRhsTerm ? this -> rhs( row ) : 0. );
+        for ( std::size_t m = offsets_[ row ]; m < offsets_[ row+1 ]; m++ )
+            result += weights_[m] * masters_[m] -> getValue( masterDirs_[m] );
+        return result;
+    }
+
+    //! Set the values of all constrained DoF components, in parallel
+    void distribute()
+    {
+        this -> check();
+        Distribute_ op( *this );
+        base::auxi::applyToAllIndices( slaves_.size(), op );
+    }
+
+private:
+    //! Only created by create()
+    ConstraintTable( const void* field ) : field_( field ), revision_( 0 ) { }
+
+    //! True if the DoFs have not been changed since the last build or check
+    bool isCurrent_() const
+    {
+        return ( revision_ == DegreeOfFreedom::structureRevision() );
+    }
+
+    //! Compare all rows with the DoFs and their constraints
+    bool agrees_() const
+    {
+        // every DoF at its ID, every constrained component in the table
+        for ( std::size_t i = 0; i < doFs_.size(); i++ ) {
+            if ( doFs_[i] == NULL ) continue;
+            if ( doFs_[i] -> getID() != i ) return false;
+            for ( unsigned d = 0; d < doFSize; d++ )
+                if ( doFs_[i] -> isConstrained( d ) !=
+                     ( rowOf_[ i * doFSize + d ] != base::invalidInt ) ) return false;
+        }
+
+        // every row with the same masters, weights and indices
+        for ( std::size_t r = 0; r < slaves_.size(); r++ ) {
+            const typename DegreeOfFreedom::Constraint* constraint =
+                slaves_[r] -> getConstraint( slaveDirs_[r] );
+            if ( constraint -> numWeightedDoFs() != this -> numMasters( r ) )
+                return false;
+            for ( std::size_t w = 0; w < constraint -> numWeightedDoFs(); w++ ) {
+                const std::size_t m = offsets_[r] + w;
+                const typename DegreeOfFreedom::Constraint::WeightedDoF& wd =
+                    constraint -> getWeightedDoF( w );
+                if ( ( wd.template get<0>() != masters_[m]    ) or
+                     ( wd.template get<1>() != masterDirs_[m] ) or
+                     ( wd.template get<2>() != weights_[m]    ) or
+                     ( masters_[m] -> getIndex( masterDirs_[m] ) != indices_[m] ) )
+                    return false;
+            }
+        }
+        return true;
+    }
+
+    //! Owner of all tables of this DoF type
+    struct Registry_
+    {
+        ~Registry_()
+        {
+            for ( std::size_t t = 0; t < tables.size(); t++ ) delete tables[t];
+        }
+
+        std::vector<ConstraintTable*> tables;
+    };
+
+    static Registry_& registry_()
+    {
+        static Registry_ registry;
+        return registry;
+    }
+
+    //! Evaluation of one row, every row refers to a different DoF component
+    class Distribute_
+    {
+    public:
+        Distribute_( const ConstraintTable& table ) : table_( table ) { }
+
+        void operator()( const std::size_t row ) const
+        {
+            table_.slaves_[ row ] -> setValue( table_.slaveDirs_[ row ],
+                                               table_.evaluate( row ) );
+        }
+
+    private:
+        const ConstraintTable& table_;
+    };
+
+private:
+    const void*                         field_;      //!< Field of the table
+
+    std::vector<const DegreeOfFreedom*> doFs_;       //!< Owner check per DoF ID
+    std::vector<std::size_t>            rowOf_;      //!< Row per DoF component
+
+    std::vector<std::size_t>            offsets_;    //!< Row pointers
+    std::vector<DegreeOfFreedom*>       masters_;    //!< Master DoFs
+    std::vector<unsigned>               masterDirs_; //!< Master components
+    std::vector<std::size_t>            indices_;    //!< Global master indices
+    std::vector<number>                 weights_;    //!< Weights c_ij
+
+    std::vector<DegreeOfFreedom*>       slaves_;     //!< Constrained DoF per row
+    std::vector<unsigned>               slaveDirs_;  //!< Constrained component
+
+    unsigned long                       revision_;   //!< DoF structure revision
+};
+
+#endif
@@ -113,7 +113,11 @@ public:
     //--------------------------------------------------------------------------
     //! @name ID methods
     //@{
-    void setID( const std::size_t id ) { id_ = id; }
+    void setID( const std::size_t id )
+    {
+        if ( id != id_ ) structureChanged();
+        id_ = id;
+    }
     std::size_t getID() const { return id_; }
     //@}
 
@@ -123,11 +127,12 @@ public:
     template<typename INPITER>
     void setIndices( INPITER iter )
     {
-        for ( unsigned d = 0; d < size; d ++ ) indices_[d] = *iter++;
+        for ( unsigned d = 0; d < size; d ++ ) this -> setIndex( d, *iter++ );
     }
 
     void setIndex( const unsigned which, const std::size_t value )
     {
+        if ( value != indices_[ which ] ) structureChanged();
         indices_[ which ] = value;
     }
     //@}
@@ -182,6 +187,19 @@ public:
         values_[H][which] = value;
     }
 
+    //! Run-time access to a history layer (e.g. for checkpointing)
+    number getHistoryValue( const unsigned h, const unsigned which ) const
+    {
+        return values_[h][which];
+    }
+
+    //! Run-time mutation of a history layer (e.g. for restart)
+    void setHistoryValue( const unsigned h, const unsigned which,
+                          const number value )
+    {
+        values_[h][which] = value;
+    }
+
     void pushHistory()
     {
         for ( unsigned h = nHist; h > 0; h-- )
@@ -209,6 +227,11 @@ public:
         std::copy( status_.begin(), status_.end(), iter );
     }
 
+    DoFStatus getStatus( const unsigned which ) const
+    {
+        return status_[ which ];
+    }
+
     bool isActive( const unsigned which ) const
     {
         return ( status_[ which ] == ACTIVE );
@@ -219,11 +242,20 @@ public:
         return ( status_[ which ] == CONSTRAINED );
     }
 
-    void activateAll()   { status_.assign( ACTIVE );   }
-    void deactivateAll() { status_.assign( INACTIVE ); }
+    void activateAll()   { structureChanged(); status_.assign( ACTIVE );   }
+    void deactivateAll() { structureChanged(); status_.assign( INACTIVE ); }
+
+    void activate(   const unsigned which )
+    {
+        structureChanged();
+        status_[which] = ACTIVE;
+    }
 
-    void activate(   const unsigned which ) { status_[which] = ACTIVE; }
-    void deactivate( const unsigned which ) { status_[which] = INACTIVE; }
+    void deactivate( const unsigned which )
+    {
+        structureChanged();
+        status_[which] = INACTIVE;
+    }
     //@}
 
     //--------------------------------------------------------------------------
@@ -233,6 +265,7 @@ public:
     {
         // if dof had been active, inactivate and create a constraint
         if ( status_[which] == ACTIVE ) {
+            structureChanged();
             status_[which] = CONSTRAINED;
             constraints_[ which ] = new Constraint( value );
         }
@@ -271,6 +304,7 @@ public:
     //! Destroy the constraints
     void clearConstraints()
     {
+        structureChanged();
         for ( unsigned s = 0; s < constraints_.size(); s++ ) {
             delete constraints_[s];
             constraints_[s] = NULL;
@@ -283,6 +317,7 @@ public:
     void makeConstraint( const unsigned which )
     {
         if ( not (status_[which] == CONSTRAINED) ) {
+            structureChanged();
             status_[      which ] = CONSTRAINED;
             constraints_[ which ] = new Constraint();
         }
@@ -294,6 +329,12 @@ public:
         return constraints_[which];
     }
 
+    //! Return specific constraint object (read-only)
+    const Constraint* getConstraint( const unsigned which ) const
+    {
+        return constraints_[which];
+    }
+
     //! Multiply constraint RHS by a scalar
     void scaleConstraint( const double factor )
     {
@@ -307,8 +348,33 @@ public:
     
     //@}
 
+    //--------------------------------------------------------------------------
+    /** @name Revision of the structure of all DoFs of this type.
+     *  Counts the changes of IDs, indices, status and constraint equations
+     *  (not of their values), such that derived data like a
+     *  base::dof::ConstraintTable can detect that it is outdated. These
+     *  modifications are not meant for parallel regions.
+     */
+    //@{
+    static unsigned long structureRevision() { return revision_(); }
+
+    static void structureChanged()
+    {
+        unsigned long& revision = revision_();
+#ifdef _OPENMP
+#pragma omp atomic
+#endif
+        revision++;
+    }
+    //@}
     
 private:
+    static unsigned long& revision_()
+    {
+        static unsigned long revision = 0;
+        return revision;
+    }
+
     std::size_t    id_;       //!< ID for convenience
     
     IndexArray     indices_;  //!< Storage of the dof indices
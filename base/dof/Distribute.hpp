@@ -15,6 +15,8 @@
 #include <vector>
 // base includes
 #include <base/numbers.hpp>
+// base/dof includes
+#include <base/dof/ConstraintTable.hpp>
 
 //------------------------------------------------------------------------------
 namespace base{
@@ -37,7 +39,7 @@ namespace base{
         {
             base::dof::Distribute<typename FIELD::DegreeOfFreedom,
                                   SOLVER,SET> distributeDoF( solver );
-            distributeDoF.apply( field.doFsBegin(), field.doFsEnd() );
+            distributeDoF.apply( field );
         }
 
         //----------------------------------------------------------------------
@@ -47,7 +49,7 @@ namespace base{
         {
             base::dof::Distribute<typename FIELD::DegreeOfFreedom,SOLVER,ADD>
                 distributeDoF( solver );
-            distributeDoF.apply( field.doFsBegin(), field.doFsEnd() );
+            distributeDoF.apply( field );
         }
 
         //----------------------------------------------------------------------
@@ -81,12 +83,16 @@ namespace base{
         }
 
         //----------------------------------------------------------------------
+        //! Remove all constraints of a field, including the constraint table
         template<typename FIELD>
         void clearConstraints( FIELD& field )
         {
             typename FIELD::DoFPtrIter dIter = field.doFsBegin();
             typename FIELD::DoFPtrIter dEnd  = field.doFsEnd();
             for ( ; dIter != dEnd; ++dIter ) (*dIter) -> clearConstraints();
+
+            base::dof::ConstraintTable<typename FIELD::DegreeOfFreedom>::
+                release( field );
         }
         
         //----------------------------------------------------------------------
@@ -131,6 +137,9 @@ namespace base{
  *       dof, in case of e.g. non-linear iterations, or fully) and apply that
  *       value to the dof-component (set, not add!)
  *
+ *  If the DoFs of a field are given and a base::dof::ConstraintTable has
+ *  been built for it, the second step evaluates the constraints from its
+ *  flat storage in parallel.
  *
  *  \tparam DOF   Type of degree of freedom
  *  \tparam SRC   Source of values (normally the solver)
@@ -163,53 +172,60 @@ public:
     template<typename DOFITER>
     void apply( DOFITER first, DOFITER last )
     {
-        // go through all dofs in order to collect solution values
+        this -> applyToActive_( first, last );
+        this -> evaluateConstraints_( first, last );
+    }
+
+    //! Same for all DoFs of a field, using its constraint table if built
+    template<typename FIELD>
+    void apply( FIELD& field )
+    {
+        this -> applyToActive_( field.doFsBegin(), field.doFsEnd() );
+
+        base::dof::ConstraintTable<DegreeOfFreedom>* table =
+            base::dof::ConstraintTable<DegreeOfFreedom>::get( field );
+        if ( ( table != NULL ) and ( table -> isActive() ) )
+            table -> distribute();
+        else
+            this -> evaluateConstraints_( field.doFsBegin(), field.doFsEnd() );
+    }
+    
+private:
+    //! Pass the values from the source to all active DoF components
+    template<typename DOFITER>
+    void applyToActive_( DOFITER first, DOFITER last )
+    {
         for ( DOFITER iter = first; iter != last; ++iter ) {
 
             DegreeOfFreedom* dof = *iter;
-            
-            // Collect dof IDs
-            std::vector<unsigned> dofIDs( dofSize );
-            dof -> getIndices( dofIDs.begin() );
 
-            // Go through all components
+            // only query solution for active dofs
             for ( unsigned d = 0; d < dofSize; d ++ ) {
-
-                // only query solution for active dofs
                 if ( dof -> isActive(d) ) {
-                
                     dof -> setValue( d,
                                      DoFOp::apply( dof -> getValue( d ), 
-                                                   sourceOfValues_.getValue( dofIDs[d] ) ) );
+                                                   sourceOfValues_.getValue( dof -> getIndex( d ) ) ) );
                 }
-                
             }
-            
         }
+    }
 
-        // go through all dofs in order to evaluate constraints
+    //! Evaluate the constraint objects of all constrained DoF components
+    template<typename DOFITER>
+    void evaluateConstraints_( DOFITER first, DOFITER last )
+    {
         for ( DOFITER iter = first; iter != last; ++iter ) {
 
             DegreeOfFreedom* dof = *iter;
 
             for ( unsigned d = 0; d < dofSize; d++ ) {
-
-                // only evaluate constraints at inactive dofs
-                if ( dof -> isConstrained(d) ) {
-
-                    // evaluate the constraint of this dof-component
-                    const base::number constraintValue =
-                        dof -> getConstraint( d ) -> evaluate( );
-
-                    // apply to dof
-                    dof -> setValue( d, constraintValue );
-                }
+                if ( dof -> isConstrained(d) )
+                    dof -> setValue( d, dof -> getConstraint( d ) -> evaluate( ) );
             }
-            
         }
     }
-    
-private:
+
+
     //! Access to source of values (usually the solver object)
     const SourceOfValues & sourceOfValues_;
 };
@@ -20,6 +20,7 @@
 #include <base/fe/Field.hpp>
 // base/dof includes
 #include <base/dof/Element.hpp>
+#include <base/dof/ConstraintTable.hpp>
 
 //------------------------------------------------------------------------------
 namespace base{
@@ -47,6 +48,12 @@ public:
 
     //! Basis type as container
     typedef typename base::fe::Field<Element,DegreeOfFreedom> Container;
+
+    //! Destructor removes the constraint table of this field
+    ~Field()
+    {
+        base::dof::ConstraintTable<DegreeOfFreedom>::release( *this );
+    }
     
     //! @name Container and iterator definitions
     //@{
@@ -74,6 +81,8 @@ public:
     //@{
     void addDoFs( const std::size_t numNewDofs )
     {
+        // a constraint table does not know the new DoFs
+        base::dof::ConstraintTable<DegreeOfFreedom>::release( *this );
         Container::addCoefficients_( numNewDofs );
     }
 
@@ -13,6 +13,7 @@
 //------------------------------------------------------------------------------
 // std includes
 #include <iterator>
+#include <vector>
 // base includes
 #include <base/types.hpp>
 
@@ -23,6 +24,10 @@ namespace base{
         template<typename DOFITER>
         std::size_t numberDoFsConsecutively( DOFITER first, DOFITER last,
                                              std::size_t init = 0 );
+
+        template<typename FIELD>
+        std::size_t numberDoFsInteriorLast( FIELD& field,
+                                            std::vector<std::size_t>& interior );
         
         /** Possible:
          *  - one number per vector dof (pressure correction methods)
@@ -68,4 +73,70 @@ std::size_t base::dof::numberDoFsConsecutively( DOFITER first, DOFITER last,
 }
 
 
+//------------------------------------------------------------------------------
+/** Number the DoFs such that element-interior components come last.
+ *  A DoF is element-interior if it is referenced by a single element of the
+ *  field, e.g. the cell bubbles of higher-order Lagrange elements. First, all
+ *  other active components are numbered consecutively from zero to
+ *  \f$ N-1 \f$, then the active components of the interior DoFs are numbered
+ *  element by element starting from \f$ N \f$. The element (by its position
+ *  in the field) of every interior index \f$ N+k \f$ is stored in
+ *  interior[k]. This numbering is the basis for the static condensation of
+ *  the interior components, see base::solver::StaticCondensation.
+ *  \param[in,out] field     Field whose DoFs are numbered
+ *  \param[out]    interior  Element number of every interior index
+ *  \return                  Number \f$ N \f$ of non-interior components
+ */
+template<typename FIELD>
+std::size_t base::dof::numberDoFsInteriorLast( FIELD& field,
+                                               std::vector<std::size_t>& interior )
+{
+    typedef typename FIELD::DegreeOfFreedom DoF;
+    static const unsigned size = DoF::size;
+
+    // count the element references of every DoF
+    const std::size_t numDoFs =
+        static_cast<std::size_t>( std::distance( field.doFsBegin(),
+                                                 field.doFsEnd() ) );
+    std::vector<unsigned> numRefs( numDoFs, 0 );
+    
+    typename FIELD::ElementPtrIter eIter = field.elementsBegin();
+    typename FIELD::ElementPtrIter eEnd  = field.elementsEnd();
+    for ( ; eIter != eEnd; ++eIter ) {
+        typename FIELD::Element::DoFPtrIter dIter = (*eIter) -> doFsBegin();
+        typename FIELD::Element::DoFPtrIter dEnd  = (*eIter) -> doFsEnd();
+        for ( ; dIter != dEnd; ++dIter ) numRefs[ (*dIter) -> getID() ]++;
+    }
+
+    // number all DoFs which are shared or not used by any element
+    std::size_t counter = 0;
+    typename FIELD::DoFPtrIter dIter = field.doFsBegin();
+    typename FIELD::DoFPtrIter dEnd  = field.doFsEnd();
+    for ( ; dIter != dEnd; ++dIter ) {
+        if ( numRefs[ (*dIter) -> getID() ] == 1 ) continue;
+        for ( unsigned d = 0; d < size; d ++ )
+            if ( (*dIter) -> isActive( d ) ) (*dIter) -> setIndex( d, counter++ );
+    }
+    const std::size_t numNonInterior = counter;
+
+    // number the interior DoFs element by element
+    interior.clear();
+    eIter = field.elementsBegin();
+    for ( std::size_t e = 0; eIter != eEnd; ++eIter, e++ ) {
+        typename FIELD::Element::DoFPtrIter dIter2 = (*eIter) -> doFsBegin();
+        typename FIELD::Element::DoFPtrIter dEnd2  = (*eIter) -> doFsEnd();
+        for ( ; dIter2 != dEnd2; ++dIter2 ) {
+            if ( numRefs[ (*dIter2) -> getID() ] != 1 ) continue;
+            for ( unsigned d = 0; d < size; d ++ ) {
+                if ( (*dIter2) -> isActive( d ) ) {
+                    (*dIter2) -> setIndex( d, counter++ );
+                    interior.push_back( e );
+                }
+            }
+        }
+    }
+
+    return numNonInterior;
+}
+
 #endif
@@ -0,0 +1,197 @@
+#include <sstream>
+#include <vector>
+#include <cmath>
+#include <boost/test/minimal.hpp>
+#include <boost/bind.hpp>
+
+#include <tools/meshGeneration/unitCube/unitCube.hpp>
+#include <base/Unstructured.hpp>
+#include <base/mesh/MeshBoundary.hpp>
+#include <base/io/smf/Reader.hpp>
+#include <base/Quadrature.hpp>
+#include <base/fe/Basis.hpp>
+#include <base/Field.hpp>
+#include <base/dof/numbering.hpp>
+#include <base/dof/generate.hpp>
+#include <base/dof/Distribute.hpp>
+#include <base/dof/constrainBoundary.hpp>
+#include <base/dof/ConstraintTable.hpp>
+#include <base/asmb/FieldBinder.hpp>
+#include <base/asmb/StiffnessMatrix.hpp>
+#include <base/asmb/BodyForce.hpp>
+#include <base/solver/Eigen3.hpp>
+
+#include <heat/Laplace.hpp>
+
+//! \cond SKIPDOX
+// Two Laplace problems of the same DoF type with boundary values and a
+// linear constraint between interior DoFs
+typedef base::Unstructured<base::QUAD,1>       Mesh;
+typedef base::Quadrature<3,base::QUAD>         Quadrature;
+typedef base::fe::Basis<base::QUAD,1>          FEBasis;
+typedef base::Field<FEBasis,1>                 Field;
+typedef Field::DegreeOfFreedom                 DoF;
+typedef base::dof::ConstraintTable<DoF>        ConstraintTable;
+typedef base::asmb::FieldBinder<Mesh,Field>    FieldBinder;
+typedef FieldBinder::TupleBinder<1,1>::Type    FTB;
+typedef heat::Laplace<FTB::Tuple>              Laplace;
+
+template<typename DOF>
+void boundaryValue( const base::Vector<2>::Type& x, DOF* doFPtr,
+                    const double a )
+{
+    if ( doFPtr -> isActive( 0 ) )
+        doFPtr -> constrainValue( 0, a * x[0] + x[1] );
+}
+
+base::Vector<1>::Type force( const base::Vector<2>::Type& x )
+{
+    return base::constantVector<1>( 1. + x[0] );
+}
+
+// boundary values and u_s = 0.4 u_m1 + 0.6 u_m2 + g for the first active DoFs
+void constrain( const Mesh& mesh, Field& field, const double a,
+                const double g )
+{
+    base::mesh::MeshBoundary meshBoundary;
+    meshBoundary.create( mesh.elementsBegin(), mesh.elementsEnd() );
+    base::dof::constrainBoundary<FEBasis>(
+        meshBoundary.begin(), meshBoundary.end(), mesh, field,
+        boost::bind( &boundaryValue<DoF>, _1, _2, a ) );
+
+    std::vector<DoF*> active;
+    for ( Field::DoFPtrIter d = field.doFsBegin(); d != field.doFsEnd(); ++d )
+        if ( (*d) -> isActive( 0 ) ) active.push_back( *d );
+
+    active[0] -> makeConstraint( 0 );
+    active[0] -> getConstraint( 0 ) -> addWeightedDoF( active[1], 0, 0.4 );
+    active[0] -> getConstraint( 0 ) -> addWeightedDoF( active[2], 0, 0.6 );
+    active[0] -> getConstraint( 0 ) -> setValue( g );
+}
+
+// solve and return the DoF values
+std::vector<double> solve( const Mesh& mesh, Field& field )
+{
+    const std::size_t numDoFs =
+        base::dof::numberDoFsConsecutively( field.doFsBegin(), field.doFsEnd() );
+    base::solver::Eigen3 solver( numDoFs );
+
+    Quadrature quadrature;
+    FieldBinder fieldBinder( const_cast<Mesh&>( mesh ), field );
+    solver.registerFields<FTB>( fieldBinder );
+    Laplace laplace( 1.0 );
+    base::asmb::stiffnessMatrixComputation<FTB>( quadrature, solver,
+                                                 fieldBinder, laplace );
+    base::asmb::bodyForceComputation<FTB>( quadrature, solver, fieldBinder,
+                                           boost::bind( &force, _1 ) );
+    solver.finishAssembly();
+    solver.choleskySolve();
+    base::dof::setDoFsFromSolver( solver, field );
+
+    std::vector<double> values;
+    for ( Field::DoFPtrIter d = field.doFsBegin(); d != field.doFsEnd(); ++d )
+        values.push_back( (*d) -> getValue( 0 ) );
+    return values;
+}
+
+// solve both problems with or without constraint tables
+void run( const Mesh& mesh, const bool useTables,
+          std::vector<double>& valuesA, std::vector<double>& valuesB )
+{
+    Field fieldA, fieldB;
+    base::dof::generate<FEBasis>( mesh, fieldA );
+    base::dof::generate<FEBasis>( mesh, fieldB );
+    constrain( mesh, fieldA, 1.0,  0.1 );
+    constrain( mesh, fieldB, 2.0, -0.3 );
+    base::dof::numberDoFsConsecutively( fieldA.doFsBegin(), fieldA.doFsEnd() );
+    base::dof::numberDoFsConsecutively( fieldB.doFsBegin(), fieldB.doFsEnd() );
+
+    if ( useTables ) {
+        base::dof::buildConstraintTable( fieldA );
+        base::dof::buildConstraintTable( fieldB );
+        BOOST_CHECK( ConstraintTable::get( fieldA ) != NULL );
+        BOOST_CHECK( ConstraintTable::get( fieldB ) != NULL );
+        BOOST_CHECK( ConstraintTable::get( fieldA ) !=
+                     ConstraintTable::get( fieldB ) );
+
+        // the DoFs are found in the table of their field
+        std::size_t row;
+        const DoF* doFA = *( fieldA.doFsBegin() );
+        const DoF* doFB = *( fieldB.doFsBegin() );
+        BOOST_CHECK( ConstraintTable::lookUp( doFA, 0, row ) ==
+                     ConstraintTable::get( fieldA ) );
+        BOOST_CHECK( ConstraintTable::lookUp( doFB, 0, row ) ==
+                     ConstraintTable::get( fieldB ) );
+    }
+
+    // the table has to follow the new inhomogeneities
+    base::dof::scaleConstraints( fieldA, 0.5 );
+
+    valuesA = solve( mesh, fieldA );
+    valuesB = solve( mesh, fieldB );
+
+    if ( useTables ) {
+        // the same numbering again does not outdate the tables
+        ConstraintTable* tableA = ConstraintTable::get( fieldA );
+        BOOST_CHECK( tableA -> isCurrent() );
+
+        // a new numbering of B outdates only the table of B
+        std::vector<DoF*> doFsB( fieldB.doFsBegin(), fieldB.doFsEnd() );
+        base::dof::numberDoFsConsecutively( doFsB.rbegin(), doFsB.rend() );
+        BOOST_CHECK( tableA -> isCurrent() );
+        BOOST_CHECK( not ConstraintTable::get( fieldB ) -> isCurrent() );
+
+        // so does a changed constraint equation of A, until the rebuild
+        DoF* slave = NULL;
+        for ( Field::DoFPtrIter d = fieldA.doFsBegin(); d != fieldA.doFsEnd(); ++d )
+            if ( (*d) -> isConstrained( 0 ) and
+                 ( (*d) -> getConstraint( 0 ) -> numWeightedDoFs() > 0 ) ) slave = *d;
+        BOOST_CHECK( slave != NULL );
+        DoF* master = slave -> getConstraint( 0 ) -> getWeightedDoF( 0 ).get<0>();
+        slave -> getConstraint( 0 ) -> addWeightedDoF( master, 0, 0.1 );
+        BOOST_CHECK( not tableA -> isCurrent() );
+        base::dof::buildConstraintTable( fieldA );
+        BOOST_CHECK( tableA -> isCurrent() );
+
+        // clearing the constraints of B must leave the table of A intact
+        base::dof::clearConstraints( fieldB );
+        BOOST_CHECK( ConstraintTable::get( fieldB ) == NULL );
+        BOOST_CHECK( ConstraintTable::get( fieldA ) != NULL );
+        BOOST_CHECK( ConstraintTable::get( fieldA ) -> numConstraints() > 1 );
+        BOOST_CHECK( ConstraintTable::anyActive() );
+    }
+}
+
+bool equal( const std::vector<double>& a, const std::vector<double>& b )
+{
+    if ( a.size() != b.size() ) return false;
+    for ( std::size_t i = 0; i < a.size(); i++ )
+        if ( std::abs( a[i] - b[i] ) > 1.e-12 ) return false;
+    return true;
+}
+
+int test_main( int, char *[] )
+{
+    Mesh mesh;
+    {
+        std::stringstream smf;
+        tools::meshGeneration::unitCube::SMF<2,false,1>::apply( 5, 4, 1, smf );
+        base::io::smf::readMesh( smf, mesh );
+    }
+
+    std::vector<double> directA, directB, tableA, tableB;
+    run( mesh, false, directA, directB );
+    BOOST_CHECK( not ConstraintTable::anyActive() );
+    run( mesh, true,  tableA,  tableB  );
+
+    // the tables are removed with their fields
+    BOOST_CHECK( not ConstraintTable::anyActive() );
+
+    // collection for the assembly and distribution agree
+    BOOST_CHECK( not equal( directA, directB ) );
+    BOOST_CHECK( equal( directA, tableA ) );
+    BOOST_CHECK( equal( directB, tableB ) );
+
+    return 0;
+}
+//! \endcond
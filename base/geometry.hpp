@@ -18,6 +18,8 @@
 // base includes
 #include <base/linearAlgebra.hpp>
 #include <base/verify.hpp>
+// base/mesh includes
+#include <base/mesh/GeometryCache.hpp>
 
 //------------------------------------------------------------------------------
 namespace base{
@@ -30,6 +32,17 @@ namespace base{
 
         template<unsigned DIM, unsigned LDIM> struct MetricComputation;
         template<unsigned DIM>                struct MetricComputation<DIM,DIM>;
+
+        //! Cached geometry data of an element at a point or NULL
+        template<typename ELEMENT, typename VECDIM>
+        const typename base::mesh::GeometryCache<ELEMENT>::Entry*
+        findCachedGeometry( const ELEMENT* ep, const VECDIM& xi )
+        {
+            const base::mesh::GeometryCache<ELEMENT>& cache =
+                base::mesh::GeometryCache<ELEMENT>::instance();
+            if ( not cache.isActive() ) return NULL;
+            return cache.find( ep, xi );
+        }
     }
 
     //--------------------------------------------------------------------------
@@ -156,6 +169,11 @@ namespace base{
         result_type operator()( const          ELEMENT*         ep,
                                 const typename GT::LocalVecDim& xi ) const
         {
+            // Look up cached data
+            const typename base::mesh::GeometryCache<ELEMENT>::Entry* entry =
+                detail_::findCachedGeometry( ep, xi );
+            if ( entry != NULL ) return entry -> jacobiMatrix;
+            
             // Evaluate the geometry shape functions' gradient
             typename GT::GeomFun::GradArray funGradValues;
             ( ep -> geomFun() ).gradient( xi, funGradValues );
@@ -205,6 +223,14 @@ namespace base{
                                 const typename GT::LocalVecDim& xi,
                                 MatDimLDim& contraVariant ) const
         {
+            // Look up cached data
+            const typename base::mesh::GeometryCache<ELEMENT>::Entry* entry =
+                detail_::findCachedGeometry( ep, xi );
+            if ( entry != NULL ) {
+                contraVariant = entry -> contraVariant;
+                return entry -> detJ;
+            }
+            
             // Get Jacobi matrix
             typename base::Matrix<GT::globalDim,
                                   GT::localDim>::Type J
@@ -238,6 +264,11 @@ namespace base{
         result_type operator()( const          ELEMENT*         ep,
                                 const typename GT::LocalVecDim& xi ) const
         {
+            // Look up cached data
+            const typename base::mesh::GeometryCache<ELEMENT>::Entry* entry =
+                detail_::findCachedGeometry( ep, xi );
+            if ( entry != NULL ) return entry -> detJ;
+            
             // Get Jacobi matrix
             const typename base::Matrix<GT::globalDim,
                                         GT::localDim>::Type J
@@ -532,6 +563,9 @@ namespace base{
                 for ( unsigned b = 0; b < GT::localDim; b++ )
                     result(a,b) = base::constantVector<GT::globalDim>( 0. );
 
+            // no second derivatives of an affine geometry
+            if ( base::mesh::IsAffine<typename GT::GeomFun>::value ) return result;
+
             // result = X[i] * (grad grad phi[i])
             for ( unsigned i = 0; i < ELEMENT::numNodes; i++ ) {
                 
@@ -546,5 +580,64 @@ namespace base{
        
     };
 
+    //--------------------------------------------------------------------------
+    /** Store the geometry data of all elements of a mesh at the given points.
+     *  Evaluation points of the quadrature which are already cached are
+     *  skipped, for affine elements only one entry per element is computed.
+     *  See base::mesh::GeometryCache for details.
+     *  \tparam MESH  Type of mesh
+     *  \tparam QUAD  Type of quadrature
+     *  \param[in] mesh        Mesh whose elements are cached
+     *  \param[in] quadrature  Quadrature rule providing the points
+     */
+    template<typename MESH, typename QUAD>
+    void cacheGeometry( const MESH& mesh, const QUAD& quadrature )
+    {
+        typedef typename MESH::Element                  Element;
+        typedef base::mesh::GeometryCache<Element>      Cache;
+        Cache& cache = Cache::instance();
+
+        typename MESH::ElementPtrConstIter eIter = mesh.elementsBegin();
+        typename MESH::ElementPtrConstIter eEnd  = mesh.elementsEnd();
+        for ( ; eIter != eEnd; ++eIter ) {
+            const Element* ep = *eIter;
+
+            typename QUAD::Iter qIter = quadrature.begin();
+            typename QUAD::Iter qEnd  = quadrature.end();
+            for ( ; qIter != qEnd; ++qIter ) {
+
+                const typename Cache::LocalVecDim& xi = qIter -> second;
+                if ( cache.find( ep, xi ) != NULL ) continue;
+
+                typename Cache::Entry entry;
+                entry.xi           = xi;
+                entry.jacobiMatrix = JacobiMatrix<Element>()( ep, xi );
+                entry.detJ         =
+                    detail_::ContraVariantBasisComputation<Cache::globalDim,
+                                                           Cache::localDim>::
+                    apply( entry.jacobiMatrix, entry.contraVariant );
+                cache.insert( ep, entry );
+            }
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    /** Remove the cached geometry data of all elements of a mesh.
+     *  Moving nodes already invalidates the cache, this function only
+     *  releases the memory.
+     *  \tparam MESH  Type of mesh
+     *  \param[in] mesh  Mesh whose elements are removed from the cache
+     */
+    template<typename MESH>
+    void invalidateGeometryCache( const MESH& mesh )
+    {
+        typedef base::mesh::GeometryCache<typename MESH::Element> Cache;
+        Cache& cache = Cache::instance();
+
+        typename MESH::ElementPtrConstIter eIter = mesh.elementsBegin();
+        typename MESH::ElementPtrConstIter eEnd  = mesh.elementsEnd();
+        for ( ; eIter != eEnd; ++eIter ) cache.erase( *eIter );
+    }
+
 }
 #endif
@@ -0,0 +1,310 @@
+//------------------------------------------------------------------------------
+// <preamble>
+// </preamble>
+//------------------------------------------------------------------------------
+
+//! @file   Checkpoint.hpp
+//! @author agent
+//! @date   2026
+
+#ifndef base_io_chkpt_checkpoint_hpp
+#define base_io_chkpt_checkpoint_hpp
+
+//------------------------------------------------------------------------------
+// std   includes
+#include <map>
+#include <string>
+#include <vector>
+#include <fstream>
+#include <cstdio>
+#include <cstring>
+#include <thread>
+// boost includes
+#include <boost/utility.hpp>
+#include <boost/cstdint.hpp>
+// base includes
+#include <base/verify.hpp>
+#include <base/io/Format.hpp>
+
+//------------------------------------------------------------------------------
+namespace base{
+    namespace io{
+        namespace chkpt{
+
+            //! Raw storage of a checkpoint section
+            typedef std::vector<char> Buffer;
+
+            class Checkpoint;
+
+            //! Current version of the file layout
+            static const boost::uint32_t version = 1;
+
+            //------------------------------------------------------------------
+            namespace detail_{
+
+                //! Identification of a checkpoint file
+                static const char magic[8] =
+                    { 'i', 'n', 'S', 'i', 'C', 'H', 'K', '\0' };
+
+                //! Marker for detecting a change of endianness
+                static const boost::uint32_t endianMarker = 0x01020304u;
+
+                //! Append the bytes of a plain value to a buffer
+                template<typename T>
+                void append( Buffer& buffer, const T& value )
+                {
+                    const char* begin = reinterpret_cast<const char*>( &value );
+                    buffer.insert( buffer.end(), begin, begin + sizeof( T ) );
+                }
+
+                //! Extract a plain value from a buffer and advance the position
+                template<typename T>
+                T extract( const Buffer& buffer, std::size_t& pos )
+                {
+                    VERIFY_MSG( pos + sizeof( T ) <= buffer.size(),
+                                "Checkpoint section is truncated" );
+                    T value;
+                    std::memcpy( &value, &(buffer[pos]), sizeof( T ) );
+                    pos += sizeof( T );
+                    return value;
+                }
+
+                //! Write the full checkpoint image to a file
+                inline void writeImage( const std::string& fileName,
+                                        const Buffer& image )
+                {
+                    // write to a temporary file first, such that an
+                    // interrupted write never destroys the previous checkpoint
+                    const std::string tmpName = fileName + ".tmp";
+                    {
+                        std::ofstream out( tmpName.c_str(),
+                                           std::ios::binary | std::ios::trunc );
+                        VERIFY_MSG( out.is_open(),
+                                    "Cannot open checkpoint file " + tmpName );
+                        if ( not image.empty() )
+                            out.write( &(image[0]),
+                                       static_cast<std::streamsize>( image.size() ) );
+                        VERIFY_MSG( out.good(),
+                                    "Failed writing checkpoint file " + tmpName );
+                    }
+
+                    VERIFY_MSG( std::rename( tmpName.c_str(),
+                                             fileName.c_str() ) == 0,
+                                "Cannot rename " + tmpName + " to " + fileName );
+                }
+            }
+
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+/** In-memory image of a simulation state for checkpointing and restart.
+ *  A checkpoint consists of the step counter, the time and an arbitrary
+ *  number of named binary sections. The sections are filled and read by the
+ *  functions in base/io/chkpt/store.hpp which copy the state of fields,
+ *  constraints and level sets. Since this copy is a complete snapshot, the
+ *  simulation can continue immediately while the image is written to disk
+ *  by a background thread (see writeAsync()).
+ *
+ *  The file layout is (all integers unsigned, native byte order)
+ *  \code{.txt}
+ *  magic[8] version(32) endianMarker(32) step(64) time(double) numSections(64)
+ *  { nameLength(32) name[nameLength] size(64) bytes[size] } x numSections
+ *  \endcode
+ *  Files are only read back if the version and the endianness match.
+ */
+class base::io::chkpt::Checkpoint
+    : public boost::noncopyable
+{
+public:
+    //! Storage of the sections
+    typedef std::map<std::string,Buffer> SectionMap;
+
+    Checkpoint()
+        : step_( 0 ), time_( 0. ), busy_( false )
+    { }
+
+    //! Finish a pending write before destruction
+    ~Checkpoint() { this -> wait(); }
+
+    //--------------------------------------------------------------------------
+    //! @name Counters
+    //@{
+    void setStep( const std::size_t step ) { step_ = step; }
+    std::size_t getStep() const { return step_; }
+
+    void setTime( const double time ) { time_ = time; }
+    double getTime() const { return time_; }
+    //@}
+
+    //--------------------------------------------------------------------------
+    //! @name Sections
+    //@{
+    //! Create a new (or overwrite an existing) empty section
+    Buffer& newSection( const std::string& name )
+    {
+        Buffer& buffer = sections_[ name ];
+        buffer.clear();
+        return buffer;
+    }
+
+    bool hasSection( const std::string& name ) const
+    {
+        return ( sections_.find( name ) != sections_.end() );
+    }
+
+    const Buffer& getSection( const std::string& name ) const
+    {
+        SectionMap::const_iterator iter = sections_.find( name );
+        VERIFY_MSG( iter != sections_.end(),
+                    "Checkpoint has no section named " + name );
+        return iter -> second;
+    }
+
+    void clear() { sections_.clear(); }
+    //@}
+
+    //--------------------------------------------------------------------------
+    //! Synchronous write
+    void write( const std::string& fileName )
+    {
+        this -> wait();
+        Buffer image;
+        this -> makeImage_( image );
+        detail_::writeImage( fileName, image );
+    }
+
+    //--------------------------------------------------------------------------
+    /** Write the checkpoint image in a background thread.
+     *  The image is composed here, i.e. the sections of this object can be
+     *  cleared or refilled right after the call. Only one write is pending
+     *  at a time, a previous one is finished first.
+     *  \note Requires linking with the thread library (e.g. -pthread)
+     */
+    void writeAsync( const std::string& fileName )
+    {
+        this -> wait();
+        pendingImage_.clear();
+        this -> makeImage_( pendingImage_ );
+        pendingFile_ = fileName;
+        writer_ = std::thread( &detail_::writeImage,
+                               pendingFile_, std::cref( pendingImage_ ) );
+        busy_ = true;
+    }
+
+    //! Block until a pending asynchronous write is finished
+    void wait()
+    {
+        if ( busy_ ) {
+            writer_.join();
+            busy_ = false;
+            Buffer().swap( pendingImage_ );
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    //! Read a checkpoint file and replace the current content
+    void read( const std::string& fileName )
+    {
+        this -> wait();
+
+        std::ifstream inp( fileName.c_str(), std::ios::binary );
+        VERIFY_MSG( inp.is_open(), "Cannot open checkpoint file " + fileName );
+
+        inp.seekg( 0, std::ios::end );
+        const std::streamoff length = inp.tellg();
+        inp.seekg( 0, std::ios::beg );
+        Buffer image( static_cast<std::size_t>( length ) );
+        if ( length > 0 ) inp.read( &(image[0]), length );
+        VERIFY_MSG( inp.good(), "Failed reading checkpoint file " + fileName );
+
+        std::size_t pos = 0;
+        VERIFY_MSG( image.size() >= sizeof( detail_::magic ) and
+                    std::memcmp( &(image[0]), detail_::magic,
+                                 sizeof( detail_::magic ) ) == 0,
+                    fileName + " is not a checkpoint file" );
+        pos += sizeof( detail_::magic );
+
+        const boost::uint32_t fileVersion =
+            detail_::extract<boost::uint32_t>( image, pos );
+        VERIFY_MSG( fileVersion == version,
+                    "Checkpoint version " + x2s( fileVersion ) +
+                    " is not supported (expected " + x2s( version ) + ")" );
+
+        const boost::uint32_t marker =
+            detail_::extract<boost::uint32_t>( image, pos );
+        VERIFY_MSG( marker == detail_::endianMarker,
+                    "Checkpoint has been written with different endianness" );
+
+        step_ = static_cast<std::size_t>(
+            detail_::extract<boost::uint64_t>( image, pos ) );
+        time_ = detail_::extract<double>( image, pos );
+
+        const boost::uint64_t numSections =
+            detail_::extract<boost::uint64_t>( image, pos );
+
+        sections_.clear();
+        for ( boost::uint64_t s = 0; s < numSections; s++ ) {
+            const boost::uint32_t nameLength =
+                detail_::extract<boost::uint32_t>( image, pos );
+            VERIFY_MSG( pos + nameLength <= image.size(),
+                        "Checkpoint file is truncated" );
+            const std::string name( image.begin() + pos,
+                                    image.begin() + pos + nameLength );
+            pos += nameLength;
+
+            const std::size_t size = static_cast<std::size_t>(
+                detail_::extract<boost::uint64_t>( image, pos ) );
+            VERIFY_MSG( pos + size <= image.size(),
+                        "Checkpoint file is truncated" );
+            sections_[ name ].assign( image.begin() + pos,
+                                      image.begin() + pos + size );
+            pos += size;
+        }
+    }
+
+private:
+    //! Compose header and sections into one contiguous buffer
+    void makeImage_( Buffer& image ) const
+    {
+        std::size_t total = sizeof( detail_::magic ) + 64;
+        SectionMap::const_iterator iter = sections_.begin();
+        for ( ; iter != sections_.end(); ++iter )
+            total += 16 + iter -> first.size() + iter -> second.size();
+        image.reserve( total );
+
+        image.insert( image.end(), detail_::magic,
+                      detail_::magic + sizeof( detail_::magic ) );
+        detail_::append( image, version );
+        detail_::append( image, detail_::endianMarker );
+        detail_::append( image, static_cast<boost::uint64_t>( step_ ) );
+        detail_::append( image, time_ );
+        detail_::append( image,
+                         static_cast<boost::uint64_t>( sections_.size() ) );
+
+        for ( iter = sections_.begin(); iter != sections_.end(); ++iter ) {
+            detail_::append( image,
+                             static_cast<boost::uint32_t>( iter -> first.size() ) );
+            image.insert( image.end(), iter -> first.begin(), iter -> first.end() );
+            detail_::append( image,
+                             static_cast<boost::uint64_t>( iter -> second.size() ) );
+            image.insert( image.end(), iter -> second.begin(), iter -> second.end() );
+        }
+    }
+
+private:
+    std::size_t step_;     //!< Step counter
+    double      time_;     //!< Current time
+    SectionMap  sections_; //!< Named binary sections
+
+    //! @name Asynchronous writing
+    //@{
+    std::thread writer_;       //!< Background thread
+    Buffer      pendingImage_; //!< Image owned by the background thread
+    std::string pendingFile_;  //!< Target file of the background thread
+    bool        busy_;         //!< Flag if a write is pending
+    //@}
+};
+
+#endif
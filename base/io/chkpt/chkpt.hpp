@@ -0,0 +1,51 @@
+# error DOCUMENATION_ONLY
+/**  \namespace base::io::chkpt
+ *    Namespace for checkpointing and restarting a simulation.
+ *
+ *    Description
+ *    -----------
+ *
+ *    A checkpoint is a binary image of the complete simulation state which
+ *    allows to continue a (long) transient computation after an interruption
+ *    and results in the same solution as an uninterrupted run. Therefore,
+ *    the following data is stored without any loss of precision
+ *    -   the step counter and the current time
+ *    -   for every field: the DoF values of all history layers, the status of
+ *        every DoF component, the DoF indices (i.e. the equation numbering)
+ *        and the linear constraints
+ *    -   the level set data of the immersed or cut geometry
+ *    -   any number of user-defined values.
+ *
+ *    Usage
+ *    -----
+ *
+ *    \code{.cpp}
+ *    base::io::chkpt::Checkpoint checkpoint;
+ *
+ *    for ( unsigned step = 0; step < numSteps; step++ ) {
+ *
+ *        // ... solve and update history
+ *
+ *        if ( (step+1) % checkpointInterval == 0 ) {
+ *            checkpoint.setStep( step+1 );
+ *            base::io::chkpt::storeField( checkpoint, "displacement", field );
+ *            base::io::chkpt::storeLevelSets( checkpoint, "levelSet", levelSet );
+ *            // composes the image and returns immediately
+ *            checkpoint.writeAsync( "run.chk" );
+ *        }
+ *    }
+ *    \endcode
+ *    and for a restart, after generating mesh and fields as usual
+ *    \code{.cpp}
+ *    base::io::chkpt::Checkpoint checkpoint;
+ *    checkpoint.read( "run.chk" );
+ *    base::io::chkpt::restoreField(     checkpoint, "displacement", field );
+ *    base::io::chkpt::restoreLevelSets( checkpoint, "levelSet", levelSet );
+ *    const unsigned firstStep = checkpoint.getStep();
+ *    \endcode
+ *
+ *    The file is written to a temporary file which is renamed upon completion,
+ *    hence a crash during writing never destroys the previous checkpoint.
+ *    The format is versioned (see base::io::chkpt::version) and files of a
+ *    different version or endianness are rejected.
+ */
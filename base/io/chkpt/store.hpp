@@ -0,0 +1,378 @@
+//------------------------------------------------------------------------------
+// <preamble>
+// </preamble>
+//------------------------------------------------------------------------------
+
+//! @file   store.hpp
+//! @author agent
+//! @date   2026
+
+#ifndef base_io_chkpt_store_hpp
+#define base_io_chkpt_store_hpp
+
+//------------------------------------------------------------------------------
+// std   includes
+#include <string>
+#include <vector>
+// boost includes
+#include <boost/cstdint.hpp>
+// base includes
+#include <base/verify.hpp>
+#include <base/dof/DegreeOfFreedom.hpp>
+#include <base/cut/LevelSet.hpp>
+// base/io includes
+#include <base/io/Format.hpp>
+#include <base/io/chkpt/Checkpoint.hpp>
+
+//------------------------------------------------------------------------------
+namespace base{
+    namespace io{
+        namespace chkpt{
+
+            template<typename FIELD>
+            void storeField( Checkpoint& checkpoint, const std::string& name,
+                             const FIELD& field );
+
+            template<typename FIELD>
+            void restoreField( const Checkpoint& checkpoint,
+                               const std::string& name, FIELD& field );
+
+            template<unsigned DIM>
+            void storeLevelSets(
+                Checkpoint& checkpoint, const std::string& name,
+                const std::vector<base::cut::LevelSet<DIM> >& levelSets );
+
+            template<unsigned DIM>
+            void restoreLevelSets(
+                const Checkpoint& checkpoint, const std::string& name,
+                std::vector<base::cut::LevelSet<DIM> >& levelSets );
+
+            template<typename T>
+            void storeValues( Checkpoint& checkpoint, const std::string& name,
+                              const std::vector<T>& values );
+
+            template<typename T>
+            void restoreValues( const Checkpoint& checkpoint,
+                                const std::string& name,
+                                std::vector<T>& values );
+
+            namespace detail_{
+
+                template<typename VEC>
+                void appendVector( Buffer& buffer, const VEC& vec )
+                {
+                    for ( int d = 0; d < vec.size(); d++ )
+                        append( buffer, static_cast<double>( vec[d] ) );
+                }
+
+                template<typename VEC>
+                void extractVector( const Buffer& buffer, std::size_t& pos,
+                                    VEC& vec )
+                {
+                    for ( int d = 0; d < vec.size(); d++ )
+                        vec[d] = extract<double>( buffer, pos );
+                }
+            }
+
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+/** Copy the complete state of the degrees of freedom of a field.
+ *  For every DoF its ID, the indices (i.e. the equation numbering), all
+ *  history layers of values and the status of every component are stored.
+ *  Linear constraints are stored with their RHS and the list of contributing
+ *  DoFs which are referred to by their ID.
+ *  \note The master DoFs of a constraint have to belong to the same field
+ *        and the DoF IDs have to coincide with their position in the field
+ *        (as generated by base::dof::generate).
+ *  \tparam FIELD  Type of field
+ *  \param[in,out] checkpoint  Checkpoint object to store into
+ *  \param[in]     name        Name of the section
+ *  \param[in]     field       Field to be stored
+ */
+template<typename FIELD>
+void base::io::chkpt::storeField( Checkpoint& checkpoint,
+                                  const std::string& name,
+                                  const FIELD& field )
+{
+    typedef typename FIELD::DegreeOfFreedom DoF;
+    static const unsigned size  = DoF::size;
+    static const unsigned nHist = DoF::nHist;
+
+    Buffer& buffer = checkpoint.newSection( name );
+
+    const std::size_t numDoFs =
+        static_cast<std::size_t>( std::distance( field.doFsBegin(),
+                                                 field.doFsEnd() ) );
+
+    // reserve the approximate size for the unconstrained part
+    buffer.reserve( 16 + numDoFs * 8 * ( 1 + size * ( nHist + 3 ) ) );
+
+    detail_::append( buffer, static_cast<boost::uint64_t>( numDoFs ) );
+    detail_::append( buffer, static_cast<boost::uint32_t>( size ) );
+    detail_::append( buffer, static_cast<boost::uint32_t>( nHist ) );
+
+    // DoF data
+    std::size_t numConstraints = 0;
+    typename FIELD::DoFPtrConstIter doFIter = field.doFsBegin();
+    typename FIELD::DoFPtrConstIter doFEnd  = field.doFsEnd();
+    for ( ; doFIter != doFEnd; ++doFIter ) {
+        const DoF* doF = *doFIter;
+
+        detail_::append( buffer, static_cast<boost::uint64_t>( doF -> getID() ) );
+
+        for ( unsigned s = 0; s < size; s++ )
+            detail_::append( buffer,
+                             static_cast<boost::uint64_t>( doF -> getIndex( s ) ) );
+
+        for ( unsigned s = 0; s < size; s++ ) {
+            detail_::append( buffer,
+                             static_cast<boost::int32_t>( doF -> getStatus( s ) ) );
+            if ( doF -> isConstrained( s ) ) numConstraints++;
+        }
+
+        for ( unsigned h = 0; h <= nHist; h++ )
+            for ( unsigned s = 0; s < size; s++ )
+                detail_::append( buffer, doF -> getHistoryValue( h, s ) );
+    }
+
+    // constraints
+    detail_::append( buffer, static_cast<boost::uint64_t>( numConstraints ) );
+    for ( doFIter = field.doFsBegin(); doFIter != doFEnd; ++doFIter ) {
+        const DoF* doF = *doFIter;
+        for ( unsigned s = 0; s < size; s++ ) {
+            if ( not doF -> isConstrained( s ) ) continue;
+
+            const typename DoF::Constraint* constraint = doF -> getConstraint( s );
+
+            detail_::append( buffer, static_cast<boost::uint64_t>( doF -> getID() ) );
+            detail_::append( buffer, static_cast<boost::uint32_t>( s ) );
+            detail_::append( buffer, constraint -> getValue() );
+
+            const std::size_t numWeighted = constraint -> numWeightedDoFs();
+            detail_::append( buffer, static_cast<boost::uint64_t>( numWeighted ) );
+            for ( std::size_t w = 0; w < numWeighted; w++ ) {
+                const typename DoF::Constraint::WeightedDoF& wd =
+                    constraint -> getWeightedDoF( w );
+                detail_::append( buffer,
+                                 static_cast<boost::uint64_t>(
+                                     wd.template get<0>() -> getID() ) );
+                detail_::append( buffer,
+                                 static_cast<boost::uint32_t>( wd.template get<1>() ) );
+                detail_::append( buffer,
+                                 static_cast<double>( wd.template get<2>() ) );
+            }
+        }
+    }
+
+    return;
+}
+
+//------------------------------------------------------------------------------
+/** Restore the state of the degrees of freedom of a field.
+ *  The field must have been generated with the same mesh and DoF type as the
+ *  stored one. Existing constraints of the DoFs are destroyed and replaced by
+ *  the stored ones, and values, histories, status and indices are overwritten.
+ *  \tparam FIELD  Type of field
+ *  \param[in]     checkpoint  Checkpoint object to restore from
+ *  \param[in]     name        Name of the section
+ *  \param[in,out] field       Field to be restored
+ */
+template<typename FIELD>
+void base::io::chkpt::restoreField( const Checkpoint& checkpoint,
+                                    const std::string& name,
+                                    FIELD& field )
+{
+    typedef typename FIELD::DegreeOfFreedom DoF;
+    static const unsigned size  = DoF::size;
+    static const unsigned nHist = DoF::nHist;
+
+    const Buffer& buffer = checkpoint.getSection( name );
+    std::size_t pos = 0;
+
+    const std::size_t numDoFs = static_cast<std::size_t>(
+        detail_::extract<boost::uint64_t>( buffer, pos ) );
+    const unsigned fileSize  = detail_::extract<boost::uint32_t>( buffer, pos );
+    const unsigned fileNHist = detail_::extract<boost::uint32_t>( buffer, pos );
+
+    const std::size_t numFieldDoFs =
+        static_cast<std::size_t>( std::distance( field.doFsBegin(),
+                                                 field.doFsEnd() ) );
+
+    VERIFY_MSG( numDoFs == numFieldDoFs,
+                "Section " + name + " has " + x2s( numDoFs ) +
+                " DoFs, but field has " + x2s( numFieldDoFs ) );
+    VERIFY_MSG( (fileSize == size) and (fileNHist == nHist),
+                "Section " + name + " has been stored with a different DoF type" );
+
+    // DoF data
+    typename FIELD::DoFPtrIter doFIter = field.doFsBegin();
+    typename FIELD::DoFPtrIter doFEnd  = field.doFsEnd();
+    for ( ; doFIter != doFEnd; ++doFIter ) {
+        DoF* doF = *doFIter;
+
+        const std::size_t id = static_cast<std::size_t>(
+            detail_::extract<boost::uint64_t>( buffer, pos ) );
+        VERIFY_MSG( id == doF -> getID(),
+                    "DoF ID mismatch in section " + name + ": " +
+                    x2s( id ) + " vs. " + x2s( doF -> getID() ) );
+
+        for ( unsigned s = 0; s < size; s++ )
+            doF -> setIndex( s, static_cast<std::size_t>(
+                                 detail_::extract<boost::uint64_t>( buffer, pos ) ) );
+
+        // remove existing constraints and set the plain status, the
+        // constraint objects are generated below
+        doF -> clearConstraints();
+        for ( unsigned s = 0; s < size; s++ ) {
+            const boost::int32_t status =
+                detail_::extract<boost::int32_t>( buffer, pos );
+            if ( status == base::dof::INACTIVE ) doF -> deactivate( s );
+        }
+
+        for ( unsigned h = 0; h <= nHist; h++ )
+            for ( unsigned s = 0; s < size; s++ )
+                doF -> setHistoryValue( h, s,
+                                        detail_::extract<double>( buffer, pos ) );
+    }
+
+    // constraints
+    const std::size_t numConstraints = static_cast<std::size_t>(
+        detail_::extract<boost::uint64_t>( buffer, pos ) );
+    for ( std::size_t c = 0; c < numConstraints; c++ ) {
+        const std::size_t id = static_cast<std::size_t>(
+            detail_::extract<boost::uint64_t>( buffer, pos ) );
+        const unsigned s = detail_::extract<boost::uint32_t>( buffer, pos );
+        const double rhs = detail_::extract<double>( buffer, pos );
+
+        VERIFY_MSG( id < numDoFs, "Invalid constrained DoF " + x2s( id ) );
+        DoF* doF = field.doFPtr( id );
+        doF -> makeConstraint( s );
+        typename DoF::Constraint* constraint = doF -> getConstraint( s );
+        constraint -> setValue( rhs );
+
+        const std::size_t numWeighted = static_cast<std::size_t>(
+            detail_::extract<boost::uint64_t>( buffer, pos ) );
+        for ( std::size_t w = 0; w < numWeighted; w++ ) {
+            const std::size_t master = static_cast<std::size_t>(
+                detail_::extract<boost::uint64_t>( buffer, pos ) );
+            const unsigned dir    = detail_::extract<boost::uint32_t>( buffer, pos );
+            const double   weight = detail_::extract<double>( buffer, pos );
+
+            VERIFY_MSG( master < numDoFs, "Invalid master DoF " + x2s( master ) );
+            constraint -> addWeightedDoF( field.doFPtr( master ), dir, weight );
+        }
+    }
+
+    VERIFY_MSG( pos == buffer.size(),
+                "Section " + name + " has not been consumed completely" );
+    return;
+}
+
+//------------------------------------------------------------------------------
+/** Store a vector of level set data.
+ *  \param[in,out] checkpoint  Checkpoint object to store into
+ *  \param[in]     name        Name of the section
+ *  \param[in]     levelSets   Level set data of the mesh or grid nodes
+ */
+template<unsigned DIM>
+void base::io::chkpt::storeLevelSets(
+    Checkpoint& checkpoint, const std::string& name,
+    const std::vector<base::cut::LevelSet<DIM> >& levelSets )
+{
+    Buffer& buffer = checkpoint.newSection( name );
+    buffer.reserve( 8 + levelSets.size() * 8 * ( 3 * DIM + 1 ) );
+
+    detail_::append( buffer, static_cast<boost::uint64_t>( levelSets.size() ) );
+    for ( std::size_t l = 0; l < levelSets.size(); l++ ) {
+        detail_::appendVector( buffer, levelSets[l].getX() );
+        detail_::append( buffer, levelSets[l].getDistanceToPlane() );
+        detail_::appendVector( buffer, levelSets[l].getClosestPoint() );
+        detail_::append( buffer, static_cast<boost::uint64_t>(
+                             levelSets[l].getClosestElement() ) );
+        detail_::appendVector( buffer, levelSets[l].getClosestLocalCoordinate() );
+    }
+    return;
+}
+
+//------------------------------------------------------------------------------
+/** Restore a vector of level set data.
+ *  \param[in]  checkpoint  Checkpoint object to restore from
+ *  \param[in]  name        Name of the section
+ *  \param[out] levelSets   Level set data of the mesh or grid nodes
+ */
+template<unsigned DIM>
+void base::io::chkpt::restoreLevelSets(
+    const Checkpoint& checkpoint, const std::string& name,
+    std::vector<base::cut::LevelSet<DIM> >& levelSets )
+{
+    typedef base::cut::LevelSet<DIM> LevelSet;
+
+    const Buffer& buffer = checkpoint.getSection( name );
+    std::size_t pos = 0;
+
+    const std::size_t num = static_cast<std::size_t>(
+        detail_::extract<boost::uint64_t>( buffer, pos ) );
+    levelSets.resize( num );
+
+    for ( std::size_t l = 0; l < num; l++ ) {
+        typename LevelSet::VecDim x, y;
+        typename LevelSet::LocalVecDim xi;
+
+        detail_::extractVector( buffer, pos, x );
+        levelSets[l].setX( x );
+        levelSets[l].setDistanceToPlane( detail_::extract<double>( buffer, pos ) );
+        detail_::extractVector( buffer, pos, y );
+        levelSets[l].setClosestPoint( y );
+        levelSets[l].setClosestElement( static_cast<std::size_t>(
+                                            detail_::extract<boost::uint64_t>(
+                                                buffer, pos ) ) );
+        detail_::extractVector( buffer, pos, xi );
+        levelSets[l].setClosestLocalCoordinate( xi );
+    }
+
+    VERIFY_MSG( pos == buffer.size(),
+                "Section " + name + " has not been consumed completely" );
+    return;
+}
+
+//------------------------------------------------------------------------------
+/** Store a vector of plain values (e.g. user-defined scalars or counters).
+ *  \tparam T  Plain old data type
+ */
+template<typename T>
+void base::io::chkpt::storeValues( Checkpoint& checkpoint,
+                                   const std::string& name,
+                                   const std::vector<T>& values )
+{
+    Buffer& buffer = checkpoint.newSection( name );
+    buffer.reserve( 8 + values.size() * sizeof( T ) );
+    detail_::append( buffer, static_cast<boost::uint64_t>( values.size() ) );
+    for ( std::size_t v = 0; v < values.size(); v++ )
+        detail_::append( buffer, values[v] );
+}
+
+//------------------------------------------------------------------------------
+/** Restore a vector of plain values.
+ *  \tparam T  Plain old data type
+ */
+template<typename T>
+void base::io::chkpt::restoreValues( const Checkpoint& checkpoint,
+                                     const std::string& name,
+                                     std::vector<T>& values )
+{
+    const Buffer& buffer = checkpoint.getSection( name );
+    std::size_t pos = 0;
+    const std::size_t num = static_cast<std::size_t>(
+        detail_::extract<boost::uint64_t>( buffer, pos ) );
+    values.resize( num );
+    for ( std::size_t v = 0; v < num; v++ )
+        values[v] = detail_::extract<T>( buffer, pos );
+
+    VERIFY_MSG( pos == buffer.size(),
+                "Section " + name + " has not been consumed completely" );
+}
+
+#endif
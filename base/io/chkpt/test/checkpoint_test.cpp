@@ -0,0 +1,131 @@
+#include <cstdio>
+#include <boost/test/minimal.hpp>
+
+#include <base/dof/DegreeOfFreedom.hpp>
+#include <base/dof/Field.hpp>
+#include <base/io/chkpt/Checkpoint.hpp>
+#include <base/io/chkpt/store.hpp>
+
+//! \cond SKIPDOX
+// minimal element type which only provides the DoF type to the field
+struct Element
+{
+    typedef base::dof::DegreeOfFreedom<2,2> DegreeOfFreedom;
+    void setID( const std::size_t ) { }
+};
+
+typedef base::dof::Field<Element> Field;
+typedef Field::DegreeOfFreedom    DoF;
+
+// fill a field with some arbitrary state
+void makeState( Field& field, const double offset )
+{
+    field.addDoFs( 4 );
+    for ( std::size_t d = 0; d < 4; d++ ) {
+        DoF* doF = field.doFPtr( d );
+        doF -> setID( d );
+        for ( unsigned s = 0; s < 2; s++ ) {
+            doF -> setIndex( s, 2*d + s );
+            for ( unsigned h = 0; h < 3; h++ )
+                doF -> setHistoryValue( h, s, offset + 0.1*static_cast<double>(d) + 0.01*s + h/3. );
+        }
+    }
+    
+    field.doFPtr( 1 ) -> deactivate( 0 );
+    field.doFPtr( 2 ) -> constrainValue( 1, 2.5 );
+    field.doFPtr( 3 ) -> makeConstraint( 0 );
+    field.doFPtr( 3 ) -> getConstraint( 0 ) -> setValue( -1./3. );
+    field.doFPtr( 3 ) -> getConstraint( 0 ) ->
+        addWeightedDoF( field.doFPtr( 0 ), 1, 0.75 );
+}
+
+int test_main( int, char *[] )            
+{
+    const std::string fileName = "checkpoint_test.chk";
+    
+    Field original;
+    makeState( original, 1.0 );
+
+    std::vector<base::cut::LevelSet<2> > levelSets( 3 );
+    for ( unsigned l = 0; l < levelSets.size(); l++ ) {
+        levelSets[l].setX( base::constantVector<2>( l ) );
+        levelSets[l].setDistanceToPlane( l - 1.5 );
+        levelSets[l].setClosestPoint( base::constantVector<2>( 2.*l ) );
+        levelSets[l].setClosestElement( 10 + l );
+        levelSets[l].setClosestLocalCoordinate( base::constantVector<1>( 0.5 ) );
+    }
+
+    std::vector<double> scalars( 2 ); scalars[0] = 0.125; scalars[1] = 1.e-3;
+
+    // write asynchronously and destroy the content immediately
+    {
+        base::io::chkpt::Checkpoint checkpoint;
+        checkpoint.setStep( 42 );
+        checkpoint.setTime( 4.2 );
+        base::io::chkpt::storeField(     checkpoint, "field",    original );
+        base::io::chkpt::storeLevelSets( checkpoint, "levelSet", levelSets );
+        base::io::chkpt::storeValues(    checkpoint, "scalars",  scalars );
+        checkpoint.writeAsync( fileName );
+        checkpoint.clear();
+        checkpoint.wait();
+    }
+
+    // restore into a field with different state
+    Field restored;
+    makeState( restored, 7.0 );
+    restored.doFPtr( 0 ) -> constrainValue( 0, 1.0 );
+    
+    std::vector<base::cut::LevelSet<2> > levelSets2;
+    std::vector<double> scalars2;
+
+    base::io::chkpt::Checkpoint checkpoint;
+    checkpoint.read( fileName );
+    base::io::chkpt::restoreField(     checkpoint, "field",    restored );
+    base::io::chkpt::restoreLevelSets( checkpoint, "levelSet", levelSets2 );
+    base::io::chkpt::restoreValues(    checkpoint, "scalars",  scalars2 );
+    std::remove( fileName.c_str() );
+
+    BOOST_CHECK( checkpoint.getStep() == 42 );
+    BOOST_CHECK( checkpoint.getTime() == 4.2 );
+
+    // bitwise identical values, numbering and status
+    for ( std::size_t d = 0; d < 4; d++ ) {
+        const DoF* a = original.doFPtr( d );
+        const DoF* b = restored.doFPtr( d );
+        for ( unsigned s = 0; s < 2; s++ ) {
+            BOOST_CHECK( a -> getIndex(  s ) == b -> getIndex(  s ) );
+            BOOST_CHECK( a -> getStatus( s ) == b -> getStatus( s ) );
+            for ( unsigned h = 0; h < 3; h++ )
+                BOOST_CHECK( a -> getHistoryValue( h, s ) ==
+                             b -> getHistoryValue( h, s ) );
+        }
+    }
+
+    // constraints
+    BOOST_CHECK( restored.doFPtr( 2 ) -> getConstraint( 1 ) -> getValue() == 2.5 );
+    const DoF::Constraint* c = restored.doFPtr( 3 ) -> getConstraint( 0 );
+    BOOST_CHECK( c -> getValue() == -1./3. );
+    BOOST_CHECK( c -> numWeightedDoFs() == 1 );
+    BOOST_CHECK( c -> getWeightedDoF( 0 ).get<0>() == restored.doFPtr( 0 ) );
+    BOOST_CHECK( c -> getWeightedDoF( 0 ).get<1>() == 1 );
+    BOOST_CHECK( c -> getWeightedDoF( 0 ).get<2>() == 0.75 );
+    BOOST_CHECK( c -> evaluate() ==
+                 original.doFPtr( 3 ) -> getConstraint( 0 ) -> evaluate() );
+
+    // level sets and values
+    BOOST_CHECK( levelSets2.size() == levelSets.size() );
+    for ( unsigned l = 0; l < levelSets.size(); l++ ) {
+        BOOST_CHECK( levelSets2[l].getX() == levelSets[l].getX() );
+        BOOST_CHECK( levelSets2[l].getSignedDistance() ==
+                     levelSets[l].getSignedDistance() );
+        BOOST_CHECK( levelSets2[l].getClosestElement() ==
+                     levelSets[l].getClosestElement() );
+        BOOST_CHECK( levelSets2[l].getClosestLocalCoordinate() ==
+                     levelSets[l].getClosestLocalCoordinate() );
+    }
+    BOOST_CHECK( scalars2 == scalars );
+
+    return 0;
+}
+
+//! \endcond
@@ -0,0 +1,171 @@
+//------------------------------------------------------------------------------
+// <preamble>
+// </preamble>
+//------------------------------------------------------------------------------
+
+//! @file   ChunkedRows.hpp
+//! @author agent
+//! @date   2026
+
+#ifndef base_io_raw_chunkedrows_hpp
+#define base_io_raw_chunkedrows_hpp
+
+//------------------------------------------------------------------------------
+// std   includes
+#include <vector>
+// base includes
+#include <base/auxi/parallel.hpp>
+// base/io/raw includes
+#include <base/io/raw/parse.hpp>
+
+//------------------------------------------------------------------------------
+namespace base{
+    namespace io{
+        namespace raw{
+
+            class ChunkedRows;
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+/** Split a range of text lines into chunks for parallel parsing.
+ *  A row is a line with at least one non-blank character, empty lines are
+ *  skipped. The range is cut into chunks of roughly equal size at line
+ *  boundaries and the rows per chunk are counted in parallel. The prefix sum
+ *  of these counts gives the global index of the first row of every chunk,
+ *  such that each thread knows which rows it parses and can write directly
+ *  into preallocated storage.
+ */
+class base::io::raw::ChunkedRows
+{
+public:
+    /** Constructor computes the chunks and counts their rows
+     *  \param[in] begin, end  Range of characters
+     */
+    ChunkedRows( const char* begin, const char* end )
+    {
+        // a few chunks per thread for a better load balance
+        const int numThreads = base::auxi::setNumThreads();
+        const std::size_t size = static_cast<std::size_t>( end - begin );
+        std::size_t numChunks = 4 * static_cast<std::size_t>( numThreads );
+        // not less than 1MB per chunk
+        const std::size_t minChunk = 1 << 20;
+        if ( size / minChunk < numChunks ) numChunks = size / minChunk;
+        if ( numChunks == 0 ) numChunks = 1;
+
+        // boundaries of the chunks at the line ends
+        bounds_.push_back( begin );
+        for ( std::size_t c = 1; c < numChunks; c++ ) {
+            const char* guess = begin + c * ( size / numChunks );
+            if ( guess < bounds_.back() ) guess = bounds_.back();
+            bounds_.push_back( base::io::raw::nextLine( guess, end ) );
+        }
+        bounds_.push_back( end );
+
+        // count the rows of every chunk
+        firstRow_.resize( numChunks + 1, 0 );
+        CountRows countRows( bounds_, firstRow_ );
+        base::auxi::applyToAllIndices( numChunks, countRows );
+
+        // prefix sum: first row of every chunk
+        std::size_t sum = 0;
+        for ( std::size_t c = 0; c <= numChunks; c++ ) {
+            const std::size_t num = firstRow_[c];
+            firstRow_[c] = sum;
+            sum += num;
+        }
+    }
+
+    //! Total number of rows
+    std::size_t numRows() const { return firstRow_.back(); }
+
+    //! Number of chunks
+    std::size_t numChunks() const { return bounds_.size() - 1; }
+
+    //--------------------------------------------------------------------------
+    /** Call an operator for every row in parallel.
+     *  The operator is called as op( row, lineBegin, lineEnd ) where row is
+     *  the global row index and the pointers delimit the line without its end
+     *  character. Different rows are passed to different threads, therefore
+     *  the operator must be thread-safe with respect to the row index.
+     *  \tparam OP Type of row operator
+     */
+    template<typename OP>
+    void apply( OP& op ) const
+    {
+        RowLoop<OP> rowLoop( bounds_, firstRow_, op );
+        base::auxi::applyToAllIndices( this -> numChunks(), rowLoop );
+    }
+
+private:
+    //! Check if a line contains something else but blanks
+    static bool isRow_( const char* p, const char* lineEnd )
+    {
+        base::io::raw::skipBlanks( p, lineEnd );
+        return ( p != lineEnd ) and ( *p != '\n' );
+    }
+
+    //--------------------------------------------------------------------------
+    //! Count rows per chunk
+    struct CountRows
+    {
+        CountRows( const std::vector<const char*>& bounds,
+                   std::vector<std::size_t>& counts )
+            : bounds_( bounds ), counts_( counts ) { }
+
+        void operator()( const std::size_t c )
+        {
+            std::size_t count = 0;
+            const char* p   = bounds_[c];
+            const char* end = bounds_[c+1];
+            while ( p != end ) {
+                const char* next = base::io::raw::nextLine( p, end );
+                if ( ChunkedRows::isRow_( p, next ) ) count++;
+                p = next;
+            }
+            counts_[c] = count;
+        }
+
+        const std::vector<const char*>& bounds_;
+        std::vector<std::size_t>&       counts_;
+    };
+
+    //--------------------------------------------------------------------------
+    //! Call row operator for all rows of a chunk
+    template<typename OP>
+    struct RowLoop
+    {
+        RowLoop( const std::vector<const char*>& bounds,
+                 const std::vector<std::size_t>& firstRow,
+                 OP& op )
+            : bounds_( bounds ), firstRow_( firstRow ), op_( op ) { }
+
+        void operator()( const std::size_t c )
+        {
+            std::size_t row = firstRow_[c];
+            const char* p   = bounds_[c];
+            const char* end = bounds_[c+1];
+            while ( p != end ) {
+                const char* next = base::io::raw::nextLine( p, end );
+                if ( ChunkedRows::isRow_( p, next ) ) {
+                    const char* lineEnd =
+                        ( (next != p) and (*(next-1) == '\n') ? next - 1 : next );
+                    op_( row, p, lineEnd );
+                    row++;
+                }
+                p = next;
+            }
+        }
+
+        const std::vector<const char*>& bounds_;
+        const std::vector<std::size_t>& firstRow_;
+        OP&                             op_;
+    };
+
+private:
+    std::vector<const char*> bounds_;   //!< Chunk boundaries
+    std::vector<std::size_t> firstRow_; //!< Global index of first row per chunk
+};
+
+#endif
@@ -0,0 +1,89 @@
+//------------------------------------------------------------------------------
+// <preamble>
+// </preamble>
+//------------------------------------------------------------------------------
+
+//! @file   MappedFile.hpp
+//! @author agent
+//! @date   2026
+
+#ifndef base_io_raw_mappedfile_hpp
+#define base_io_raw_mappedfile_hpp
+
+//------------------------------------------------------------------------------
+// std   includes
+#include <string>
+// system includes
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+// boost includes
+#include <boost/utility.hpp>
+// base includes
+#include <base/verify.hpp>
+
+//------------------------------------------------------------------------------
+namespace base{
+    namespace io{
+        namespace raw{
+
+            class MappedFile;
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+/** Read-only memory map of a complete file.
+ *  The content of the file is accessible as a contiguous range of characters
+ *  without copying it into user storage, the operating system pages it in on
+ *  demand. This allows several threads to parse different parts of a large
+ *  file concurrently.
+ *  \note Uses the POSIX mmap interface
+ */
+class base::io::raw::MappedFile
+    : public boost::noncopyable
+{
+public:
+    //! Map the file with the given name
+    MappedFile( const std::string& fileName )
+        : data_( NULL ), size_( 0 )
+    {
+        const int fd = ::open( fileName.c_str(), O_RDONLY );
+        VERIFY_MSG( fd != -1, "Cannot open file " + fileName );
+
+        struct stat info;
+        VERIFY_MSG( ::fstat( fd, &info ) == 0, "Cannot stat file " + fileName );
+        size_ = static_cast<std::size_t>( info.st_size );
+
+        if ( size_ > 0 ) {
+            void* addr = ::mmap( NULL, size_, PROT_READ, MAP_PRIVATE, fd, 0 );
+            VERIFY_MSG( addr != MAP_FAILED, "Cannot map file " + fileName );
+            data_ = static_cast<const char*>( addr );
+
+            // the file is read front to back by every thread
+            ::madvise( addr, size_, MADV_SEQUENTIAL );
+        }
+
+        ::close( fd );
+    }
+
+    ~MappedFile()
+    {
+        if ( data_ != NULL )
+            ::munmap( const_cast<char*>( data_ ), size_ );
+    }
+
+    //! @name Access to the characters
+    //@{
+    const char* begin() const { return data_; }
+    const char* end()   const { return data_ + size_; }
+    std::size_t size()  const { return size_; }
+    //@}
+
+private:
+    const char* data_; //!< Begin of the mapped range
+    std::size_t size_; //!< Number of bytes in file
+};
+
+#endif
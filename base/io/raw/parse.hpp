@@ -0,0 +1,206 @@
+//------------------------------------------------------------------------------
+// <preamble>
+// </preamble>
+//------------------------------------------------------------------------------
+
+//! @file   parse.hpp
+//! @author agent
+//! @date   2026
+
+#ifndef base_io_raw_parse_hpp
+#define base_io_raw_parse_hpp
+
+//------------------------------------------------------------------------------
+// std   includes
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+// boost includes
+#include <boost/cstdint.hpp>
+
+//------------------------------------------------------------------------------
+namespace base{
+    namespace io{
+        namespace raw{
+
+            //------------------------------------------------------------------
+            namespace detail_{
+
+                //! Exactly representable powers of ten
+                static const double exactPowersOfTen[] = {
+                    1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,
+                    1e8,  1e9,  1e10, 1e11, 1e12, 1e13, 1e14, 1e15,
+                    1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22 };
+
+                inline bool isBlank( const char c )
+                {
+                    return ( c == ' ' ) or ( c == '\t' ) or ( c == '\r' );
+                }
+
+                inline bool isDigit( const char c )
+                {
+                    return ( c >= '0' ) and ( c <= '9' );
+                }
+
+                //! Conversion of a single token by the C library
+                inline bool parseRealFallback( const char*& p, const char* end,
+                                               double& x )
+                {
+                    // copy token to a null-terminated buffer
+                    char buffer[64];
+                    std::size_t n = 0;
+                    while ( (p + n != end) and (n < sizeof(buffer)-1) and
+                            not isBlank( p[n] ) and ( p[n] != '\n' ) ) {
+                        buffer[n] = p[n]; n++;
+                    }
+                    buffer[n] = '\0';
+
+                    char* last;
+                    x = std::strtod( buffer, &last );
+                    if ( last == buffer ) return false;
+                    p += (last - buffer);
+                    return true;
+                }
+            }
+
+            //------------------------------------------------------------------
+            //! Skip blanks (but not the line end)
+            inline void skipBlanks( const char*& p, const char* end )
+            {
+                while ( (p != end) and detail_::isBlank( *p ) ) ++p;
+            }
+
+            //------------------------------------------------------------------
+            /** Parse an unsigned integer from a character range.
+             *  Leading blanks are skipped.
+             *  \param[in,out] p    Current position, on success behind number
+             *  \param[in]     end  End of the range
+             *  \param[out]    n    Parsed value
+             *  \return             Success of the parsing
+             */
+            template<typename UINT>
+            bool parseUnsigned( const char*& p, const char* end, UINT& n )
+            {
+                skipBlanks( p, end );
+                if ( (p == end) or not detail_::isDigit( *p ) ) return false;
+
+                UINT result = 0;
+                for ( ; (p != end) and detail_::isDigit( *p ); ++p )
+                    result = 10 * result + static_cast<UINT>( *p - '0' );
+                n = result;
+                return true;
+            }
+
+            //------------------------------------------------------------------
+            /** Parse a floating point number from a character range.
+             *  Numbers of the form [+-]digits[.digits][(e|E)[+-]digits] with at
+             *  most 19 significant digits whose decimal exponent is within the
+             *  range of exactly representable powers of ten are converted
+             *  directly, which is exact (i.e. gives the same result as strtod)
+             *  and locale-independent. All other tokens (e.g. very long
+             *  mantissas, extreme exponents, 'inf' or 'nan') are passed to
+             *  std::strtod.
+             *  \param[in,out] p    Current position, on success behind number
+             *  \param[in]     end  End of the range
+             *  \param[out]    x    Parsed value
+             *  \return             Success of the parsing
+             */
+            inline bool parseReal( const char*& p, const char* end, double& x )
+            {
+                skipBlanks( p, end );
+                if ( p == end ) return false;
+
+                const char* start = p;
+                const char* q     = p;
+
+                bool negative = false;
+                if      ( *q == '-' ) { negative = true; ++q; }
+                else if ( *q == '+' ) { ++q; }
+
+                boost::uint64_t mantissa = 0;
+                int  numDigits = 0;   // significant digits in mantissa
+                int  exponent  = 0;   // decimal exponent correction
+                bool anyDigit  = false;
+                bool exact     = true;
+
+                // integer part
+                for ( ; (q != end) and detail_::isDigit( *q ); ++q ) {
+                    anyDigit = true;
+                    if ( numDigits < 19 ) {
+                        mantissa = 10 * mantissa + static_cast<unsigned>( *q - '0' );
+                        if ( mantissa > 0 ) numDigits++;
+                    }
+                    else {
+                        exponent++;
+                        if ( *q != '0' ) exact = false;
+                    }
+                }
+
+                // fractional part
+                if ( (q != end) and (*q == '.') ) {
+                    ++q;
+                    for ( ; (q != end) and detail_::isDigit( *q ); ++q ) {
+                        anyDigit = true;
+                        if ( numDigits < 19 ) {
+                            mantissa = 10 * mantissa +
+                                static_cast<unsigned>( *q - '0' );
+                            if ( mantissa > 0 ) numDigits++;
+                            exponent--;
+                        }
+                        else if ( *q != '0' ) exact = false;
+                    }
+                }
+
+                if ( not anyDigit ) {
+                    p = start;
+                    return detail_::parseRealFallback( p, end, x );
+                }
+
+                // exponent part
+                if ( (q != end) and ( (*q == 'e') or (*q == 'E') ) ) {
+                    const char* r = q + 1;
+                    bool negExp = false;
+                    if      ( (r != end) and (*r == '-') ) { negExp = true; ++r; }
+                    else if ( (r != end) and (*r == '+') ) { ++r; }
+
+                    if ( (r != end) and detail_::isDigit( *r ) ) {
+                        int e = 0;
+                        for ( ; (r != end) and detail_::isDigit( *r ); ++r )
+                            if ( e < 100000 ) e = 10 * e + ( *r - '0' );
+                        exponent += ( negExp ? -e : e );
+                        q = r;
+                    }
+                }
+
+                // fast path: exact mantissa and exact power of ten
+                static const boost::uint64_t maxExact =
+                    static_cast<boost::uint64_t>(1) << 53;
+                if ( exact and (mantissa <= maxExact) and
+                     (exponent >= -22) and (exponent <= 22) ) {
+                    double value = static_cast<double>( mantissa );
+                    if ( exponent < 0 ) value /= detail_::exactPowersOfTen[-exponent];
+                    else                value *= detail_::exactPowersOfTen[ exponent];
+                    x = ( negative ? -value : value );
+                    p = q;
+                    return true;
+                }
+
+                p = start;
+                return detail_::parseRealFallback( p, end, x );
+            }
+
+            //------------------------------------------------------------------
+            //! Position behind the next line end (or end of range)
+            inline const char* nextLine( const char* p, const char* end )
+            {
+                const void* nl = std::memchr( p, '\n',
+                                              static_cast<std::size_t>( end - p ) );
+                if ( nl == NULL ) return end;
+                return static_cast<const char*>( nl ) + 1;
+            }
+
+        }
+    }
+}
+
+#endif
@@ -13,13 +13,21 @@
 //------------------------------------------------------------------------------
 // std   includes
 #include <istream>
+#include <fstream>
 #include <limits>
+#include <string>
 #include <vector>
 // boost includes
 #include <boost/array.hpp>
 // base includes
 #include <base/verify.hpp>
 #include <base/MultiIndex.hpp>
+// base/io includes
+#include <base/io/Format.hpp>
+// base/io/raw includes
+#include <base/io/raw/parse.hpp>
+#include <base/io/raw/MappedFile.hpp>
+#include <base/io/raw/ChunkedRows.hpp>
 
 //------------------------------------------------------------------------------
 namespace base{
@@ -36,8 +44,20 @@ namespace base{
                 reader( grid, sgf );
             }
 
+            //! Convenenience function for the parallel reading from a file
+            template<typename GRID>
+            void readGridFromFile( const std::string& fileName, GRID& grid )
+            {
+                Reader<GRID> reader;
+                reader( grid, fileName );
+            }
+
             namespace detail_{
 
+                //! Parse coordinate rows in parallel
+                template<unsigned DIM, typename VECDIM>
+                class ParseCoordinateRows;
+
                 //! Copy in- to output
                 template<unsigned DIM>
                 struct PlainNodeCopy;
@@ -191,6 +211,36 @@ public:
         
     }
 
+    /** Parallel reading from a file.
+     *  The coordinates are parsed from a memory map of the file by several
+     *  threads, see base::io::raw::ChunkedRows.
+     *  \param[out] grid      Grid to be read
+     *  \param[in]  fileName  Name of the SGF file
+     */
+    void operator()( Grid & grid, const std::string& fileName ) const
+    {
+        std::size_t dataOffset;
+        {
+            std::ifstream sgf( fileName.c_str() );
+            VERIFY_MSG( sgf.is_open(), "Failed to open " + fileName );
+            
+            // Read grid dimensions from stream
+            const MIT gridSize = this -> readGridSize( sgf );
+            dataOffset = static_cast<std::size_t>( sgf.tellg() );
+
+            // Allocate grid
+            grid.allocate( gridSize );
+        }
+
+        // Read coordinates and set grid nodes
+        base::io::raw::MappedFile file( fileName );
+        VERIFY_MSG( dataOffset <= file.size(), "Sgf file is truncated" );
+        this -> readAndSetNodes_( grid, file.begin() + dataOffset, file.end() );
+
+        // Pass node pointers to elements
+        this -> setElements_( grid );
+    }
+
 private:
     // Read the first three numbers of the grid file for grid sizes
     MIT readGridSize( std::istream & sgf ) const
@@ -247,6 +297,42 @@ private:
             nodesFromFile[n] = x;
         }
 
+        this -> setNodes_( grid, nodesFromFile );
+        return;
+    }
+
+    //--------------------------------------------------------------------------
+    // Read the nodes from a memory map of the grid file in parallel
+    void readAndSetNodes_( Grid & grid, const char* begin, const char* end ) const
+    {
+        // The total number of nodes in this grid
+        const std::size_t numNodes =
+            Grid::MultiIndex::length( grid.gridSizes() + 1 );
+
+        // Vector of nodes to be read from file
+        std::vector<typename Grid::Node::VecDim> nodesFromFile( numNodes );
+
+        // Parse rows in parallel
+        base::io::raw::ChunkedRows rows( begin, end );
+        VERIFY_MSG( rows.numRows() >= numNodes,
+                    "Sgf file has " + x2s( rows.numRows() ) +
+                    " coordinate rows, but " + x2s( numNodes ) + " are expected" );
+        detail_::ParseCoordinateRows<coordDim,typename Grid::Node::VecDim>
+            parseRows( nodesFromFile );
+        rows.apply( parseRows );
+
+        this -> setNodes_( grid, nodesFromFile );
+        return;
+    }
+
+    //--------------------------------------------------------------------------
+    // Create the grid nodes from the nodes given in the file
+    void setNodes_( Grid & grid,
+                    std::vector<typename Grid::Node::VecDim>& nodesFromFile ) const
+    {
+        // The sizes of the grid -> determines the number of points in the file
+        const typename Grid::MultiIndexType gridSizes = grid.gridSizes();
+
         // Grid's node accessor
         typename Grid::NodePtrIter nodeIter = grid.nodesBegin();
         typename Grid::NodePtrIter nodeEnd  = grid.nodesEnd();
@@ -536,4 +622,29 @@ struct base::io::sgf::detail_::CreateGridNodesFromLagrangian
 };
 
 
+//------------------------------------------------------------------------------
+/** Row operator for parallel reading of the coordinates of a sgf file.
+ *  \tparam DIM    Number of coordinates to read per row
+ *  \tparam VECDIM Type of coordinate vector
+ */
+template<unsigned DIM, typename VECDIM>
+class base::io::sgf::detail_::ParseCoordinateRows
+{
+public:
+    ParseCoordinateRows( std::vector<VECDIM>& nodes )
+        : nodes_( nodes ) { }
+
+    void operator()( const std::size_t row, const char* p, const char* end )
+    {
+        if ( row >= nodes_.size() ) return;
+        
+        for ( unsigned d = 0; d < DIM; d++ )
+            VERIFY_MSG( base::io::raw::parseReal( p, end, nodes_[row][d] ),
+                        "Cannot read coordinate of node " + x2s( row ) );
+    }
+
+private:
+    std::vector<VECDIM>& nodes_;
+};
+
 #endif
@@ -16,16 +16,22 @@
 #include <fstream>
 #include <limits>
 #include <vector>
+#include <string>
 // boost includes
+#include <boost/array.hpp>
 #include <boost/algorithm/string/case_conv.hpp>
 #include <boost/lexical_cast.hpp>
 #include <boost/tokenizer.hpp>
 // base includes
 #include <base/shape.hpp>
+#include <base/auxi/Profiler.hpp>
 // base/io includes
 #include <base/io/Format.hpp> 
 // base/io/raw includes
 #include <base/io/raw/ascii.hpp>
+#include <base/io/raw/parse.hpp>
+#include <base/io/raw/MappedFile.hpp>
+#include <base/io/raw/ChunkedRows.hpp>
 
 //------------------------------------------------------------------------------
 namespace base{
@@ -43,6 +49,15 @@ namespace base{
                 reader( mesh, smf );
             }
 
+            //------------------------------------------------------------------
+            //! Convenenience function for the parallel reading from a file
+            template<typename MESH>
+            void readMeshFromFile( const std::string& fileName, MESH& mesh )
+            {
+                Reader<MESH> reader;
+                reader( mesh, fileName );
+            }
+
             //------------------------------------------------------------------
             namespace detail_{
                 
@@ -76,6 +91,10 @@ namespace base{
                     }
                 };
                 
+                //! Parse node and element rows of a (part of a) smf file
+                template<typename MESH>
+                class ParseRows;
+                
             } //namespace detail_
         }
     }
@@ -114,6 +133,7 @@ public:
      */
     void operator()( Mesh & mesh, std::istream & smf ) const
     {
+        PROFILE_REGION( "smf::read" );
         // Read header and validate it
         std::pair<bool,std::string> externalNodes    = std::make_pair( false, "");
         std::pair<bool,std::string> externalElements = std::make_pair( false, "");
@@ -156,6 +176,62 @@ public:
             this -> readAndSetElements_( smf, mesh );
     }
 
+    //--------------------------------------------------------------------------
+    /** Parallel reading from a file.
+     *  The header is read as above, but the numbers are parsed from a memory
+     *  map of the file(s) which is split into chunks of lines, see
+     *  base::io::raw::ChunkedRows. Every thread parses its chunks with the
+     *  locale-independent number parsers of base/io/raw/parse.hpp and writes
+     *  directly into the preallocated mesh storage.
+     *  \param[out] mesh      The mesh constructed from the file input
+     *  \param[in]  fileName  Name of the SMF file
+     */
+    void operator()( Mesh & mesh, const std::string& fileName ) const
+    {
+        PROFILE_REGION( "smf::readFromFile" );
+        std::size_t dataOffset;
+        std::pair<bool,std::string> externalNodes    = std::make_pair( false, "");
+        std::pair<bool,std::string> externalElements = std::make_pair( false, "");
+        unsigned nNodes, nElements;
+        {
+            std::ifstream smf( fileName.c_str() );
+            VERIFY_MSG( smf.is_open(), "Failed to open " + fileName );
+            
+            const bool validHeader =
+                this -> readAndValidateHeader_( smf, externalNodes, externalElements );
+            VERIFY_MSG( validHeader, "Smf header is invalid" );
+
+            this -> readNumbers_( smf, nNodes, nElements );
+            dataOffset = static_cast<std::size_t>( smf.tellg() );
+        }
+        mesh.allocate( nNodes, nElements );
+
+        // rows in the smf file itself: [nodes] [elements]
+        const std::size_t numInlineNodes = ( externalNodes.first    ? 0 : nNodes );
+        const std::size_t numInlineElems = ( externalElements.first ? 0 : nElements );
+        {
+            base::io::raw::MappedFile file( fileName );
+            VERIFY_MSG( dataOffset <= file.size(), "Smf file is truncated" );
+            detail_::ParseRows<Mesh>
+                parseRows( mesh, numInlineNodes, numInlineElems );
+            parseRows.apply( file.begin() + dataOffset, file.end() );
+        }
+
+        // external node file
+        if ( externalNodes.first ) {
+            base::io::raw::MappedFile file( externalNodes.second );
+            detail_::ParseRows<Mesh> parseRows( mesh, nNodes, 0 );
+            parseRows.apply( file.begin(), file.end() );
+        }
+
+        // external element file
+        if ( externalElements.first ) {
+            base::io::raw::MappedFile file( externalElements.second );
+            detail_::ParseRows<Mesh> parseRows( mesh, 0, nElements );
+            parseRows.apply( file.begin(), file.end() );
+        }
+    }
+    
 private:
     
     // Read number of nodes and elements and allocate the mesh
@@ -208,7 +284,7 @@ private:
             getline( smf, line );
 
             // use only white space characters as seperators
-            boost::char_separator<char> sep( " " ); 
+            boost::char_separator<char> sep( " \t\r" );
             typedef boost::tokenizer< boost::char_separator<char> > Token;
             Token tokens( line, sep );
             Token::iterator iter = tokens.begin();
@@ -310,4 +386,71 @@ private:
     }
 
 };
+
+//------------------------------------------------------------------------------
+/** Row operator for the parallel reading of smf data.
+ *  The first numNodes rows are node coordinates and the following numElements
+ *  rows are element connectivities, additional rows are ignored. As in the
+ *  stream-based reader, only the first Node::dim coordinates of a row are
+ *  used and trailing entries of a row are ignored.
+ *  \tparam MESH Type of mesh
+ */
+template<typename MESH>
+class base::io::smf::detail_::ParseRows
+{
+public:
+    typedef MESH Mesh;
+    static const unsigned coordDim         = Mesh::Node::dim;
+    static const unsigned nNodesPerElement = Mesh::Element::numNodes;
+
+    ParseRows( Mesh& mesh, const std::size_t numNodes,
+               const std::size_t numElements )
+        : mesh_( mesh ), numNodes_( numNodes ), numElements_( numElements )
+    { }
+
+    //! Chunk the range and parse all rows
+    void apply( const char* begin, const char* end )
+    {
+        base::io::raw::ChunkedRows rows( begin, end );
+        VERIFY_MSG( rows.numRows() >= numNodes_ + numElements_,
+                    "Smf data has " + x2s( rows.numRows() ) + " rows, but " +
+                    x2s( numNodes_ + numElements_ ) + " are expected" );
+        rows.apply( *this );
+    }
+
+    //! Parse one row
+    void operator()( const std::size_t row, const char* p, const char* end )
+    {
+        if ( row < numNodes_ ) {
+            boost::array<double,coordDim> x;
+            for ( unsigned d = 0; d < coordDim; d++ )
+                VERIFY_MSG( base::io::raw::parseReal( p, end, x[d] ),
+                            "Cannot read coordinate of node " + x2s( row ) );
+
+            typename Mesh::Node* node = mesh_.nodePtr( row );
+            node -> setX( x.begin() );
+            node -> setID( row );
+        }
+        else if ( row < numNodes_ + numElements_ ) {
+            const std::size_t elemID = row - numNodes_;
+            typename Mesh::Element* element = mesh_.elementPtr( elemID );
+
+            typename Mesh::Element::NodePtrIter elemNIter = element -> nodesBegin();
+            for ( unsigned n = 0; n < nNodesPerElement; n++, ++elemNIter ) {
+                std::size_t vertexID;
+                VERIFY_MSG( base::io::raw::parseUnsigned( p, end, vertexID ),
+                            "Cannot read connectivity of element " + x2s( elemID ) );
+                *elemNIter = mesh_.nodePtr( vertexID );
+            }
+
+            element -> setID( elemID );
+        }
+    }
+
+private:
+    Mesh&             mesh_;
+    const std::size_t numNodes_;
+    const std::size_t numElements_;
+};
+
 #endif
@@ -64,6 +64,15 @@
  *    _Note_ that `nNodes` and `nElements`  _always_ appear in the main
  *    smf file are not repeated in an external file.
  *
+ *    Reading large files
+ *    -------------------
+ *
+ *    Besides the stream-based base::io::smf::readMesh, the function
+ *    base::io::smf::readMeshFromFile maps the file(s) into memory and parses
+ *    nodes and elements with several threads (see base::io::raw::ChunkedRows).
+ *    Numbers are converted without the C++ stream machinery and independently
+ *    of the locale. The number of threads is given by `NTHREADS`.
+ *
  *    ASCII-art element types
  *    -----------------------
  *
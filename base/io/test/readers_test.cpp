@@ -0,0 +1,124 @@
+#include <string>
+#include <fstream>
+#include <cstdio>
+#include <iterator>
+#include <boost/test/minimal.hpp>
+
+#include <base/Unstructured.hpp>
+#include <base/Structured.hpp>
+#include <base/io/smf/Reader.hpp>
+#include <base/io/sgf/Reader.hpp>
+
+//! \cond SKIPDOX
+typedef base::Unstructured<base::QUAD,1> Mesh;
+typedef base::Structured<2,1>            Grid;
+
+// CRLF line ends, tabs, trailing blanks, an empty line and numbers in various
+// notations, including a mantissa which is too long for the direct parser
+const char smfText[] =
+    "# small test mesh\r\n"
+    "! elementShape quadrilateral \r\n"
+    "! elementNumPoints 4\r\n"
+    "6 2\r\n"
+    "0 0\r\n"
+    ".5\t-0.0  \r\n"
+    "1.E0 +0\t\r\n"
+    "  0 0.333333333333333314829616256247390992939472198486328125\r\n"
+    "\r\n"
+    "5e-1 1 \r\n"
+    "1 1.0000000000000002\r\n"
+    "0 1 4 3 \r\n"
+    "1\t2 5 4\r\n";
+
+const char sgfText[] =
+    "# small test grid\r\n"
+    "2 1 0 \r\n"
+    "0 0 0\r\n"
+    "0.25E+1 -1.5e-3 0 \r\n"
+    "+7 .125\t0\r\n"
+    "0 1.0000000000000002 0\r\n"
+    "   2.5 0.1 0  \r\n"
+    "7 1e22 0\r\n";
+
+// write a file in binary mode in order to keep the CRLF line ends
+void writeFile( const std::string& fileName, const char* text )
+{
+    std::ofstream out( fileName.c_str(), std::ios::binary );
+    out << text;
+}
+
+// compare coordinates (bitwise) and connectivity of two meshes
+template<typename MESH>
+bool sameMesh( MESH& a, MESH& b )
+{
+    if ( std::distance( a.nodesBegin(), a.nodesEnd() ) !=
+         std::distance( b.nodesBegin(), b.nodesEnd() ) ) return false;
+    if ( std::distance( a.elementsBegin(), a.elementsEnd() ) !=
+         std::distance( b.elementsBegin(), b.elementsEnd() ) ) return false;
+
+    typename MESH::NodePtrIter nA = a.nodesBegin();
+    typename MESH::NodePtrIter nB = b.nodesBegin();
+    for ( ; nA != a.nodesEnd(); ++nA, ++nB ) {
+        if ( (*nA) -> getID() != (*nB) -> getID() ) return false;
+        for ( unsigned d = 0; d < MESH::Node::dim; d++ )
+            if ( (*nA) -> getX()[d] != (*nB) -> getX()[d] ) return false;
+    }
+
+    typename MESH::ElementPtrIter eA = a.elementsBegin();
+    typename MESH::ElementPtrIter eB = b.elementsBegin();
+    for ( ; eA != a.elementsEnd(); ++eA, ++eB ) {
+        if ( (*eA) -> getID() != (*eB) -> getID() ) return false;
+        typename MESH::Element::NodePtrIter vA = (*eA) -> nodesBegin();
+        typename MESH::Element::NodePtrIter vB = (*eB) -> nodesBegin();
+        for ( ; vA != (*eA) -> nodesEnd(); ++vA, ++vB )
+            if ( (*vA) -> getID() != (*vB) -> getID() ) return false;
+    }
+    return true;
+}
+
+int test_main( int, char *[] )
+{
+    // smf: stream reader versus memory-mapped reader
+    {
+        const std::string fileName = "readers_test.smf";
+        writeFile( fileName, smfText );
+
+        Mesh streamMesh, mappedMesh;
+        {
+            std::ifstream smf( fileName.c_str() );
+            base::io::smf::readMesh( smf, streamMesh );
+        }
+        base::io::smf::readMeshFromFile( fileName, mappedMesh );
+        std::remove( fileName.c_str() );
+
+        BOOST_CHECK( sameMesh( streamMesh, mappedMesh ) );
+
+        // spot checks of the parsed values
+        BOOST_CHECK( mappedMesh.nodePtr( 1 ) -> getX()[0] == 0.5 );
+        BOOST_CHECK( mappedMesh.nodePtr( 3 ) -> getX()[1] == 1. / 3. );
+        BOOST_CHECK( mappedMesh.nodePtr( 5 ) -> getX()[1] > 1. );
+        BOOST_CHECK( mappedMesh.elementPtr( 1 ) -> nodePtr( 3 ) ==
+                     mappedMesh.nodePtr( 4 ) );
+    }
+
+    // sgf: stream reader versus memory-mapped reader
+    {
+        const std::string fileName = "readers_test.sgf";
+        writeFile( fileName, sgfText );
+
+        Grid streamGrid, mappedGrid;
+        {
+            std::ifstream sgf( fileName.c_str() );
+            base::io::sgf::readGrid( sgf, streamGrid );
+        }
+        base::io::sgf::readGridFromFile( fileName, mappedGrid );
+        std::remove( fileName.c_str() );
+
+        BOOST_CHECK( sameMesh( streamGrid, mappedGrid ) );
+        BOOST_CHECK( std::distance( mappedGrid.elementsBegin(),
+                                    mappedGrid.elementsEnd() ) == 2 );
+    }
+
+    return 0;
+}
+//! \endcond
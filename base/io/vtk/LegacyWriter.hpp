@@ -11,6 +11,8 @@
 #define base_io_vtk_legacywriter_hpp
 
 //------------------------------------------------------------------------------
+// base/auxi includes
+#include <base/auxi/Profiler.hpp>
 // base/mesh includes
 #include <base/mesh/sampleStructured.hpp>
 // base/io includes
@@ -150,6 +152,7 @@ private:
 template<typename MESH>
 void base::io::vtk::LegacyWriter::writeUnstructuredGrid( const MESH& mesh )
 {
+    PROFILE_REGION( "vtk::writeUnstructuredGrid" );
     // node range iterators and distance
     typename MESH::NodePtrConstIter node    = mesh.nodesBegin();
     typename MESH::NodePtrConstIter nodeEnd = mesh.nodesEnd();
@@ -262,6 +265,7 @@ void base::io::vtk::LegacyWriter::writeData_( VALITER first,
                                               const std::string & name,
                                               const bool isCellData )
 {
+    PROFILE_REGION( "vtk::writeData" );
     // Deduce type of point datum
     typedef typename std::iterator_traits<VALITER>::value_type DoFValue;
     
@@ -11,6 +11,9 @@
 #define base_linearalgebra_hpp
 
 //------------------------------------------------------------------------------
+// std includes
+#include <cmath>
+#include <algorithm>
 // eigen3 includes
 #include <Eigen/Core>
 #include <Eigen/Dense>
@@ -175,8 +178,231 @@ namespace base{
     }
 
 
+    //--------------------------------------------------------------------------
+    namespace detail_{
+
+        template<unsigned SIZE> struct SymmetricEigen;
+
+        //! Trivial case of a 1x1 matrix
+        template<>
+        struct SymmetricEigen<1>
+        {
+            template<typename MAT>
+            static typename base::Vector<1>::Type apply( const MAT& A, MAT* X )
+            {
+                if ( X != NULL ) (*X)( 0, 0 ) = 1.;
+                typename base::Vector<1>::Type result;
+                result[0] = A( 0, 0 );
+                return result;
+            }
+        };
+
+        /** Closed-form eigen-decomposition of a symmetric 2x2 matrix.
+         *  The eigenvector of the larger eigenvalue is computed from the row
+         *  of \f$ A - \lambda I \f$ with the larger entries, the second one
+         *  is its orthogonal complement. For \f$ A = a I \f$ the result is
+         *  the identity.
+         */
+        template<>
+        struct SymmetricEigen<2>
+        {
+            template<typename MAT>
+            static typename base::Vector<2>::Type apply( const MAT& A, MAT* X )
+            {
+                const double a = A( 0, 0 ), b = A( 0, 1 ), c = A( 1, 1 );
+                const double mean = 0.5 * ( a + c );
+                const double diff = 0.5 * ( a - c );
+                const double root = std::sqrt( diff * diff + b * b );
+
+                // ascending order
+                typename base::Vector<2>::Type result;
+                result[0] = mean - root;
+                result[1] = mean + root;
+
+                if ( X != NULL ) {
+                    // eigenvector of the larger eigenvalue
+                    double v0, v1;
+                    if ( a >= c ) { v0 = diff + root; v1 = b; }
+                    else          { v0 = b;           v1 = root - diff; }
+                    const double length = std::sqrt( v0 * v0 + v1 * v1 );
+                    if ( length > 0. ) { v0 /= length; v1 /= length; }
+                    else               { v0 = 1.;      v1 = 0.; }
+
+                    (*X)( 0, 0 ) = -v1; (*X)( 0, 1 ) = v0;
+                    (*X)( 1, 0 ) =  v0; (*X)( 1, 1 ) = v1;
+                }
+                return result;
+            }
+        };
+
+        /** Closed-form eigen-decomposition of a symmetric 3x3 matrix.
+         *  After scaling by the largest entry, the eigenvalues are given by
+         *  the trigonometric solution of the characteristic polynomial
+         *  (Smith, 1961). The eigenvector of the eigenvalue which is best
+         *  separated from the other two is the largest cross product of two
+         *  rows of \f$ A - \lambda I \f$. The matrix is then projected onto
+         *  the orthogonal complement of this vector and the remaining pair
+         *  follows from the 2x2 solution. Close to a double eigenvalue, this
+         *  is also done if only the eigenvalues are requested. Hence, double eigenvalues yield an
+         *  orthonormal basis of their eigenspace. If all cross products are
+         *  negligible compared to \f$ p^4 \f$ (the scaled spread of the
+         *  eigenvalues to the fourth), the eigenvalues are equal up to
+         *  round-off; then the coordinate axes are taken as eigenvectors and
+         *  the diagonal entries as eigenvalues.
+         */
+        template<>
+        struct SymmetricEigen<3>
+        {
+            typedef base::Vector<3>::Type  Vec;
+
+            template<typename MAT>
+            static Vec apply( const MAT& A, MAT* X )
+            {
+                // scaling to avoid over- and underflow
+                double scale = 0.;
+                for ( unsigned i = 0; i < 3; i++ )
+                    for ( unsigned j = i; j < 3; j++ )
+                        scale = std::max( scale, std::abs( A(i,j) ) );
+
+                Vec result;
+                if ( scale == 0. ) {
+                    result.setZero();
+                    if ( X != NULL ) X -> setIdentity();
+                    return result;
+                }
+
+                const double b00 = A(0,0) / scale, b11 = A(1,1) / scale;
+                const double b22 = A(2,2) / scale, b01 = A(0,1) / scale;
+                const double b02 = A(0,2) / scale, b12 = A(1,2) / scale;
+
+                // shift by the mean eigenvalue and scale: C = (B - qI)/p
+                const double q  = ( b00 + b11 + b22 ) / 3.;
+                const double c00 = b00 - q, c11 = b11 - q, c22 = b22 - q;
+                const double p2 = ( c00*c00 + c11*c11 + c22*c22 +
+                                    2. * ( b01*b01 + b02*b02 + b12*b12 ) ) / 6.;
+                const double p  = std::sqrt( p2 );
+
+                if ( p == 0. ) {
+                    result.setConstant( q * scale );
+                    if ( X != NULL ) X -> setIdentity();
+                    return result;
+                }
+
+                // half the determinant of C, bounded to [-1,1]
+                const double detC =
+                    c00 * ( c11 * c22 - b12 * b12 ) -
+                    b01 * ( b01 * c22 - b12 * b02 ) +
+                    b02 * ( b01 * b12 - c11 * b02 );
+                const double r = std::max( -1., std::min( 1., detC / (2.*p*p2) ) );
+                const double phi = std::acos( r ) / 3.;
+
+                // eigenvalues in ascending order
+                const double lMax = q + 2. * p * std::cos( phi );
+                const double lMin = q + 2. * p * std::cos( phi + 2. * M_PI / 3. );
+                const double lMid =
+                    std::max( lMin, std::min( lMax, 3. * q - lMax - lMin ) );
+                result[0] = lMin * scale;
+                result[1] = lMid * scale;
+                result[2] = lMax * scale;
+
+                // near a double root, the trigonometric solution only has
+                // half the precision: refine with the eigenvectors
+                MAT localX;
+                if ( X == NULL ) {
+                    if ( std::abs( r ) < 1. - 1.e-4 ) return result;
+                    X = &localX;
+                }
+
+                // eigenvalue with largest distance to the others
+                const bool maxFirst = ( lMax - lMid >= lMid - lMin );
+                const double l1 = ( maxFirst ? lMax : lMin );
+                const unsigned pos1 = ( maxFirst ? 2 : 0 );
+
+                // rows of B - l1 I and their cross products
+                const Vec r0( b00 - l1, b01, b02 );
+                const Vec r1( b01, b11 - l1, b12 );
+                const Vec r2( b02, b12, b22 - l1 );
+                const Vec x01 = r0.cross( r1 );
+                const Vec x02 = r0.cross( r2 );
+                const Vec x12 = r1.cross( r2 );
+                const double n01 = x01.squaredNorm();
+                const double n02 = x02.squaredNorm();
+                const double n12 = x12.squaredNorm();
+
+                // (nearly) triple eigenvalue: in exact arithmetic, the
+                // largest cross product is at least 12 p^4
+                const double nMax = std::max( n01, std::max( n02, n12 ) );
+                if ( ( nMax == 0. ) or ( nMax < 1.e-2 * p2 * p2 ) ) {
+                    X -> setIdentity();
+                    result[0] = A( 0, 0 );
+                    result[1] = A( 1, 1 );
+                    result[2] = A( 2, 2 );
+                    sortPairs_( result, *X );
+                    return result;
+                }
+
+                Vec v1;
+                if      ( n01 >= n02 and n01 >= n12 ) v1 = x01 / std::sqrt( n01 );
+                else if ( n02 >= n12 )                v1 = x02 / std::sqrt( n02 );
+                else                                  v1 = x12 / std::sqrt( n12 );
+
+                // orthonormal basis u, w of the complement of v1
+                Vec u;
+                if ( std::abs( v1[0] ) > std::abs( v1[1] ) )
+                    u = Vec( -v1[2], 0., v1[0] ) /
+                        std::sqrt( v1[0]*v1[0] + v1[2]*v1[2] );
+                else
+                    u = Vec( 0., v1[2], -v1[1] ) /
+                        std::sqrt( v1[1]*v1[1] + v1[2]*v1[2] );
+                const Vec w = v1.cross( u );
+
+                // projected 2x2 problem
+                base::Matrix<3,3>::Type B;
+                B << b00, b01, b02, b01, b11, b12, b02, b12, b22;
+                const Vec Bu = B * u, Bw = B * w;
+                base::Matrix<2,2>::Type M, Y;
+                M( 0, 0 ) = u.dot( Bu );
+                M( 0, 1 ) = M( 1, 0 ) = u.dot( Bw );
+                M( 1, 1 ) = w.dot( Bw );
+                const base::Vector<2>::Type l23 = SymmetricEigen<2>::apply( M, &Y );
+
+                // the 2x2 eigenvalues are in ascending order as well
+                const unsigned pos2 = ( maxFirst ? 0 : 1 );
+                const unsigned pos3 = ( maxFirst ? 1 : 2 );
+                X -> col( pos1 ) = v1;
+                X -> col( pos2 ) = Y( 0, 0 ) * u + Y( 1, 0 ) * w;
+                X -> col( pos3 ) = Y( 0, 1 ) * u + Y( 1, 1 ) * w;
+
+                // Rayleigh quotients are more accurate for close eigenvalues
+                result[pos1] = v1.dot( B * v1 ) * scale;
+                result[pos2] = l23[0] * scale;
+                result[pos3] = l23[1] * scale;
+
+                // restore the order, which round-off may have violated
+                sortPairs_( result, *X );
+                return result;
+            }
+
+        private:
+            //! Sort eigenvalues ascendingly together with the eigenvectors
+            template<typename MAT>
+            static void sortPairs_( Vec& values, MAT& X )
+            {
+                for ( unsigned i = 0; i < 2; i++ ) {
+                    for ( unsigned j = 0; j < 2 - i; j++ ) {
+                        if ( values[j] > values[j+1] ) {
+                            std::swap( values[j], values[j+1] );
+                            X.col( j ).swap( X.col( j+1 ) );
+                        }
+                    }
+                }
+            }
+        };
+    }
+
     //--------------------------------------------------------------------------
     /** Compute all eigenvalues of a given symmetric matrix.
+     *  The eigenvalues are returned in ascending order.
      *  \tparam MAT Type of matrix to operate on (size <= 3)
      */
     template<typename MAT>
@@ -186,15 +412,14 @@ namespace base{
         
         STATIC_ASSERT_MSG( numRows == MatCols<MAT>::value, "Matrix must be square" );
         STATIC_ASSERT_MSG( numRows <= 3, "Direct computation only for N<=3" );
-        
-        Eigen::SelfAdjointEigenSolver<MAT> es( numRows );
-        es.computeDirect( A, Eigen::EigenvaluesOnly );
-        const typename base::Vector<numRows>::Type result = es.eigenvalues();
-        return result;
+
+        return detail_::SymmetricEigen<numRows>::apply( A, static_cast<MAT*>( NULL ) );
     }
 
     //--------------------------------------------------------------------------
     /** Compute all eigenvalues and eigenvectors of a given symmetric matrix.
+     *  The eigenvalues are returned in ascending order and the columns of
+     *  X are the corresponding orthonormal eigenvectors.
      *  \tparam MAT Type of matrix to operate on (size <= 3)
      */
     template<typename MAT>
@@ -205,12 +430,8 @@ namespace base{
         
         STATIC_ASSERT_MSG( numRows == MatCols<MAT>::value, "Matrix must be square" );
         STATIC_ASSERT_MSG( numRows <= 3, "Direct computation only for N<=3" );
-        
-        Eigen::SelfAdjointEigenSolver<MAT> es( numRows );
-        es.computeDirect( A, Eigen::ComputeEigenvectors );
-        const typename base::Vector<numRows>::Type result = es.eigenvalues();
-        X = es.eigenvectors();
-        return result;
+
+        return detail_::SymmetricEigen<numRows>::apply( A, &X );
     }
 
     //--------------------------------------------------------------------------
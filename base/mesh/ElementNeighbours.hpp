@@ -0,0 +1,130 @@
+//------------------------------------------------------------------------------
+// <preamble>
+// </preamble>
+//------------------------------------------------------------------------------
+
+//! @file   ElementNeighbours.hpp
+//! @author agent
+//! @date   2026
+
+#ifndef base_mesh_elementneighbours_hpp
+#define base_mesh_elementneighbours_hpp
+
+//------------------------------------------------------------------------------
+// std  includes
+#include <map>
+#include <vector>
+#include <iterator>
+// boost includes
+#include <boost/utility.hpp>
+// base includes
+#include <base/shape.hpp>
+#include <base/types.hpp>
+// base/auxi includes
+#include <base/auxi/SortArray.hpp>
+// base/mesh includes
+#include <base/mesh/FaceIterator.hpp>
+
+//------------------------------------------------------------------------------
+namespace base{
+    namespace mesh{
+
+        class ElementNeighbours;
+    }
+}
+
+//------------------------------------------------------------------------------
+/** Storage of the face neighbours of every element of a mesh.
+ *  Two elements are neighbours if they share a face of one dimension lower,
+ *  the faces are identified by their sorted vertex numbers as in
+ *  createBoundaryFromUnstructured(). The neighbour IDs of all elements are
+ *  stored consecutively with an offset per element (compressed storage), the
+ *  element IDs are assumed to be the positions in the given range.
+ */
+class base::mesh::ElementNeighbours
+    : boost::noncopyable
+{
+public:
+    //! Iterator over the neighbours of an element
+    typedef std::vector<std::size_t>::const_iterator NeighbourIter;
+
+    //--------------------------------------------------------------------------
+    /** Create the neighbour lists of the elements.
+     *  \param[in] first, last  Range of elements
+     *  \tparam EITER Type of element iterator
+     */
+    template<typename EITER>
+    void create( EITER first, EITER last )
+    {
+        typedef typename base::TypeReduction<
+            typename std::iterator_traits<EITER>::value_type>::Type Element;
+        static const base::NFace surface =
+            base::ShapeSurface<Element::shape>::value;
+        typedef base::mesh::FaceIterator<EITER,surface> FaceIter;
+        typedef typename FaceIter::Face                 Face;
+
+        const std::size_t numElements = std::distance( first, last );
+
+        // collect the pairs of elements sharing a face
+        std::vector< std::pair<std::size_t,std::size_t> > pairs;
+        {
+            typedef std::map<Face,std::size_t> FaceMap;
+            FaceMap faceMap;
+
+            FaceIter faceIter = FaceIter( first );
+            FaceIter faceEnd  = FaceIter( last  );
+            for ( ; faceIter != faceEnd; ++faceIter ) {
+
+                Face faceSorted = *faceIter;
+                base::auxi::SortArray<Face>::apply( faceSorted );
+
+                const std::size_t elemID =
+                    (*( faceIter.elementIterator() )) -> getID();
+
+                typename FaceMap::iterator check = faceMap.find( faceSorted );
+                if ( check == faceMap.end() )
+                    faceMap.insert( std::make_pair( faceSorted, elemID ) );
+                else {
+                    pairs.push_back( std::make_pair( check -> second, elemID ) );
+                    faceMap.erase( check );
+                }
+            }
+        }
+
+        // compressed storage
+        offsets_.assign( numElements + 1, 0 );
+        for ( std::size_t p = 0; p < pairs.size(); p++ ) {
+            offsets_[ pairs[p].first  + 1 ]++;
+            offsets_[ pairs[p].second + 1 ]++;
+        }
+        for ( std::size_t e = 0; e < numElements; e++ )
+            offsets_[e+1] += offsets_[e];
+
+        neighbours_.resize( offsets_[ numElements ] );
+        std::vector<std::size_t> fill( offsets_.begin(), offsets_.end()-1 );
+        for ( std::size_t p = 0; p < pairs.size(); p++ ) {
+            neighbours_[ fill[ pairs[p].first  ]++ ] = pairs[p].second;
+            neighbours_[ fill[ pairs[p].second ]++ ] = pairs[p].first;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    //! @name Access to the neighbours of an element
+    //@{
+    NeighbourIter begin( const std::size_t elemID ) const
+    {
+        return neighbours_.begin() + offsets_[ elemID ];
+    }
+
+    NeighbourIter end( const std::size_t elemID ) const
+    {
+        return neighbours_.begin() + offsets_[ elemID + 1 ];
+    }
+    //@}
+
+private:
+    std::vector<std::size_t> offsets_;    //!< Start of an element's list
+    std::vector<std::size_t> neighbours_; //!< Neighbour IDs of all elements
+};
+
+#endif
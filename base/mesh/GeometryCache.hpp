@@ -0,0 +1,226 @@
+//------------------------------------------------------------------------------
+// <preamble>
+// </preamble>
+//------------------------------------------------------------------------------
+
+//! @file   GeometryCache.hpp
+//! @author agent
+//! @date   2026
+
+#ifndef base_mesh_geometrycache_hpp
+#define base_mesh_geometrycache_hpp
+
+//------------------------------------------------------------------------------
+// std includes
+#include <vector>
+// boost includes
+#include <boost/utility.hpp>
+// base includes
+#include <base/shape.hpp>
+#include <base/verify.hpp>
+#include <base/linearAlgebra.hpp>
+// base/mesh includes
+#include <base/mesh/Node.hpp>
+// base/auxi includes
+#include <base/auxi/parallel.hpp>
+
+//------------------------------------------------------------------------------
+namespace base{
+
+    template<unsigned DEGREE, base::Shape SHAPE>
+    class LagrangeShapeFun;
+
+    namespace mesh{
+
+        template<typename ELEMENT>
+        class GeometryCache;
+
+        //----------------------------------------------------------------------
+        /** Flag for a geometry representation with a constant Jacobi matrix.
+         *  This holds for linear Lagrange functions on simplex shapes, all
+         *  other geometry functions are treated as non-affine.
+         *  \tparam GEOMFUN Type of geometry shape function
+         */
+        template<typename GEOMFUN>
+        struct IsAffine
+        {
+            static const bool value = false;
+        };
+
+        template<base::Shape SHAPE>
+        struct IsAffine< base::LagrangeShapeFun<1,SHAPE> >
+        {
+            static const bool value =
+                ( SHAPE == base::LINE ) or
+                ( SHAPE == base::TRI  ) or
+                ( SHAPE == base::TET  );
+        };
+    }
+}
+
+//------------------------------------------------------------------------------
+/** Storage of the element geometry data at the quadrature points.
+ *  The Jacobi matrix \f$ J \f$, the contra-variant basis \f$ G \f$ (the
+ *  inverse Jacobi matrix for volume elements) and the metric \f$ \det J \f$
+ *  only depend on the element's nodal coordinates and the local evaluation
+ *  point. In a sequence of assembly passes on a fixed configuration (e.g.,
+ *  stiffness, residual and body forces within every Newton iteration) these
+ *  quantities are computed anew every time. This object stores them for
+ *  every element and quadrature point such that base::JacobiMatrix,
+ *  base::ContraVariantBasis and base::Jacobian look them up instead.
+ *
+ *  The cache is filled explicitly by base::cacheGeometry for a mesh and a
+ *  quadrature, evaluation points which are not cached fall back to the direct
+ *  computation. For affine elements (see IsAffine) only one entry per element
+ *  is stored, which is valid for any evaluation point. The nodes of the
+ *  cached elements are marked and the cache keeps the revision of their
+ *  coordinates (see base::mesh::Node) at which it has been filled. Once any
+ *  marked node has been given a new coordinate or has been destroyed, e.g. by
+ *  an ALE or updated Lagrangian step or by reading another mesh into the same
+ *  memory, the whole cache is out of date and the data is computed directly
+ *  again until base::cacheGeometry is called anew. Nodes of other meshes do
+ *  not affect the cache. Since the assembly reads the data concurrently, any
+ *  modification is only allowed outside of parallel regions.
+ *
+ *  There is one cache per element type. The data is stored by the element
+ *  IDs for a lookup without hashing, the address of the element is kept
+ *  in order to detect an element of another mesh with the same ID, which
+ *  is then treated as not cached. The points are identified by the exact
+ *  values of their coordinates.
+ *  \tparam ELEMENT Type of geometry element
+ */
+template<typename ELEMENT>
+class base::mesh::GeometryCache
+    : public boost::noncopyable
+{
+public:
+    //! Template parameter: element type
+    typedef ELEMENT Element;
+
+    //! @name Involved dimensions
+    //@{
+    static const unsigned globalDim = Element::Node::dim;
+    static const unsigned localDim  = Element::GeomFun::dim;
+    //@}
+
+    //! Flag for constant geometry data per element
+    static const bool isAffine = IsAffine<typename Element::GeomFun>::value;
+
+    //! @name Types of the stored data
+    //@{
+    typedef typename base::Vector<localDim>::Type                LocalVecDim;
+    typedef typename base::Matrix<globalDim,localDim>::Type      MatDimLDim;
+    //@}
+
+    //! Geometry data at one evaluation point
+    struct Entry
+    {
+        LocalVecDim xi;            //!< Evaluation point
+        MatDimLDim  jacobiMatrix;  //!< Jacobi matrix
+        MatDimLDim  contraVariant; //!< Contra-variant basis
+        double      detJ;          //!< Metric value
+    };
+
+    //! Access to the unique cache of this element type
+    static GeometryCache& instance()
+    {
+        static GeometryCache cache;
+        return cache;
+    }
+
+    //! True if any element has cached data for the current coordinates
+    bool isActive() const
+    {
+        return ( numCached_ > 0 ) and
+            ( revision_ == base::mesh::detail_::coordinateRevision() );
+    }
+
+    //! Look up the data of an element at a point, NULL if not (validly) cached
+    const Entry* find( const Element* ep, const LocalVecDim& xi ) const
+    {
+        if ( not this -> isActive() ) return NULL;
+
+        const std::size_t id = ep -> getID();
+        if ( ( id >= slots_.size() ) or ( slots_[id].element != ep ) )
+            return NULL;
+
+        const std::vector<Entry>& entries = slots_[id].entries;
+        if ( isAffine ) return &( entries[0] );
+
+        for ( std::size_t p = 0; p < entries.size(); p++ )
+            if ( entries[p].xi == xi ) return &( entries[p] );
+
+        return NULL;
+    }
+
+    //! Add data of an element
+    void insert( const Element* ep, const Entry& entry )
+    {
+        VERIFY_MSG( not base::auxi::inParallelRegion(),
+                    "Geometry cache cannot be modified in parallel" );
+
+        // data of previous coordinates is discarded
+        if ( revision_ != base::mesh::detail_::coordinateRevision() ) {
+            this -> clear();
+            revision_ = base::mesh::detail_::coordinateRevision();
+        }
+
+        const std::size_t id = ep -> getID();
+        if ( id >= slots_.size() ) slots_.resize( id+1 );
+
+        Slot& slot = slots_[id];
+        if ( slot.element != ep ) {
+            if ( slot.element == NULL ) numCached_++;
+            slot.element = ep;
+            slot.entries.clear();
+
+            // changes of these nodes outdate the cache
+            typename Element::NodePtrConstIter nIter = ep -> nodesBegin();
+            typename Element::NodePtrConstIter nEnd  = ep -> nodesEnd();
+            for ( ; nIter != nEnd; ++nIter ) (*nIter) -> setCached();
+        }
+
+        if ( isAffine and ( not slot.entries.empty() ) ) return;
+        slot.entries.push_back( entry );
+    }
+
+    //! Remove all data of an element
+    void erase( const Element* ep )
+    {
+        VERIFY_MSG( not base::auxi::inParallelRegion(),
+                    "Geometry cache cannot be modified in parallel" );
+        const std::size_t id = ep -> getID();
+        if ( ( id >= slots_.size() ) or ( slots_[id].element != ep ) ) return;
+
+        slots_[id].element = NULL;
+        slots_[id].entries.clear();
+        numCached_--;
+    }
+
+    //! Remove all data
+    void clear()
+    {
+        slots_.clear();
+        numCached_ = 0;
+    }
+
+    //! Number of elements with cached data
+    std::size_t size() const { return numCached_; }
+
+private:
+    GeometryCache() : numCached_( 0 ), revision_( 0 ) { }
+
+    //! Cached data of one element
+    struct Slot
+    {
+        Slot() : element( NULL ) { }
+        const Element*     element; //!< Address of the element
+        std::vector<Entry> entries; //!< Data at the evaluation points
+    };
+
+    std::vector<Slot> slots_;     //!< Slot per element ID
+    std::size_t       numCached_; //!< Number of occupied slots
+    unsigned long     revision_;  //!< Coordinate revision of the data
+};
+
+#endif
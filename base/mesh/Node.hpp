@@ -23,6 +23,33 @@ namespace base{
     namespace mesh{
         template<unsigned DIM>
         class Node;
+
+        namespace detail_{
+
+            /** Counter of the coordinate changes of cached nodes.
+             *  Cached geometry data (see base::mesh::GeometryCache) is only
+             *  valid as long as this number does not change. Only nodes which
+             *  have been marked by the cache increment it, therefore changes
+             *  of other meshes do not invalidate the cache.
+             */
+            inline unsigned long& coordinateRevisionCounter()
+            {
+                static unsigned long revision = 0;
+                return revision;
+            }
+
+            //! Current value of the counter, read atomically
+            inline unsigned long coordinateRevision()
+            {
+                const unsigned long& revision = coordinateRevisionCounter();
+                unsigned long result;
+#ifdef _OPENMP
+#pragma omp atomic read
+#endif
+                result = revision;
+                return result;
+            }
+        }
     }
 }
 
@@ -48,7 +75,8 @@ public:
      */
     Node()
         : id_( base::invalidInt ),
-          x_(  base::invalidVector<dim>() )
+          x_(  base::invalidVector<dim>() ),
+          isCached_( false )
     { }
 
     /** Basic constructor with ID and Coordinate
@@ -57,8 +85,11 @@ public:
      */
     Node( const std::size_t id,
           const VecDim & x )
-        : id_( id ), x_( x )
+        : id_( id ), x_( x ), isCached_( false )
     { }
+
+    //! Destruction of a cached node outdates the cache, its memory is reused
+    ~Node() { touch_(); }
     //@}
 
     //--------------------------------------------------------------------------
@@ -67,12 +98,13 @@ public:
     //! Set the global ID
     void setID( const std::size_t id ) { id_ = id; }
     //! Set the coordinate
-    void setX(  const VecDim & x  ) { x_  = x;  }
+    void setX(  const VecDim & x  ) { x_  = x; touch_(); }
     //! Set coordinates from iterator
     template<typename INPITER>
     void setX( INPITER iter )
     {
         for ( unsigned d = 0; d < dim; d ++ ) x_[d] = *iter++;
+        touch_();
     }
     //! Make a true copy by copying all private data
     template<typename NODE>
@@ -80,6 +112,7 @@ public:
     {
         id_ = other -> getID();
         x_  = other -> getX();
+        touch_();
     }
     //@}
 
@@ -97,10 +130,26 @@ public:
         for ( unsigned d = 0; d < dim; d ++ ) *iter++ = x_[d];
     }
     //@}
+
+    //! Mark the node as used by base::mesh::GeometryCache (not in parallel)
+    void setCached() { isCached_ = true; }
     
 private:
-    std::size_t id_; //!< Global Node ID
-    VecDim      x_;  //!< Coordinate of this node
+    //! Signal the change of a coordinate if the node is in the cache
+    void touch_() const
+    {
+        if ( not isCached_ ) return;
+        unsigned long& revision = detail_::coordinateRevisionCounter();
+#ifdef _OPENMP
+#pragma omp atomic
+#endif
+        revision++;
+    }
+
+private:
+    std::size_t id_;       //!< Global Node ID
+    VecDim      x_;        //!< Coordinate of this node
+    bool        isCached_; //!< Node coordinates are in the geometry cache
 };
 //------------------------------------------------------------------------------
 #endif
@@ -57,7 +57,7 @@ namespace base{
                 static MIT apply( const MIT & gridSizes )
                 {
                     const MIT result =
-                        (defect+1) * gridSizes + continuity + 1;
+                        (defect+1) * gridSizes + ( continuity + 1 );
                     return result;
                 }
                
@@ -168,7 +168,8 @@ public:
     //@{
     Node* nodePtr( const MultiIndexType & mi ) const
     {
-        const std::size_t linIndex = MultiIndex::unwrap( mi, gridSizes_ + degree);
+        const std::size_t linIndex =
+            MultiIndex::unwrap( mi, gridSizes_ + static_cast<int>( degree ) );
         return Mesh::coefficientPtr( linIndex );
     }
 
@@ -0,0 +1,108 @@
+#include <sstream>
+#include <vector>
+#include <cmath>
+#include <boost/test/minimal.hpp>
+
+#include <tools/meshGeneration/unitCube/unitCube.hpp>
+#include <base/Unstructured.hpp>
+#include <base/io/smf/Reader.hpp>
+#include <base/Quadrature.hpp>
+#include <base/geometry.hpp>
+
+//! \cond SKIPDOX
+// Jacobians of all elements at all quadrature points
+template<typename MESH, typename QUAD>
+std::vector<double> jacobians( const MESH& mesh, const QUAD& quadrature )
+{
+    typedef typename MESH::Element Element;
+    std::vector<double> result;
+    typename MESH::ElementPtrConstIter eIter = mesh.elementsBegin();
+    for ( ; eIter != mesh.elementsEnd(); ++eIter ) {
+        typename QUAD::Iter qIter = quadrature.begin();
+        for ( ; qIter != quadrature.end(); ++qIter ) {
+            result.push_back( base::Jacobian<Element>()( *eIter,
+                                                          qIter -> second ) );
+            // the other access paths have to agree with the Jacobian
+            const typename base::Matrix<2,2>::Type J =
+                base::JacobiMatrix<Element>()( *eIter, qIter -> second );
+            BOOST_CHECK( std::abs( J.determinant() - result.back() )
+                         < 1.e-12 );
+        }
+    }
+    return result;
+}
+
+bool equal( const std::vector<double>& a, const std::vector<double>& b,
+            const double factor = 1. )
+{
+    if ( a.size() != b.size() ) return false;
+    for ( std::size_t i = 0; i < a.size(); i++ )
+        if ( std::abs( a[i] - factor * b[i] ) > 1.e-12 ) return false;
+    return true;
+}
+
+// cache the geometry, move nodes and compare with the direct computation
+template<base::Shape SHAPE, bool SIMPLEX>
+void moveNodes()
+{
+    typedef base::Unstructured<SHAPE,1>                Mesh;
+    typedef typename Mesh::Element                     Element;
+    typedef base::Quadrature<3,SHAPE>                  Quadrature;
+    typedef base::mesh::GeometryCache<Element>         Cache;
+
+    Mesh mesh;
+    {
+        std::stringstream smf;
+        tools::meshGeneration::unitCube::SMF<2,SIMPLEX,1>::apply( 4, 3, 1,
+                                                                  smf );
+        base::io::smf::readMesh( smf, mesh );
+    }
+    Quadrature quadrature;
+
+    const std::vector<double> direct = jacobians( mesh, quadrature );
+    base::cacheGeometry( mesh, quadrature );
+    BOOST_CHECK( Cache::instance().isActive() );
+    BOOST_CHECK( equal( jacobians( mesh, quadrature ), direct ) );
+
+    // scale the whole mesh by two
+    typename Mesh::NodePtrIter nIter = mesh.nodesBegin();
+    for ( ; nIter != mesh.nodesEnd(); ++nIter ) {
+        const typename Mesh::Node::VecDim x = 2. * ( *nIter ) -> getX();
+        ( *nIter ) -> setX( x );
+    }
+    BOOST_CHECK( not Cache::instance().isActive() );
+    BOOST_CHECK( equal( jacobians( mesh, quadrature ), direct, 4. ) );
+
+    // move a single interior node and cache again
+    typename Mesh::Node* np = *( mesh.nodesBegin() + 6 );
+    typename Mesh::Node::VecDim x = np -> getX();
+    x[0] += 0.1; x[1] -= 0.05;
+    np -> setX( x );
+    const std::vector<double> moved = jacobians( mesh, quadrature );
+    BOOST_CHECK( not equal( moved, direct, 4. ) );
+    base::cacheGeometry( mesh, quadrature );
+    BOOST_CHECK( Cache::instance().isActive() );
+    BOOST_CHECK( equal( jacobians( mesh, quadrature ), moved ) );
+
+    // reading and moving another mesh does not affect the cache
+    {
+        Mesh other;
+        std::stringstream smf;
+        tools::meshGeneration::unitCube::SMF<2,SIMPLEX,1>::apply( 2, 2, 1,
+                                                                  smf );
+        base::io::smf::readMesh( smf, other );
+        ( *other.nodesBegin() ) -> setX( x );
+    }
+    BOOST_CHECK( Cache::instance().isActive() );
+
+    base::invalidateGeometryCache( mesh );
+    BOOST_CHECK( not Cache::instance().isActive() );
+}
+
+int test_main( int, char *[] )
+{
+    moveNodes<base::QUAD,false>();
+    moveNodes<base::TRI, true >();
+    return 0;
+}
+//! \endcond
@@ -0,0 +1,198 @@
+//------------------------------------------------------------------------------
+// <preamble>
+// </preamble>
+//------------------------------------------------------------------------------
+
+//! @file   Communicator.hpp
+//! @author agent
+//! @date   2026
+
+#ifndef base_mpi_communicator_hpp
+#define base_mpi_communicator_hpp
+
+//------------------------------------------------------------------------------
+// std includes
+#include <vector>
+#include <algorithm>
+// boost includes
+#include <boost/utility.hpp>
+// MPI includes
+#include <mpi.h>
+// base includes
+#include <base/verify.hpp>
+#include <base/auxi/Profiler.hpp>
+
+//------------------------------------------------------------------------------
+namespace base{
+    namespace mpi{
+
+        class Environment;
+        class Communicator;
+
+        //----------------------------------------------------------------------
+        //! Map a C++ type to the corresponding MPI data type
+        template<typename T> struct DataType;
+
+        template<> struct DataType<int>
+        { static MPI_Datatype apply() { return MPI_INT; } };
+
+        template<> struct DataType<unsigned>
+        { static MPI_Datatype apply() { return MPI_UNSIGNED; } };
+
+        template<> struct DataType<unsigned long>
+        { static MPI_Datatype apply() { return MPI_UNSIGNED_LONG; } };
+
+        template<> struct DataType<unsigned long long>
+        { static MPI_Datatype apply() { return MPI_UNSIGNED_LONG_LONG; } };
+
+        template<> struct DataType<double>
+        { static MPI_Datatype apply() { return MPI_DOUBLE; } };
+    }
+}
+
+//------------------------------------------------------------------------------
+/** Scoped initialisation and finalisation of MPI.
+ *  An object of this type has to be created at the beginning of main() and
+ *  lives until the end of the program. With PROFILING, the rank is passed to
+ *  base::auxi::Profiler, such that every rank writes its own trace file.
+ */
+class base::mpi::Environment : boost::noncopyable
+{
+public:
+    Environment( int& argc, char**& argv )
+    {
+        MPI_Init( &argc, &argv );
+#ifdef PROFILING
+        int rank;
+        MPI_Comm_rank( MPI_COMM_WORLD, &rank );
+        base::auxi::Profiler::instance().setRank( rank );
+#endif
+    }
+
+    ~Environment()
+    {
+        MPI_Finalize();
+    }
+};
+
+//------------------------------------------------------------------------------
+/** Thin wrapper of an MPI communicator.
+ *  Provides the few collective operations needed by the distributed
+ *  assembly and solution, namely reductions, prefix sums and the personalised
+ *  all-to-all exchange of vectors. The latter is the basis of the DoF
+ *  numbering and of the ghost value updates, see base::mpi::IndexLayout.
+ */
+class base::mpi::Communicator
+{
+public:
+    //! Constructor with the MPI communicator, the world by default
+    Communicator( MPI_Comm comm = MPI_COMM_WORLD )
+        : comm_( comm )
+    {
+        MPI_Comm_rank( comm_, &rank_ );
+        MPI_Comm_size( comm_, &size_ );
+    }
+
+    //! @name Accessors
+    //@{
+    int      rank() const { return rank_; }
+    int      size() const { return size_; }
+    MPI_Comm get()  const { return comm_; }
+    //@}
+
+    void barrier() const { MPI_Barrier( comm_ ); }
+
+    //--------------------------------------------------------------------------
+    //! @name Collective reductions
+    //@{
+    template<typename T>
+    T sum( const T value ) const
+    {
+        T result;
+        MPI_Allreduce( const_cast<T*>( &value ), &result, 1,
+                       DataType<T>::apply(), MPI_SUM, comm_ );
+        return result;
+    }
+
+    template<typename T>
+    T max( const T value ) const
+    {
+        T result;
+        MPI_Allreduce( const_cast<T*>( &value ), &result, 1,
+                       DataType<T>::apply(), MPI_MAX, comm_ );
+        return result;
+    }
+
+    //! Gather one value of every rank in rank order
+    template<typename T>
+    void allGather( const T value, std::vector<T>& result ) const
+    {
+        result.resize( size_ );
+        MPI_Allgather( const_cast<T*>( &value ), 1, DataType<T>::apply(),
+                       &result[0], 1, DataType<T>::apply(), comm_ );
+    }
+
+    //! Exclusive prefix sum, i.e. the sum of the values of all lower ranks
+    template<typename T>
+    T exclusiveSum( const T value ) const
+    {
+        T result = T( 0 );
+        MPI_Exscan( const_cast<T*>( &value ), &result, 1,
+                    DataType<T>::apply(), MPI_SUM, comm_ );
+        return ( rank_ == 0 ? T( 0 ) : result );
+    }
+    //@}
+
+    //--------------------------------------------------------------------------
+    /** Personalised exchange of vectors between all ranks.
+     *  \param[in]  send  send[r] is the data for rank r
+     *  \param[out] recv  recv[r] is the data received from rank r
+     */
+    template<typename T>
+    void allToAll( const std::vector< std::vector<T> >& send,
+                   std::vector< std::vector<T> >& recv ) const
+    {
+        VERIFY_MSG( send.size() == static_cast<std::size_t>( size_ ),
+                    "Need one send buffer per rank" );
+
+        // exchange the message sizes
+        std::vector<int> sendCounts( size_ ), recvCounts( size_ );
+        for ( int r = 0; r < size_; r++ )
+            sendCounts[r] = static_cast<int>( send[r].size() );
+        MPI_Alltoall( &sendCounts[0], 1, MPI_INT,
+                      &recvCounts[0], 1, MPI_INT, comm_ );
+
+        // flat buffers with offsets
+        std::vector<int> sendOffsets( size_, 0 ), recvOffsets( size_, 0 );
+        for ( int r = 1; r < size_; r++ ) {
+            sendOffsets[r] = sendOffsets[r-1] + sendCounts[r-1];
+            recvOffsets[r] = recvOffsets[r-1] + recvCounts[r-1];
+        }
+
+        std::vector<T> sendBuffer( sendOffsets.back() + sendCounts.back() );
+        std::vector<T> recvBuffer( recvOffsets.back() + recvCounts.back() );
+        for ( int r = 0; r < size_; r++ )
+            std::copy( send[r].begin(), send[r].end(),
+                       sendBuffer.begin() + sendOffsets[r] );
+
+        // avoid access to empty vectors
+        T dummy;
+        MPI_Alltoallv( sendBuffer.empty() ? &dummy : &sendBuffer[0],
+                       &sendCounts[0], &sendOffsets[0], DataType<T>::apply(),
+                       recvBuffer.empty() ? &dummy : &recvBuffer[0],
+                       &recvCounts[0], &recvOffsets[0], DataType<T>::apply(),
+                       comm_ );
+
+        recv.resize( size_ );
+        for ( int r = 0; r < size_; r++ )
+            recv[r].assign( recvBuffer.begin() + recvOffsets[r],
+                            recvBuffer.begin() + recvOffsets[r] + recvCounts[r] );
+    }
+
+private:
+    MPI_Comm comm_; //!< MPI communicator
+    int      rank_; //!< Rank of this process
+    int      size_; //!< Number of processes
+};
+
+#endif
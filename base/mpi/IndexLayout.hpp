@@ -0,0 +1,158 @@
+//------------------------------------------------------------------------------
+// <preamble>
+// </preamble>
+//------------------------------------------------------------------------------
+
+//! @file   IndexLayout.hpp
+//! @author agent
+//! @date   2026
+
+#ifndef base_mpi_indexlayout_hpp
+#define base_mpi_indexlayout_hpp
+
+//------------------------------------------------------------------------------
+// std includes
+#include <vector>
+#include <algorithm>
+#include <limits>
+// base includes
+#include <base/verify.hpp>
+#include <base/numbers.hpp>
+// base/mpi includes
+#include <base/mpi/Communicator.hpp>
+
+//------------------------------------------------------------------------------
+namespace base{
+    namespace mpi{
+
+        class IndexLayout;
+    }
+}
+
+//------------------------------------------------------------------------------
+/** Distribution of the global system indices over the ranks.
+ *  Every rank owns a contiguous range \f$ [first, first + numOwned) \f$ of
+ *  the global indices. In addition, it references ghost indices owned by
+ *  other ranks, which are needed for the assembly and the matrix-vector
+ *  product of its rows. Locally, the owned indices come first, followed by
+ *  the sorted ghost indices.
+ *
+ *  The setup computes the communication pattern of the ghost update: every
+ *  rank tells the owners which of their values it needs, hence the
+ *  update itself is one personalised all-to-all exchange.
+ */
+class base::mpi::IndexLayout
+{
+public:
+    //! Marker of an index which is not present locally
+    static std::size_t invalid() { return std::numeric_limits<std::size_t>::max(); }
+
+    //--------------------------------------------------------------------------
+    /** Setup of the layout.
+     *  \param[in] comm      Communicator
+     *  \param[in] first     First owned global index
+     *  \param[in] numOwned  Number of owned indices
+     *  \param[in] ghosts    Global indices of the ghosts (any order)
+     */
+    IndexLayout( const Communicator& comm,
+                 const std::size_t first, const std::size_t numOwned,
+                 const std::vector<std::size_t>& ghosts )
+        : comm_( comm ), first_( first ), numOwned_( numOwned ),
+          ghosts_( ghosts )
+    {
+        std::sort( ghosts_.begin(), ghosts_.end() );
+        ghosts_.erase( std::unique( ghosts_.begin(), ghosts_.end() ),
+                       ghosts_.end() );
+
+        numGlobal_ = comm_.sum( numOwned_ );
+
+        // ranges of all ranks
+        std::vector<std::size_t> firsts;
+        comm_.allGather( first_, firsts );
+
+        // request the ghost values from their owners
+        std::vector< std::vector<std::size_t> > requests( comm_.size() );
+        recvPositions_.resize( comm_.size() );
+        for ( std::size_t g = 0; g < ghosts_.size(); g++ ) {
+            const int owner = static_cast<int>(
+                std::upper_bound( firsts.begin(), firsts.end(), ghosts_[g] )
+                - firsts.begin() ) - 1;
+            VERIFY_MSG( owner != comm_.rank(), "Ghost index is owned" );
+            requests[owner].push_back(      ghosts_[g] );
+            recvPositions_[owner].push_back( numOwned_ + g );
+        }
+
+        // owned values to send
+        comm_.allToAll( requests, sendIndices_ );
+        for ( std::size_t r = 0; r < sendIndices_.size(); r++ )
+            for ( std::size_t i = 0; i < sendIndices_[r].size(); i++ ) {
+                VERIFY_MSG( isOwned( sendIndices_[r][i] ),
+                            "Requested index is not owned" );
+                sendIndices_[r][i] -= first_;
+            }
+    }
+
+    //--------------------------------------------------------------------------
+    //! @name Accessors
+    //@{
+    const Communicator& communicator() const { return comm_; }
+    std::size_t first()     const { return first_; }
+    std::size_t numOwned()  const { return numOwned_; }
+    std::size_t numGhosts() const { return ghosts_.size(); }
+    std::size_t numLocal()  const { return numOwned_ + ghosts_.size(); }
+    std::size_t numGlobal() const { return numGlobal_; }
+    //@}
+
+    //! Flag if the global index is owned by this rank
+    bool isOwned( const std::size_t global ) const
+    {
+        return ( global >= first_ ) and ( global < first_ + numOwned_ );
+    }
+
+    //--------------------------------------------------------------------------
+    //! Local position of a global index or invalid()
+    std::size_t localIndex( const std::size_t global ) const
+    {
+        if ( this -> isOwned( global ) ) return global - first_;
+
+        std::vector<std::size_t>::const_iterator iter =
+            std::lower_bound( ghosts_.begin(), ghosts_.end(), global );
+        if ( ( iter == ghosts_.end() ) or ( *iter != global ) ) return invalid();
+        return numOwned_ + ( iter - ghosts_.begin() );
+    }
+
+    //--------------------------------------------------------------------------
+    /** Copy the owners' values to the ghost entries.
+     *  \tparam VECTOR  Vector type with random access to the local entries
+     *  \param[in,out] values  Owned values followed by the ghost values
+     */
+    template<typename VECTOR>
+    void updateGhosts( VECTOR& values ) const
+    {
+        std::vector< std::vector<number> > send( comm_.size() ), recv;
+        for ( std::size_t r = 0; r < sendIndices_.size(); r++ )
+            for ( std::size_t i = 0; i < sendIndices_[r].size(); i++ )
+                send[r].push_back( values[ sendIndices_[r][i] ] );
+
+        comm_.allToAll( send, recv );
+
+        for ( std::size_t r = 0; r < recvPositions_.size(); r++ )
+            for ( std::size_t i = 0; i < recvPositions_[r].size(); i++ )
+                values[ recvPositions_[r][i] ] = recv[r][i];
+    }
+
+private:
+    const Communicator       comm_;       //!< Communicator
+    const std::size_t        first_;      //!< First owned global index
+    const std::size_t        numOwned_;   //!< Number of owned indices
+    std::size_t              numGlobal_;  //!< Total number of indices
+    std::vector<std::size_t> ghosts_;     //!< Sorted global ghost indices
+
+    //! @name Communication pattern of the ghost update
+    //@{
+    std::vector< std::vector<std::size_t> > sendIndices_;   //!< Per rank
+    std::vector< std::vector<std::size_t> > recvPositions_; //!< Per rank
+    //@}
+};
+
+#endif
@@ -0,0 +1,231 @@
+//------------------------------------------------------------------------------
+// <preamble>
+// </preamble>
+//------------------------------------------------------------------------------
+
+//! @file   mpi/Solver.hpp
+//! @author agent
+//! @date   2026
+
+#ifndef base_mpi_solver_hpp
+#define base_mpi_solver_hpp
+
+//------------------------------------------------------------------------------
+// std includes
+#include <cmath>
+#include <set>
+#include <utility>
+// boost includes
+#include <boost/utility.hpp>
+// base includes
+#include <base/verify.hpp>
+#include <base/numbers.hpp>
+#include <base/io/Format.hpp>
+#include <base/auxi/Profiler.hpp>
+// base/solver includes
+#include <base/solver/TripletContainer.hpp>
+// base/mpi includes
+#include <base/mpi/IndexLayout.hpp>
+#include <base/mpi/Vector.hpp>
+#include <base/mpi/SparseMatrix.hpp>
+
+//------------------------------------------------------------------------------
+namespace base{
+    namespace mpi{
+
+        class Solver;
+    }
+}
+
+//------------------------------------------------------------------------------
+/** Distributed linear system with the assembly interface of Eigen3.
+ *  The assembly routines pass element contributions with global indices as
+ *  for base::solver::Eigen3. Only the rows owned by this rank are kept,
+ *  since the local mesh includes the ghost elements, these rows are
+ *  complete without any exchange of matrix entries. After the solution,
+ *  getValue() provides the values of the owned and of the ghost indices,
+ *  hence base::dof::setDoFsFromSolver can be applied to the local field.
+ *
+ *  Entries are collected by a TripletContainer. As for Eigen3, the non-zero
+ *  pattern of the owned rows can be pre-determined by registerFields(), the
+ *  columns are taken in the local numbering of the layout. This is required
+ *  if the assembly runs with several threads per rank, otherwise the
+ *  dynamic mode of the container aborts.
+ */
+class base::mpi::Solver : boost::noncopyable
+{
+public:
+    //! Constructor with the index layout
+    Solver( const IndexLayout& layout )
+        : layout_( layout ), A_( layout ), b_( layout ), x_( layout )
+    { }
+
+    //--------------------------------------------------------------------------
+    /** Register the entries of the owned rows for the given fields.
+     *  \tparam FIELDTUPLEBINDER Type to determine which is test and trial field
+     *  \tparam FIELDBINDER      Type of mesh and field binder
+     *  \param[in] fieldBinder Binder of the local mesh and fields
+     */
+    template<typename FIELDTUPLEBINDER, typename FIELDBINDER>
+    void registerFields( const FIELDBINDER& fieldBinder )
+    {
+        PROFILE_REGION( "mpi::registerFields" );
+        std::set<std::pair<std::size_t,std::size_t> > pattern;
+
+        typename FIELDBINDER::FieldIterator iter = fieldBinder.elementsBegin();
+        typename FIELDBINDER::FieldIterator end  = fieldBinder.elementsEnd();
+        for ( ; iter != end; ++iter ) {
+
+            std::vector<std::size_t> rowIDs, colIDs;
+            if ( not base::solver::detail_::effectiveDoFIDs(
+                     FIELDTUPLEBINDER::makeTuple( *iter ), rowIDs, colIDs ) )
+                continue;
+
+            for ( std::size_t i = 0; i < rowIDs.size(); i ++ ) {
+                if ( not layout_.isOwned( rowIDs[i] ) ) continue;
+                const std::size_t row = rowIDs[i] - layout_.first();
+
+                for ( std::size_t j = 0; j < colIDs.size(); j ++ ) {
+                    const std::size_t col = layout_.localIndex( colIDs[j] );
+                    VERIFY_MSG( col != IndexLayout::invalid(),
+                                "Column index not available: " + x2s( colIDs[j] ) );
+                    pattern.insert( std::make_pair( row, col ) );
+                }
+            }
+        }
+
+        triplets_.registerIndexPairs( pattern.begin(), pattern.end() );
+    }
+
+    //--------------------------------------------------------------------------
+    //! Insert numbers to matrix storage, rows of other ranks are skipped
+    template<typename MATRIX, typename RDOFS, typename CDOFS>
+    void insertToLHS( const MATRIX & matrix,
+                      const RDOFS  & rowDoFs,
+                      const CDOFS  & colDoFs )
+    {
+        for ( std::size_t i = 0; i < rowDoFs.size(); i ++ ) {
+            if ( not layout_.isOwned( rowDoFs[i] ) ) continue;
+            const std::size_t row = rowDoFs[i] - layout_.first();
+
+            for ( std::size_t j = 0; j < colDoFs.size(); j ++ ) {
+                const std::size_t col = layout_.localIndex( colDoFs[j] );
+                VERIFY_MSG( col != IndexLayout::invalid(),
+                            "Column index not available: " + x2s( colDoFs[j] ) );
+
+                triplets_.insert( static_cast<unsigned>( row ),
+                                  static_cast<unsigned>( col ),
+                                  matrix( i, j ) );
+            }
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    //! Insert numbers to RHS vector, rows of other ranks are skipped
+    template<typename VECTOR, typename DOFS>
+    void insertToRHS( const VECTOR & vector,
+                      const DOFS   & dofs )
+    {
+        for ( std::size_t i = 0; i < dofs.size(); i ++ ) {
+            if ( not layout_.isOwned( dofs[i] ) ) continue;
+            const std::size_t row = dofs[i] - layout_.first();
+#ifdef _OPENMP
+#pragma omp atomic
+            b_.local()[ row ] += vector[i];
+#else
+            b_.local()[ row ] += vector[i];
+#endif
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    //! Convert the triplets to the local rows of the matrix
+    void finishAssembly( const bool destroyTriplet = true )
+    {
+        PROFILE_REGION( "mpi::finishAssembly" );
+        triplets_.prepare();
+        A_.local().setFromTriplets( triplets_.begin(), triplets_.end() );
+        if ( destroyTriplet ) triplets_.destroy();
+    }
+
+    //! @name Re-use of the solver object
+    //@{
+    void clearRHS() { b_.local().setZero(); }
+    void clearLHS() { triplets_.clearValues(); A_.local().setZero(); }
+    //@}
+
+    //--------------------------------------------------------------------------
+    /** Conjugate gradient method with Jacobi preconditioner.
+     *  The matrix has to be symmetric and positive definite. The iteration
+     *  stops if the residual norm is reduced by the given tolerance.
+     *  \return Number of iterations
+     */
+    int cgSolve( const double tolerance = 1.e-10 )
+    {
+        PROFILE_REGION( "mpi::cgSolve" );
+        const VectorD invDiag = A_.diagonal().cwiseInverse();
+        const std::size_t maxIter = 2 * layout_.numGlobal();
+
+        Vector r( layout_ ), z( layout_ ), p( layout_ ), q( layout_ );
+
+        // start with zero
+        x_.local().setZero();
+        r.owned() = b_.owned();
+        const double bNorm = r.norm();
+
+        z.owned() = invDiag.cwiseProduct( r.owned() );
+        p.owned() = z.owned();
+        double rz = r.dot( z );
+
+        std::size_t iter = 0;
+        double rNorm = bNorm;
+        while ( ( rNorm > tolerance * bNorm ) and ( iter < maxIter ) ) {
+            A_.multiply( p, q );
+            const double alpha = rz / p.dot( q );
+            x_.owned() += alpha * p.owned();
+            r.owned()  -= alpha * q.owned();
+
+            z.owned() = invDiag.cwiseProduct( r.owned() );
+            const double rzNew = r.dot( z );
+            p.owned() = z.owned() + ( rzNew / rz ) * p.owned();
+            rz = rzNew;
+
+            rNorm = r.norm();
+            iter++;
+        }
+
+        // values of the ghost indices for the distribution to the DoFs
+        x_.updateGhosts();
+
+        return static_cast<int>( iter );
+    }
+
+    //--------------------------------------------------------------------------
+    //! Solution value of an owned or ghost global index
+    number getValue( const std::size_t index ) const
+    {
+        const std::size_t local = layout_.localIndex( index );
+        VERIFY_MSG( local != IndexLayout::invalid(),
+                    "Index not available: " + x2s( index ) );
+        return x_.local()[ local ];
+    }
+
+    //! Global number of unknowns
+    std::size_t size() const { return layout_.numGlobal(); }
+
+    //! @name Access to the distributed objects
+    //@{
+    const SparseMatrix& getMatrix()   const { return A_; }
+    const Vector&       getRHS()      const { return b_; }
+    const Vector&       getSolution() const { return x_; }
+    //@}
+
+private:
+    const IndexLayout&               layout_;   //!< Distribution
+    base::solver::TripletContainer   triplets_; //!< Temp. storage of triplets
+    SparseMatrix                     A_;        //!< Owned rows
+    Vector                           b_;        //!< Right hand side
+    Vector                           x_;        //!< Solution
+};
+
+#endif
@@ -0,0 +1,78 @@
+//------------------------------------------------------------------------------
+// <preamble>
+// </preamble>
+//------------------------------------------------------------------------------
+
+//! @file   mpi/SparseMatrix.hpp
+//! @author agent
+//! @date   2026
+
+#ifndef base_mpi_sparsematrix_hpp
+#define base_mpi_sparsematrix_hpp
+
+//------------------------------------------------------------------------------
+// Eigen includes
+#include <Eigen/Sparse>
+// base includes
+#include <base/numbers.hpp>
+#include <base/linearAlgebra.hpp>
+// base/mpi includes
+#include <base/mpi/IndexLayout.hpp>
+#include <base/mpi/Vector.hpp>
+
+//------------------------------------------------------------------------------
+namespace base{
+    namespace mpi{
+
+        class SparseMatrix;
+    }
+}
+
+//------------------------------------------------------------------------------
+/** Distributed sparse matrix stored by rows.
+ *  Every rank stores the rows of its owned indices. The columns are in the
+ *  local numbering of the IndexLayout, i.e. owned indices followed by the
+ *  ghosts, such that the product with a distributed vector only needs an
+ *  update of the vector's ghost entries.
+ */
+class base::mpi::SparseMatrix
+{
+public:
+    //! Local storage type
+    typedef Eigen::SparseMatrix<number,Eigen::RowMajor> LocalMatrix;
+
+    //! Constructor with the layout
+    SparseMatrix( const IndexLayout& layout )
+        : layout_( layout ),
+          A_( static_cast<int>( layout.numOwned() ),
+              static_cast<int>( layout.numLocal() ) )
+    { }
+
+    //--------------------------------------------------------------------------
+    //! @name Access
+    //@{
+    const IndexLayout& layout() const { return layout_; }
+    LocalMatrix&       local()        { return A_; }
+    const LocalMatrix& local()  const { return A_; }
+    //@}
+
+    //--------------------------------------------------------------------------
+    /** Product \f$ y = A x \f$.
+     *  \param[in,out] x  Argument, its ghost entries are updated
+     *  \param[out]    y  Result, only the owned entries are set
+     */
+    void multiply( Vector& x, Vector& y ) const
+    {
+        x.updateGhosts();
+        y.owned() = A_ * x.local();
+    }
+
+    //! Diagonal of the owned rows (the owned columns come first)
+    VectorD diagonal() const { return A_.diagonal(); }
+
+private:
+    const IndexLayout& layout_; //!< Distribution of the indices
+    LocalMatrix        A_;      //!< Owned rows, local columns
+};
+
+#endif
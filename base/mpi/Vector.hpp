@@ -0,0 +1,84 @@
+//------------------------------------------------------------------------------
+// <preamble>
+// </preamble>
+//------------------------------------------------------------------------------
+
+//! @file   mpi/Vector.hpp
+//! @author agent
+//! @date   2026
+
+#ifndef base_mpi_vector_hpp
+#define base_mpi_vector_hpp
+
+//------------------------------------------------------------------------------
+// std includes
+#include <cmath>
+// base includes
+#include <base/linearAlgebra.hpp>
+// base/mpi includes
+#include <base/mpi/IndexLayout.hpp>
+
+//------------------------------------------------------------------------------
+namespace base{
+    namespace mpi{
+
+        class Vector;
+    }
+}
+
+//------------------------------------------------------------------------------
+/** Distributed vector with owned and ghost entries.
+ *  The local storage holds the entries of the owned indices followed by the
+ *  ghost entries as given by the IndexLayout. Reductions (dot product and
+ *  norm) only use the owned entries, the ghosts are copies which are
+ *  refreshed by updateGhosts().
+ */
+class base::mpi::Vector
+{
+public:
+    //! Constructor with the layout, all entries are zero
+    Vector( const IndexLayout& layout )
+        : layout_( layout ),
+          values_( VectorD::Zero( layout.numLocal() ) )
+    { }
+
+    //--------------------------------------------------------------------------
+    //! @name Access
+    //@{
+    const IndexLayout& layout() const { return layout_; }
+
+    //! All local entries
+    VectorD&       local()       { return values_; }
+    const VectorD& local() const { return values_; }
+
+    //! The owned entries only
+    Eigen::VectorBlock<VectorD>       owned()
+    {
+        return values_.head( layout_.numOwned() );
+    }
+    const Eigen::VectorBlock<const VectorD> owned() const
+    {
+        return values_.head( layout_.numOwned() );
+    }
+    //@}
+
+    //! Refresh the ghost entries from their owners
+    void updateGhosts() { layout_.updateGhosts( values_ ); }
+
+    //--------------------------------------------------------------------------
+    //! @name Global reductions
+    //@{
+    double dot( const Vector& other ) const
+    {
+        return layout_.communicator().sum( this -> owned().dot( other.owned() ) );
+    }
+
+    double norm() const { return std::sqrt( this -> dot( *this ) ); }
+    //@}
+
+private:
+    const IndexLayout& layout_; //!< Distribution of the indices
+    VectorD            values_; //!< Owned and ghost entries
+};
+
+#endif
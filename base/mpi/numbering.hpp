@@ -0,0 +1,192 @@
+//------------------------------------------------------------------------------
+// <preamble>
+// </preamble>
+//------------------------------------------------------------------------------
+
+//! @file   mpi/numbering.hpp
+//! @author agent
+//! @date   2026
+
+#ifndef base_mpi_numbering_hpp
+#define base_mpi_numbering_hpp
+
+//------------------------------------------------------------------------------
+// std includes
+#include <vector>
+#include <algorithm>
+#include <iterator>
+#include <utility>
+#include <limits>
+// boost includes
+#include <boost/shared_ptr.hpp>
+// base includes
+#include <base/verify.hpp>
+// base/dof includes
+#include <base/dof/IndexMap.hpp>
+// base/mpi includes
+#include <base/mpi/Communicator.hpp>
+#include <base/mpi/IndexLayout.hpp>
+
+//------------------------------------------------------------------------------
+namespace base{
+    namespace mpi{
+
+        template<typename FEBASIS, typename MESH, typename FIELD>
+        boost::shared_ptr<IndexLayout>
+        numberDoFs( const Communicator& comm,
+                    const MESH& globalMesh,
+                    const std::vector<int>& partition,
+                    const std::vector<std::size_t>& globalElementIDs,
+                    FIELD& field );
+    }
+}
+
+//------------------------------------------------------------------------------
+/** Number the DoFs of a local field with global system indices.
+ *  The field has been generated on the local mesh, see extractLocalMesh(),
+ *  and its constraints have been set. The global identity of a DoF follows
+ *  from the index map of the complete mesh. A DoF is owned by the lowest
+ *  part of the elements which reference it. Since the local mesh contains
+ *  a layer of ghost elements, the owner holds all elements of its DoFs.
+ *
+ *  Every rank numbers the ACTIVE components of its owned DoFs consecutively
+ *  starting after the components of the lower ranks. The indices of the
+ *  other DoFs are requested from their owners. Constraints have to be
+ *  consistent, i.e. a component is ACTIVE on all ranks or on none.
+ *
+ *  \note The index map and the owners of the complete mesh are released
+ *        before the communication, but every rank temporarily needs memory
+ *        of the order of the complete mesh. The mesh itself can be freed
+ *        after this call.
+ *
+ *  \tparam FEBASIS Type of the finite element basis
+ *  \tparam MESH    Type of mesh
+ *  \tparam FIELD   Type of field
+ *  \param[in]     comm              Communicator
+ *  \param[in]     globalMesh        Complete mesh
+ *  \param[in]     partition         Part of every element of the mesh
+ *  \param[in]     globalElementIDs  Global number of every local element
+ *  \param[in,out] field             Local field to be numbered
+ *  \return        Owned and ghost indices of this rank
+ */
+template<typename FEBASIS, typename MESH, typename FIELD>
+boost::shared_ptr<base::mpi::IndexLayout>
+base::mpi::numberDoFs( const Communicator& comm,
+                       const MESH& globalMesh,
+                       const std::vector<int>& partition,
+                       const std::vector<std::size_t>& globalElementIDs,
+                       FIELD& field )
+{
+    typedef typename FIELD::DegreeOfFreedom DoF;
+    static const unsigned size = DoF::size;
+    const std::size_t invalid = IndexLayout::invalid();
+
+    // global ID and owner of every local DoF, the global data is released
+    // at the end of this scope
+    const std::size_t numLocalDoFs =
+        std::distance( field.doFsBegin(), field.doFsEnd() );
+    std::vector<std::size_t> globalID(   numLocalDoFs, invalid );
+    std::vector<int>         localOwner( numLocalDoFs, comm.size() );
+    {
+        // global DoF connectivity
+        base::dof::IndexMap<FEBASIS> indexMap;
+        indexMap.generateDoFIndices( globalMesh );
+
+        // owner of every global DoF
+        std::vector<int> owner( indexMap.numDoFs(), comm.size() );
+        for ( std::size_t e = 0; e < partition.size(); e++ ) {
+            std::vector<std::size_t> doFIDs;
+            indexMap.lookUpElementDoFIndices( std::back_inserter( doFIDs ), e );
+            for ( std::size_t d = 0; d < doFIDs.size(); d++ )
+                owner[ doFIDs[d] ] = std::min( owner[ doFIDs[d] ], partition[e] );
+        }
+
+        typename FIELD::ElementPtrIter eIter = field.elementsBegin();
+        for ( std::size_t e = 0; e < globalElementIDs.size(); e++, ++eIter ) {
+            std::vector<std::size_t> doFIDs;
+            indexMap.lookUpElementDoFIndices( std::back_inserter( doFIDs ),
+                                              globalElementIDs[e] );
+            typename FIELD::Element::DoFPtrIter dIter = (*eIter) -> doFsBegin();
+            for ( std::size_t d = 0; d < doFIDs.size(); d++, ++dIter ) {
+                globalID[   (*dIter) -> getID() ] = doFIDs[d];
+                localOwner[ (*dIter) -> getID() ] = owner[ doFIDs[d] ];
+            }
+        }
+    }
+
+    // count and number the owned components
+    std::size_t numOwned = 0;
+    for ( typename FIELD::DoFPtrIter dIter = field.doFsBegin();
+          dIter != field.doFsEnd(); ++dIter ) {
+        if ( localOwner[ (*dIter) -> getID() ] != comm.rank() ) continue;
+        for ( unsigned d = 0; d < size; d++ )
+            if ( (*dIter) -> isActive( d ) ) numOwned++;
+    }
+
+    const std::size_t first = comm.exclusiveSum( numOwned );
+
+    // owned DoFs sorted by global ID for the look-up of requests
+    std::vector< std::pair<std::size_t,DoF*> > ownedDoFs;
+    std::size_t counter = first;
+    for ( typename FIELD::DoFPtrIter dIter = field.doFsBegin();
+          dIter != field.doFsEnd(); ++dIter ) {
+        const std::size_t id = globalID[ (*dIter) -> getID() ];
+        if ( localOwner[ (*dIter) -> getID() ] != comm.rank() ) continue;
+        ownedDoFs.push_back( std::make_pair( id, *dIter ) );
+        for ( unsigned d = 0; d < size; d++ )
+            if ( (*dIter) -> isActive( d ) ) (*dIter) -> setIndex( d, counter++ );
+    }
+    std::sort( ownedDoFs.begin(), ownedDoFs.end() );
+
+    // request the indices of the other DoFs from their owners
+    std::vector< std::vector<std::size_t> > requests( comm.size() ), received;
+    std::vector< std::vector<DoF*> > requested( comm.size() );
+    for ( typename FIELD::DoFPtrIter dIter = field.doFsBegin();
+          dIter != field.doFsEnd(); ++dIter ) {
+        const std::size_t id    = globalID[   (*dIter) -> getID() ];
+        const int         owner = localOwner[ (*dIter) -> getID() ];
+        if ( owner == comm.rank() ) continue;
+        requests[  owner ].push_back( id );
+        requested[ owner ].push_back( *dIter );
+    }
+    comm.allToAll( requests, received );
+
+    // reply with the indices of all components (invalid if not ACTIVE)
+    std::vector< std::vector<std::size_t> > replies( comm.size() ), answers;
+    for ( std::size_t r = 0; r < received.size(); r++ ) {
+        for ( std::size_t i = 0; i < received[r].size(); i++ ) {
+            typename std::vector< std::pair<std::size_t,DoF*> >::const_iterator
+                iter = std::lower_bound( ownedDoFs.begin(), ownedDoFs.end(),
+                                         std::make_pair( received[r][i],
+                                                         static_cast<DoF*>( 0 ) ) );
+            VERIFY_MSG( ( iter != ownedDoFs.end() ) and
+                        ( iter -> first == received[r][i] ),
+                        "Requested DoF is not owned" );
+            for ( unsigned d = 0; d < size; d++ )
+                replies[r].push_back( iter -> second -> isActive( d ) ?
+                                      iter -> second -> getIndex( d ) :
+                                      invalid );
+        }
+    }
+    comm.allToAll( replies, answers );
+
+    // pass the indices to the ghost DoFs
+    std::vector<std::size_t> ghosts;
+    for ( std::size_t r = 0; r < requested.size(); r++ ) {
+        for ( std::size_t i = 0; i < requested[r].size(); i++ ) {
+            for ( unsigned d = 0; d < size; d++ ) {
+                const std::size_t index = answers[r][ i * size + d ];
+                VERIFY_MSG( requested[r][i] -> isActive( d ) == ( index != invalid ),
+                            "Constraints are inconsistent across the ranks" );
+                if ( index == invalid ) continue;
+                requested[r][i] -> setIndex( d, index );
+                ghosts.push_back( index );
+            }
+        }
+    }
+
+    return boost::shared_ptr<IndexLayout>(
+        new IndexLayout( comm, first, numOwned, ghosts ) );
+}
+
+#endif
@@ -0,0 +1,244 @@
+//------------------------------------------------------------------------------
+// <preamble>
+// </preamble>
+//------------------------------------------------------------------------------
+
+//! @file   partition.hpp
+//! @author agent
+//! @date   2026
+
+#ifndef base_mpi_partition_hpp
+#define base_mpi_partition_hpp
+
+//------------------------------------------------------------------------------
+// std includes
+#include <vector>
+#include <algorithm>
+#include <iterator>
+#include <limits>
+// base includes
+#include <base/verify.hpp>
+#include <base/linearAlgebra.hpp>
+
+//------------------------------------------------------------------------------
+namespace base{
+    namespace mpi{
+
+        template<typename MESH>
+        void partitionElements( const MESH& mesh, const int numParts,
+                                std::vector<int>& partition );
+
+        template<typename MESH>
+        std::size_t extractLocalMesh( const MESH& globalMesh,
+                                      const std::vector<int>& partition,
+                                      const int rank,
+                                      MESH& localMesh,
+                                      std::vector<std::size_t>& globalElementIDs );
+
+        namespace detail_{
+
+            //------------------------------------------------------------------
+            //! Compare two elements by one coordinate of their centroids
+            template<unsigned DIM>
+            class CompareCentroids
+            {
+            public:
+                typedef typename base::Vector<DIM>::Type VecDim;
+
+                CompareCentroids( const std::vector<VecDim>& centroids,
+                                  const unsigned direction )
+                    : centroids_( centroids ), direction_( direction ) { }
+
+                bool operator()( const std::size_t a, const std::size_t b ) const
+                {
+                    return ( centroids_[a][direction_] <
+                             centroids_[b][direction_] );
+                }
+
+            private:
+                const std::vector<VecDim>& centroids_;
+                const unsigned             direction_;
+            };
+
+            //------------------------------------------------------------------
+            /** Recursive coordinate bisection of a range of elements.
+             *  The range is split in the direction of its largest extent such
+             *  that the sizes of the two halves are proportional to the number
+             *  of parts they receive.
+             */
+            template<unsigned DIM>
+            void bisect( const std::vector<typename base::Vector<DIM>::Type>& centroids,
+                         std::vector<std::size_t>::iterator first,
+                         std::vector<std::size_t>::iterator last,
+                         const int firstPart, const int numParts,
+                         std::vector<int>& partition )
+            {
+                if ( numParts == 1 ) {
+                    for ( ; first != last; ++first ) partition[ *first ] = firstPart;
+                    return;
+                }
+
+                // bounding box of the centroids
+                typename base::Vector<DIM>::Type xMin, xMax;
+                xMin.fill( std::numeric_limits<double>::max() );
+                xMax.fill( -std::numeric_limits<double>::max() );
+                for ( std::vector<std::size_t>::iterator e = first; e != last; ++e ) {
+                    xMin = xMin.cwiseMin( centroids[*e] );
+                    xMax = xMax.cwiseMax( centroids[*e] );
+                }
+
+                unsigned direction = 0;
+                ( xMax - xMin ).maxCoeff( &direction );
+
+                // split the range and the parts
+                const int numLeft = numParts / 2;
+                const std::size_t numElements = std::distance( first, last );
+                std::vector<std::size_t>::iterator middle =
+                    first + ( numElements * numLeft ) / numParts;
+                std::nth_element( first, middle, last,
+                                  CompareCentroids<DIM>( centroids, direction ) );
+
+                bisect<DIM>( centroids, first, middle, firstPart, numLeft,
+                             partition );
+                bisect<DIM>( centroids, middle, last, firstPart + numLeft,
+                             numParts - numLeft, partition );
+            }
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+/** Partition the elements of a mesh by recursive coordinate bisection.
+ *  The element centroids (mean of the element's nodes) are recursively split
+ *  at the median of the coordinate with the largest extent. The result are
+ *  compact parts of equal size, which is sufficient for the quasi-uniform
+ *  meshes used here.
+ *  \tparam MESH  Type of mesh
+ *  \param[in]  mesh       Mesh to partition
+ *  \param[in]  numParts   Number of parts (usually the number of ranks)
+ *  \param[out] partition  Part of every element
+ */
+template<typename MESH>
+void base::mpi::partitionElements( const MESH& mesh, const int numParts,
+                                   std::vector<int>& partition )
+{
+    static const unsigned dim = MESH::Node::dim;
+    typedef typename base::Vector<dim>::Type VecDim;
+
+    const std::size_t numElements =
+        std::distance( mesh.elementsBegin(), mesh.elementsEnd() );
+
+    // element centroids
+    std::vector<VecDim> centroids( numElements );
+    typename MESH::ElementPtrConstIter eIter = mesh.elementsBegin();
+    for ( std::size_t e = 0; e < numElements; e++, ++eIter ) {
+        VecDim sum = VecDim::Constant( 0. );
+        unsigned numNodes = 0;
+        typename MESH::Element::NodePtrConstIter nIter = (*eIter) -> nodesBegin();
+        typename MESH::Element::NodePtrConstIter nEnd  = (*eIter) -> nodesEnd();
+        for ( ; nIter != nEnd; ++nIter, numNodes++ ) sum += (*nIter) -> getX();
+        centroids[e] = sum / static_cast<double>( numNodes );
+    }
+
+    std::vector<std::size_t> elements( numElements );
+    for ( std::size_t e = 0; e < numElements; e++ ) elements[e] = e;
+
+    partition.assign( numElements, 0 );
+    detail_::bisect<dim>( centroids, elements.begin(), elements.end(),
+                          0, numParts, partition );
+}
+
+//------------------------------------------------------------------------------
+/** Extract the mesh of one rank including a layer of ghost elements.
+ *  The local mesh consists of the elements owned by the given rank, followed
+ *  by the ghost elements, i.e. all other elements which share a node with
+ *  an owned one. Hence, every matrix row of a DoF of an owned element can be
+ *  assembled completely from the local mesh. Nodes and elements are numbered
+ *  locally, the global element numbers are stored in globalElementIDs.
+ *  \note The boundary of the local mesh includes the cuts to the other parts.
+ *  \tparam MESH  Type of mesh
+ *  \param[in]  globalMesh        Complete mesh
+ *  \param[in]  partition         Part of every element
+ *  \param[in]  rank              Part to extract
+ *  \param[out] localMesh         Mesh of owned and ghost elements
+ *  \param[out] globalElementIDs  Global number of every local element
+ *  \return     Number of owned elements
+ */
+template<typename MESH>
+std::size_t base::mpi::extractLocalMesh( const MESH& globalMesh,
+                                         const std::vector<int>& partition,
+                                         const int rank,
+                                         MESH& localMesh,
+                                         std::vector<std::size_t>& globalElementIDs )
+{
+    typedef typename MESH::Element Element;
+
+    const std::size_t numNodes =
+        std::distance( globalMesh.nodesBegin(), globalMesh.nodesEnd() );
+    const std::size_t numElements =
+        std::distance( globalMesh.elementsBegin(), globalMesh.elementsEnd() );
+    VERIFY_MSG( partition.size() == numElements, "Partition does not fit" );
+
+    // mark the nodes of the owned elements
+    std::vector<bool> ownedNode( numNodes, false );
+    globalElementIDs.clear();
+    for ( std::size_t e = 0; e < numElements; e++ ) {
+        if ( partition[e] != rank ) continue;
+        globalElementIDs.push_back( e );
+        const Element* ep = globalMesh.elementPtr( e );
+        for ( typename Element::NodePtrConstIter nIter = ep -> nodesBegin();
+              nIter != ep -> nodesEnd(); ++nIter )
+            ownedNode[ (*nIter) -> getID() ] = true;
+    }
+    const std::size_t numOwned = globalElementIDs.size();
+
+    // ghost elements share a node with an owned element
+    for ( std::size_t e = 0; e < numElements; e++ ) {
+        if ( partition[e] == rank ) continue;
+        const Element* ep = globalMesh.elementPtr( e );
+        for ( typename Element::NodePtrConstIter nIter = ep -> nodesBegin();
+              nIter != ep -> nodesEnd(); ++nIter ) {
+            if ( ownedNode[ (*nIter) -> getID() ] ) {
+                globalElementIDs.push_back( e );
+                break;
+            }
+        }
+    }
+
+    // local node numbers in the order of the global ones
+    const std::size_t invalid = std::numeric_limits<std::size_t>::max();
+    std::vector<std::size_t> localNode( numNodes, invalid );
+    for ( std::size_t e = 0; e < globalElementIDs.size(); e++ ) {
+        const Element* ep = globalMesh.elementPtr( globalElementIDs[e] );
+        for ( typename Element::NodePtrConstIter nIter = ep -> nodesBegin();
+              nIter != ep -> nodesEnd(); ++nIter )
+            localNode[ (*nIter) -> getID() ] = 0;
+    }
+    std::size_t numLocalNodes = 0;
+    for ( std::size_t n = 0; n < numNodes; n++ )
+        if ( localNode[n] != invalid ) localNode[n] = numLocalNodes++;
+
+    // copy nodes and elements
+    localMesh.allocate( numLocalNodes, globalElementIDs.size() );
+
+    for ( std::size_t n = 0; n < numNodes; n++ ) {
+        if ( localNode[n] == invalid ) continue;
+        typename MESH::Node* np = localMesh.nodePtr( localNode[n] );
+        np -> setX( globalMesh.nodePtr( n ) -> getX() );
+        np -> setID( localNode[n] );
+    }
+
+    for ( std::size_t e = 0; e < globalElementIDs.size(); e++ ) {
+        const Element* ep = globalMesh.elementPtr( globalElementIDs[e] );
+        Element* lp = localMesh.elementPtr( e );
+        typename Element::NodePtrConstIter nIter = ep -> nodesBegin();
+        typename Element::NodePtrIter      lIter = lp -> nodesBegin();
+        for ( ; nIter != ep -> nodesEnd(); ++nIter, ++lIter )
+            *lIter = localMesh.nodePtr( localNode[ (*nIter) -> getID() ] );
+        lp -> setID( e );
+    }
+
+    return numOwned;
+}
+
+#endif
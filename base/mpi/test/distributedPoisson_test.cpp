@@ -0,0 +1,152 @@
+#include <sstream>
+#include <vector>
+#include <cmath>
+#include <iterator>
+#include <boost/test/minimal.hpp>
+#include <boost/bind.hpp>
+#include <boost/shared_ptr.hpp>
+
+#include <tools/meshGeneration/unitCube/unitCube.hpp>
+#include <base/Unstructured.hpp>
+#include <base/mesh/MeshBoundary.hpp>
+#include <base/io/smf/Reader.hpp>
+#include <base/Quadrature.hpp>
+#include <base/fe/Basis.hpp>
+#include <base/Field.hpp>
+#include <base/dof/numbering.hpp>
+#include <base/dof/generate.hpp>
+#include <base/dof/Distribute.hpp>
+#include <base/dof/constrainBoundary.hpp>
+#include <base/asmb/FieldBinder.hpp>
+#include <base/asmb/StiffnessMatrix.hpp>
+#include <base/asmb/BodyForce.hpp>
+#include <base/solver/Eigen3.hpp>
+#include <base/mpi/Communicator.hpp>
+#include <base/mpi/partition.hpp>
+#include <base/mpi/numbering.hpp>
+#include <base/mpi/Solver.hpp>
+
+#include <heat/Laplace.hpp>
+
+//! \cond SKIPDOX
+// Poisson problem solved on the local meshes of all ranks and, for
+// comparison, by every rank on the complete mesh; run with mpirun -np N
+typedef base::Unstructured<base::HEX,1>        Mesh;
+typedef base::Quadrature<3,base::HEX>          Quadrature;
+typedef base::fe::Basis<base::HEX,1>           FEBasis;
+typedef base::Field<FEBasis,1>                 Field;
+typedef Field::DegreeOfFreedom                 DoF;
+typedef base::asmb::FieldBinder<Mesh,Field>    FieldBinder;
+typedef FieldBinder::TupleBinder<1,1>::Type    FTB;
+typedef heat::Laplace<FTB::Tuple>              Laplace;
+
+void boundaryValue( const base::Vector<3>::Type& x, DoF* doFPtr )
+{
+    bool onBoundary = false;
+    for ( unsigned d = 0; d < 3; d++ )
+        onBoundary = onBoundary or ( std::abs( x[d] ) < 1.e-6 ) or
+                                   ( std::abs( x[d] - 1. ) < 1.e-6 );
+    if ( onBoundary and doFPtr -> isActive( 0 ) )
+        doFPtr -> constrainValue( 0, x[0] - x[2] );
+}
+
+base::Vector<1>::Type force( const base::Vector<3>::Type& x )
+{
+    return base::constantVector<1>( std::exp( x[0] + 2. * x[1] ) * ( 1. + x[2] ) );
+}
+
+// register the pattern and assemble the system
+template<typename SOLVER>
+void assemble( Mesh& mesh, Field& field, SOLVER& solver )
+{
+    Quadrature quadrature;
+    FieldBinder fieldBinder( mesh, field );
+    solver.template registerFields<FTB>( fieldBinder );
+    Laplace laplace( 1.0 );
+    base::asmb::stiffnessMatrixComputation<FTB>( quadrature, solver,
+                                                 fieldBinder, laplace );
+    base::asmb::bodyForceComputation<FTB>( quadrature, solver, fieldBinder,
+                                           boost::bind( &force, _1 ) );
+    solver.finishAssembly();
+}
+
+// generate the DoFs and constrain the boundary
+void constrain( Mesh& mesh, Field& field )
+{
+    base::dof::generate<FEBasis>( mesh, field );
+    base::mesh::MeshBoundary meshBoundary;
+    meshBoundary.create( mesh.elementsBegin(), mesh.elementsEnd() );
+    base::dof::constrainBoundary<FEBasis>( meshBoundary.begin(), meshBoundary.end(),
+                                           mesh, field,
+                                           boost::bind( &boundaryValue, _1, _2 ) );
+}
+
+int test_main( int argc, char * argv[] )
+{
+    base::mpi::Environment environment( argc, argv );
+    const base::mpi::Communicator comm;
+
+    Mesh globalMesh;
+    {
+        std::stringstream smf;
+        tools::meshGeneration::unitCube::SMF<3,false,1>::apply( 5, 4, 3, smf );
+        base::io::smf::readMesh( smf, globalMesh );
+    }
+
+    // serial reference solution
+    Field globalField;
+    constrain( globalMesh, globalField );
+    {
+        const std::size_t numDoFs =
+            base::dof::numberDoFsConsecutively( globalField.doFsBegin(),
+                                                globalField.doFsEnd() );
+        base::solver::Eigen3 solver( numDoFs );
+        assemble( globalMesh, globalField, solver );
+        solver.choleskySolve();
+        base::dof::setDoFsFromSolver( solver, globalField );
+    }
+
+    // distributed solution
+    std::vector<int> partition;
+    base::mpi::partitionElements( globalMesh, comm.size(), partition );
+
+    Mesh mesh;
+    std::vector<std::size_t> globalElementIDs;
+    const std::size_t numOwned =
+        base::mpi::extractLocalMesh( globalMesh, partition, comm.rank(),
+                                     mesh, globalElementIDs );
+    BOOST_CHECK( comm.sum( numOwned ) ==
+                 static_cast<std::size_t>( std::distance( globalMesh.elementsBegin(),
+                                                          globalMesh.elementsEnd() ) ) );
+
+    Field field;
+    constrain( mesh, field );
+    const boost::shared_ptr<base::mpi::IndexLayout> layout =
+        base::mpi::numberDoFs<FEBasis>( comm, globalMesh, partition,
+                                        globalElementIDs, field );
+
+    base::mpi::Solver solver( *layout );
+    assemble( mesh, field, solver );
+    const int numIter = solver.cgSolve( 1.e-12 );
+    base::dof::setDoFsFromSolver( solver, field );
+    BOOST_CHECK( numIter > 5 );
+
+    // compare the DoFs of all local elements with their global counterparts
+    double maxDiff = 0., maxValue = 0.;
+    for ( std::size_t e = 0; e < globalElementIDs.size(); e++ ) {
+        Field::Element::DoFPtrIter local = field.elementPtr( e ) -> doFsBegin();
+        Field::Element::DoFPtrIter last  = field.elementPtr( e ) -> doFsEnd();
+        Field::Element::DoFPtrIter global =
+            globalField.elementPtr( globalElementIDs[e] ) -> doFsBegin();
+        for ( ; local != last; ++local, ++global ) {
+            maxDiff  = std::max( maxDiff,  std::abs( (*local)  -> getValue( 0 ) -
+                                                     (*global) -> getValue( 0 ) ) );
+            maxValue = std::max( maxValue, std::abs( (*global) -> getValue( 0 ) ) );
+        }
+    }
+    BOOST_CHECK( maxValue > 0.1 );
+    BOOST_CHECK( comm.max( maxDiff ) < 1.e-9 * maxValue );
+
+    return 0;
+}
+//! \endcond
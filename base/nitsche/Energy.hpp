@@ -21,6 +21,8 @@
 #include <base/asmb/ForceIntegrator.hpp>
 // base/auxi includes
 #include <base/auxi/FunEvaluationPolicy.hpp>
+// base/nitsche includes
+#include <base/nitsche/surfaceAssembly.hpp>
 // base/post includes
 #include <base/post/evaluateField.hpp>
 
@@ -50,28 +52,19 @@ namespace base{
             // object to compute the LHS penalty term
             typedef base::nitsche::Energy<KERNEL,
                                           typename SURFACETUPLEBINDER::Tuple> Energy;
-            Energy energy( kernel );
+            const Energy energy( kernel );
             
             // primal
             typedef base::asmb::StiffnessMatrix<SURFACEQUADRATURE,SOLVER,
                                                 typename SURFACETUPLEBINDER::Tuple> SysMat;
 
-            typename SysMat::Kernel kernelFunP =
-                boost::bind( &Energy::primal, &energy, _1, _2, _3, _4 );
-            
-            SysMat primal( kernelFunP, surfaceQuadrature, solver, false );
-            
-            // apply
-            typename BOUNDFIELD::FieldIterator iter = boundField.elementsBegin();
-            typename BOUNDFIELD::FieldIterator end  = boundField.elementsEnd();
-            for ( ; iter != end; ++iter ) {
+            // element-wise multiplier
+            const detail_::EnergyWeight<PARAMETER> weight( parameter, inOut, plusMinus );
 
-                const double sign  = ( plusMinus ? 1.0 : -1.0 );
-                const double kappa = sign * parameter.energyWeight( iter, inOut );
-                energy.setKappa( kappa );
-
-                primal( SURFACETUPLEBINDER::makeTuple(           *iter ) );
-            }
+            // apply
+            assembleWeightedSurfaceTerm<SysMat,SURFACETUPLEBINDER,false>(
+                boost::bind( &Energy::weightedPrimal, &energy, _1, _2, _3, _4, _5 ),
+                surfaceQuadrature, solver, boundField, weight );
 
             return;
         }
@@ -93,29 +86,20 @@ namespace base{
             // object to compute the LHS penalty term
             typedef base::nitsche::Energy<KERNEL,
                                           typename SURFACETUPLEBINDER::Tuple> Energy;
-            Energy energy( kernel );
+            const Energy energy( kernel );
             
             // dual
             typedef base::asmb::StiffnessMatrix<SURFACEQUADRATURE,SOLVER,
                                                 typename SURFACETUPLEBINDER::TransposedTuple>
                 SysMatT;
 
-            typename SysMatT::Kernel kernelFunD =
-                boost::bind( &Energy::dual, &energy, _1, _2, _3, _4 );
-            
-            SysMatT dual( kernelFunD, surfaceQuadrature, solver, false );
+            // element-wise multiplier
+            const detail_::EnergyWeight<PARAMETER> weight( parameter, inOut, plusMinus );
 
             // apply
-            typename BOUNDFIELD::FieldIterator iter = boundField.elementsBegin();
-            typename BOUNDFIELD::FieldIterator end  = boundField.elementsEnd();
-            for ( ; iter != end; ++iter ) {
-
-                const double sign  = ( plusMinus ? 1.0 : -1.0 );
-                const double kappa = sign * parameter.energyWeight( iter, inOut );
-                energy.setKappa( kappa );
-
-                dual(   SURFACETUPLEBINDER::makeTransposedTuple( *iter ) );
-            }
+            assembleWeightedSurfaceTerm<SysMatT,SURFACETUPLEBINDER,true>(
+                boost::bind( &Energy::weightedDual, &energy, _1, _2, _3, _4, _5 ),
+                surfaceQuadrature, solver, boundField, weight );
 
             return;
         }
@@ -160,30 +144,21 @@ namespace base{
                 // object to compute the LHS penalty term
                 typedef base::nitsche::Energy<KERNEL,
                                               typename SURFACETUPLEBINDER::Tuple> Energy;
-                Energy energy( kernel );
+                const Energy energy( kernel );
 
                 // integrator and assembler object
                 typedef base::asmb::ForceIntegrator<SURFACEQUADRATURE,SOLVER,
                                                     typename SURFACETUPLEBINDER::TransposedTuple>
                     SurfaceForceInt;
-                typename SurfaceForceInt::ForceKernel surfaceForceKernel =
-                    boost::bind( &Energy::template rhs<EVALUATIONPOLICY>, &energy,
-                                 _1, _2, _3, boost::ref( bcFun ), _4 );
-            
-                SurfaceForceInt surfaceForceInt( surfaceForceKernel,
-                                                 surfaceQuadrature, solver );
 
-                // apply
-                typename BOUNDFIELD::FieldIterator iter = boundField.elementsBegin();
-                typename BOUNDFIELD::FieldIterator end  = boundField.elementsEnd();
-                for ( ; iter != end; ++iter ) {
-                    
-                    const double sign  = (plusMinus ? 1.0 : -1.0 );
-                    const double kappa = sign * parameter.energyWeight( iter, inOut );
-                    energy.setKappa( kappa );
+                // element-wise multiplier
+                const EnergyWeight<PARAMETER> weight( parameter, inOut, plusMinus );
 
-                    surfaceForceInt( SURFACETUPLEBINDER::makeTransposedTuple( *iter ) );
-                }
+                // apply
+                assembleWeightedSurfaceTerm<SurfaceForceInt,SURFACETUPLEBINDER,true>(
+                    boost::bind( &Energy::template weightedRhs<EVALUATIONPOLICY>,
+                                 &energy, _1, _2, _3, _4, boost::ref( bcFun ), _5 ),
+                    surfaceQuadrature, solver, boundField, weight );
 
                 return;
 
@@ -266,29 +241,20 @@ namespace base{
             // object to compute the LHS penalty term
             typedef Energy<KERNEL,
                            typename SURFACETUPLEBINDER::Tuple> Energy;
-            Energy energy( kernel );
+            const Energy energy( kernel );
 
             // integrator and assembler object
             typedef base::asmb::ForceIntegrator<SURFACEQUADRATURE,SOLVER,
                                                 typename SURFACETUPLEBINDER::Tuple>
                 SurfaceForceInt;
-            typename SurfaceForceInt::ForceKernel surfaceForceKernel =
-                boost::bind( &Energy::residual, &energy, _1, _2, _3, _4 );
-            
-            SurfaceForceInt surfaceForceInt( surfaceForceKernel,
-                                             surfaceQuadrature, solver );
-            
-            // apply
-            typename BOUNDFIELD::FieldIterator iter = boundField.elementsBegin();
-            typename BOUNDFIELD::FieldIterator end  = boundField.elementsEnd();
-            for ( ; iter != end; ++iter ) {
 
-                const double sign  = (plusMinus ? 1.0 : -1.0 );
-                const double kappa = sign * parameter.energyWeight( iter, inOut );
-                energy.setKappa( kappa );
+            // element-wise multiplier
+            const detail_::EnergyWeight<PARAMETER> weight( parameter, inOut, plusMinus );
 
-                surfaceForceInt( SURFACETUPLEBINDER::makeTuple( *iter ) );
-            }
+            // apply
+            assembleWeightedSurfaceTerm<SurfaceForceInt,SURFACETUPLEBINDER,false>(
+                boost::bind( &Energy::weightedResidual, &energy, _1, _2, _3, _4, _5 ),
+                surfaceQuadrature, solver, boundField, weight );
 
             return;
         }
@@ -310,30 +276,21 @@ namespace base{
             // object to compute the LHS penalty term
             typedef Energy<KERNEL,
                            typename SURFACETUPLEBINDER::Tuple> Energy;
-            Energy energy( kernel );
+            const Energy energy( kernel );
 
             // integrator and assembler object
             typedef base::asmb::ForceIntegrator<SURFACEQUADRATURE,SOLVER,
                                                 typename SURFACETUPLEBINDER::TransposedTuple>
                 SurfaceForceInt;
-            typename SurfaceForceInt::ForceKernel surfaceForceKernel =
-                boost::bind( &Energy::transposedLinearisedResidual,
-                             &energy, _1, _2, _3, _4 );
-            
-            SurfaceForceInt surfaceForceInt( surfaceForceKernel,
-                                             surfaceQuadrature, solver );
-            
-            // apply
-            typename BOUNDFIELD::FieldIterator iter = boundField.elementsBegin();
-            typename BOUNDFIELD::FieldIterator end  = boundField.elementsEnd();
-            for ( ; iter != end; ++iter ) {
 
-                const double sign  = (plusMinus ? 1.0 : -1.0 );
-                const double kappa = sign * parameter.energyWeight( iter, inOut );
-                energy.setKappa( kappa );
+            // element-wise multiplier
+            const detail_::EnergyWeight<PARAMETER> weight( parameter, inOut, plusMinus );
 
-                surfaceForceInt( SURFACETUPLEBINDER::makeTransposedTuple( *iter ) );
-            }
+            // apply
+            assembleWeightedSurfaceTerm<SurfaceForceInt,SURFACETUPLEBINDER,true>(
+                boost::bind( &Energy::weightedTransposedLinearisedResidual,
+                             &energy, _1, _2, _3, _4, _5 ),
+                surfaceQuadrature, solver, boundField, weight );
 
             return;
         }
@@ -447,7 +404,17 @@ public:
     void primal( const SurfFieldTuple& surfFieldTuple,
                  const LocalVecDim&    eta,
                  const double          weight,
-                 base::MatrixD&        result )
+                 base::MatrixD&        result ) const
+    {
+        this -> weightedPrimal( surfFieldTuple, eta, weight, kappa_, result );
+    }
+
+    //! Primal term with the multiplier kappa given as argument
+    void weightedPrimal( const SurfFieldTuple& surfFieldTuple,
+                         const LocalVecDim&    eta,
+                         const double          weight,
+                         const double          kappa,
+                         base::MatrixD&        result ) const
     {
         // extract surface geometry element
         const SurfaceElement* surfEp  = surfFieldTuple.geomElementPtr();
@@ -459,7 +426,7 @@ public:
 
         // call implementation
         const bool isDual = false;
-        this -> lhsHelper_( domainFieldTuple, surfEp, eta, weight,
+        this -> lhsHelper_( domainFieldTuple, surfEp, eta, weight, kappa,
                             isDual, result );
     }
     
@@ -485,7 +452,17 @@ public:
     void dual( const TransposedSurfFieldTuple& surfFieldTupleT,
                const LocalVecDim&              eta,
                const double                    weight,
-               base::MatrixD&                  result )
+               base::MatrixD&                  result ) const
+    {
+        this -> weightedDual( surfFieldTupleT, eta, weight, kappa_, result );
+    }
+
+    //! Dual term with the multiplier kappa given as argument
+    void weightedDual( const TransposedSurfFieldTuple& surfFieldTupleT,
+                       const LocalVecDim&              eta,
+                       const double                    weight,
+                       const double                    kappa,
+                       base::MatrixD&                  result ) const
     {
         // extract surface geometry element of the tuple
         const SurfaceElement* surfEp  = surfFieldTupleT.geomElementPtr();
@@ -501,7 +478,7 @@ public:
 
         // call implementation
         const bool isDual = true;
-        this -> lhsHelper_( domainFieldTuple, surfEp, eta, weight,
+        this -> lhsHelper_( domainFieldTuple, surfEp, eta, weight, kappa,
                             isDual, result );
     }
 
@@ -517,6 +494,7 @@ private:
      *  \param[in]  surfEp            Pointer to surface geometry element
      *  \param[in]  eta               Local surface coordinate
      *  \param[in]  weight            Quadrature weight
+     *  \param[in]  kappa             Multiplier of the term
      *  \param[in]  isDual            Flag for the dual case
      *  \param[out] result            Output
      */
@@ -524,8 +502,9 @@ private:
                      const SurfaceElement*    surfEp,
                      const LocalVecDim&       eta,
                      const double             weight,
+                     const double             kappa,
                      const bool               isDual, 
-                     base::MatrixD&           result )
+                     base::MatrixD&           result ) const
     {
         // Get pointer to domain element
         const DomainElement* domainEp = surfEp -> getDomainElementPointer();
@@ -553,7 +532,7 @@ private:
         const unsigned numFieldBlocks = static_cast<unsigned>(testFunValues.size() );
         const unsigned otherSize      = static_cast<unsigned>(coNormal.cols() );
 
-        const double scalar = -1. * detG * weight * kappa_;
+        const double scalar = -1. * detG * weight * kappa;
 
         for ( unsigned i = 0; i < numFieldBlocks; i++ ) {
             for ( unsigned d = 0; d < doFSize; d++ ) {
@@ -588,7 +567,20 @@ public:
               const LocalVecDim&              eta,
               const double                    weight,
               const typename EVALPOL::Fun&    bcFun, 
-              base::VectorD&                  result )
+              base::VectorD&                  result ) const
+    {
+        this -> template weightedRhs<EVALPOL>( surfFieldTuple, eta, weight,
+                                               kappa_, bcFun, result );
+    }
+
+    //! Right hand side term with the multiplier kappa given as argument
+    template<typename EVALPOL>
+    void weightedRhs( const TransposedSurfFieldTuple& surfFieldTuple, 
+                      const LocalVecDim&              eta,
+                      const double                    weight,
+                      const double                    kappa,
+                      const typename EVALPOL::Fun&    bcFun, 
+                      base::VectorD&                  result ) const
     {
         // extract test and trial elements from tuple
         const SurfaceElement* surfEp  = surfFieldTuple.geomElementPtr();
@@ -626,7 +618,7 @@ public:
                                                      xi );
 
         // scalar multiplier
-        const double scalar = -1. * detG * weight * kappa_;
+        const double scalar = -1. * detG * weight * kappa;
 
         const unsigned otherSize = static_cast<unsigned>(coNormal.cols() );
         
@@ -653,7 +645,17 @@ public:
     void residual( const SurfFieldTuple& surfFieldTuple,
                    const LocalVecDim&    eta,
                    const double          weight,
-                   base::VectorD&        result )
+                   base::VectorD&        result ) const
+    {
+        this -> weightedResidual( surfFieldTuple, eta, weight, kappa_, result );
+    }
+
+    //! Residual term with the multiplier kappa given as argument
+    void weightedResidual( const SurfFieldTuple& surfFieldTuple,
+                           const LocalVecDim&    eta,
+                           const double          weight,
+                           const double          kappa,
+                           base::VectorD&        result ) const
     {
         // extract test and trial elements from tuple
         const SurfaceElement* surfEp  = surfFieldTuple.geomElementPtr();
@@ -678,7 +680,7 @@ public:
                                   normal, coNormalResidual );
 
         //
-        const double scalar = detG * weight * kappa_;
+        const double scalar = detG * weight * kappa;
 
         result += scalar * coNormalResidual;
 
@@ -696,7 +698,19 @@ public:
     void transposedLinearisedResidual( const TransposedSurfFieldTuple& surfFieldTuple,
                                        const LocalVecDim&    eta,
                                        const double          weight,
-                                       base::VectorD&        result )
+                                       base::VectorD&        result ) const
+    {
+        this -> weightedTransposedLinearisedResidual( surfFieldTuple, eta, weight,
+                                                      kappa_, result );
+    }
+
+    //! Transposed linearised residual with the multiplier kappa as argument
+    void weightedTransposedLinearisedResidual(
+        const TransposedSurfFieldTuple& surfFieldTuple,
+        const LocalVecDim&              eta,
+        const double                    weight,
+        const double                    kappa,
+        base::VectorD&                  result ) const
     {
         // extract test and trial elements from tuple
         const SurfaceElement* surfEp  = surfFieldTuple.geomElementPtr();
@@ -730,7 +744,7 @@ public:
                                                      xi );
 
         // scalar multiplier
-        const double scalar = -1. * detG * weight * kappa_;
+        const double scalar = -1. * detG * weight * kappa;
 
         const unsigned otherSize = static_cast<unsigned>(coNormal.cols() );
         
@@ -24,6 +24,8 @@
 // base/auxi includes
 #include <base/auxi/FunEvaluationPolicy.hpp>
 #include <base/auxi/EqualPointers.hpp>
+// base/nitsche includes
+#include <base/nitsche/surfaceAssembly.hpp>
 // base/post includes
 #include <base/post/evaluateField.hpp>
 
@@ -50,29 +52,20 @@ namespace base{
             // object to compute the LHS penalty term
             typedef base::nitsche::Penalty<typename SURFACETUPLEBINDER::Tuple>
                 Penalty;
-            Penalty penalty( multiplier );
+            const Penalty penalty( multiplier );
 
             // integrator and assembler object
             typedef base::asmb::StiffnessMatrix<SURFACEQUADRATURE,SOLVER,
                                                 typename SURFACETUPLEBINDER::Tuple> SysMat;
-            
-            typename SysMat::Kernel kernel =
-                boost::bind( &Penalty::tangentStiffness, &penalty, _1, _2, _3, _4 );
 
-            SysMat systemMat( kernel, surfaceQuadrature, solver, false );
+            // local penalty factor
+            const detail_::PenaltyWeight<PARAMETER> weight( parameter, multiplier );
 
             // apply
-            typename BOUNDFIELD::FieldIterator iter = boundField.elementsBegin();
-            typename BOUNDFIELD::FieldIterator end  = boundField.elementsEnd();
-            for ( ; iter != end; ++iter ) {
-
-                // get local penalty factor
-                const double factor = multiplier * parameter.penaltyWeight( iter );
-
-                penalty.setFactor( factor );
-                
-                systemMat( SURFACETUPLEBINDER::makeTuple( *iter ) );
-            }
+            assembleWeightedSurfaceTerm<SysMat,SURFACETUPLEBINDER,false>(
+                boost::bind( &Penalty::weightedTangentStiffness, &penalty,
+                             _1, _2, _3, _4, _5 ),
+                surfaceQuadrature, solver, boundField, weight );
             
             return;
         }
@@ -93,31 +86,22 @@ namespace base{
             {
                 // object to compute the LHS penalty term
                 typedef base::nitsche::Penalty<typename SURFACETUPLEBINDER::Tuple> Penalty;
-                Penalty penalty( multiplier );
+                const Penalty penalty( multiplier );
 
                 // integrator and assembler object
                 typedef base::asmb::ForceIntegrator<SURFACEQUADRATURE,SOLVER,
                                                     typename SURFACETUPLEBINDER::Tuple>
                     SurfaceForceInt;
-                
-                typename SurfaceForceInt::ForceKernel surfaceForceKernel =
-                    boost::bind( &Penalty::template residualBoundary<EVALUATIONPOLICY>,
-                                 &penalty, _1, _2, _3,
-                                 boost::ref( bcFun ), _4 );
-                SurfaceForceInt surfaceForceInt( surfaceForceKernel,
-                                                  surfaceQuadrature, solver );
+
+                // local penalty factor
+                const PenaltyWeight<PARAMETER> weight( parameter, multiplier );
                 
                 // apply
-                typename BOUNDFIELD::FieldIterator iter = boundField.elementsBegin();
-                typename BOUNDFIELD::FieldIterator end  = boundField.elementsEnd();
-                for ( ; iter != end; ++iter ) {
-
-                    const double factor = multiplier * parameter.penaltyWeight( iter );
-                    
-                    penalty.setFactor( factor );
-                    
-                    surfaceForceInt( SURFACETUPLEBINDER::makeTuple( *iter ) );
-                }
+                assembleWeightedSurfaceTerm<SurfaceForceInt,SURFACETUPLEBINDER,false>(
+                    boost::bind( &Penalty::template weightedResidualBoundary<EVALUATIONPOLICY>,
+                                 &penalty, _1, _2, _3, _4,
+                                 boost::ref( bcFun ), _5 ),
+                    surfaceQuadrature, solver, boundField, weight );
             
                 return;
 
@@ -193,29 +177,21 @@ namespace base{
         {
             // object to compute the LHS penalty term
             typedef base::nitsche::Penalty<typename SURFACETUPLEBINDER::Tuple> Penalty;
-            Penalty penalty( multiplier );
+            const Penalty penalty( multiplier );
 
             // integrator and assembler object
             typedef base::asmb::ForceIntegrator<SURFACEQUADRATURE,SOLVER,
                                                 typename SURFACETUPLEBINDER::Tuple>
                 SurfaceForceInt;
-                
-            typename SurfaceForceInt::ForceKernel surfaceForceKernel =
-                boost::bind( &Penalty::residualInterface, &penalty, _1, _2, _3, _4 );
-            SurfaceForceInt surfaceForceInt( surfaceForceKernel,
-                                             surfaceQuadrature, solver );
+
+            // local penalty factor
+            const detail_::PenaltyWeight<PARAMETER> weight( parameter, multiplier );
                 
             // apply
-            typename BOUNDFIELD::FieldIterator iter = boundField.elementsBegin();
-            typename BOUNDFIELD::FieldIterator end  = boundField.elementsEnd();
-            for ( ; iter != end; ++iter ) {
-
-                const double factor = multiplier * parameter.penaltyWeight( iter );
-                    
-                penalty.setFactor( factor );
-                    
-                surfaceForceInt( SURFACETUPLEBINDER::makeTuple( *iter ) );
-            }
+            assembleWeightedSurfaceTerm<SurfaceForceInt,SURFACETUPLEBINDER,false>(
+                boost::bind( &Penalty::weightedResidualInterface, &penalty,
+                             _1, _2, _3, _4, _5 ),
+                surfaceQuadrature, solver, boundField, weight );
             
             return;
         }
@@ -308,6 +284,17 @@ public:
                            const LocalVecDim&    eta,
                            const double          weight,
                            base::MatrixD&        result ) const
+    {
+        this -> weightedTangentStiffness( surfFieldTuple, eta, weight,
+                                          factor_, result );
+    }
+
+    //! System matrix term with the factor given as argument
+    void weightedTangentStiffness( const SurfFieldTuple& surfFieldTuple,
+                                   const LocalVecDim&    eta,
+                                   const double          weight,
+                                   const double          factor,
+                                   base::MatrixD&        result ) const
     {
         // extract test and trial elements from tuple
         const SurfaceElement* surfEp  = surfFieldTuple.geomElementPtr();
@@ -341,7 +328,7 @@ public:
         const unsigned numColBlocks = static_cast<unsigned>( trialFunValues.size() );
 
         // scalar multiplier of the whole entry
-        const double aux = weight * detG * (factor_ / h);
+        const double aux = weight * detG * (factor / h);
 
         // Loop over shape functions
         for ( unsigned i = 0; i < numRowBlocks; i++ ) {
@@ -381,6 +368,20 @@ public:
                            const double       weight,
                            const typename EVALPOL::Fun& bcFun,
                            base::VectorD&        result ) const
+    {
+        this -> template weightedResidualBoundary<EVALPOL>( surfFieldTuple, eta,
+                                                            weight, factor_,
+                                                            bcFun, result );
+    }
+
+    //! Boundary residual with the factor given as argument
+    template<typename EVALPOL>
+    void weightedResidualBoundary( const SurfFieldTuple& surfFieldTuple,
+                                   const LocalVecDim& eta,
+                                   const double       weight,
+                                   const double       factor,
+                                   const typename EVALPOL::Fun& bcFun,
+                                   base::VectorD&        result ) const
     {
         // extract test and trial elements from tuple
         const SurfaceElement* surfEp  = surfFieldTuple.geomElementPtr();
@@ -398,7 +399,8 @@ public:
         const VecDoF  u = base::post::evaluateField( domainEp, trialEp, xi );
         const VecDoF  funResidual = u - bc;
 
-        this -> evaluateResidual_( surfFieldTuple, eta, weight, funResidual, result );
+        this -> evaluateResidual_( surfFieldTuple, eta, weight, factor,
+                                   funResidual, result );
 
         return;
     }
@@ -419,6 +421,17 @@ public:
                             const LocalVecDim&    eta,
                             const double          weight,
                             base::VectorD&        result ) const
+    {
+        this -> weightedResidualInterface( surfFieldTuple, eta, weight,
+                                           factor_, result );
+    }
+
+    //! Interface residual with the factor given as argument
+    void weightedResidualInterface( const SurfFieldTuple& surfFieldTuple,
+                                    const LocalVecDim&    eta,
+                                    const double          weight,
+                                    const double          factor,
+                                    base::VectorD&        result ) const
     {
         // extract test and trial elements from tuple
         const SurfaceElement* surfEp  = surfFieldTuple.geomElementPtr();
@@ -434,7 +447,7 @@ public:
         // Evaluate boundary coondition
         const VecDoF  u = base::post::evaluateField( domainEp, trialEp, xi );
 
-        this -> evaluateResidual_( surfFieldTuple, eta, weight, u, result );
+        this -> evaluateResidual_( surfFieldTuple, eta, weight, factor, u, result );
 
         return;
     }
@@ -445,6 +458,7 @@ private:
     void evaluateResidual_( const SurfFieldTuple& surfFieldTuple,
                             const LocalVecDim& eta,
                             const double       weight,
+                            const double       factor,
                             const VecDoF&      funResidual,
                             base::VectorD&     result ) const
     {
@@ -475,7 +489,7 @@ private:
         const unsigned numRowBlocks = static_cast<unsigned>( testFunValues.size() );
 
         // scalar multiplier of the whole entry
-        const double aux = weight * detG * (factor_ / h);
+        const double aux = weight * detG * (factor / h);
         
         // Loop over shape functions
         for ( unsigned i = 0; i < numRowBlocks; i++ ) {
@@ -0,0 +1,223 @@
+//------------------------------------------------------------------------------
+// <preamble>
+// </preamble>
+//------------------------------------------------------------------------------
+
+//! @file   surfaceAssembly.hpp
+//! @author agent
+//! @date   2026
+
+#ifndef base_nitsche_surfaceassembly_hpp
+#define base_nitsche_surfaceassembly_hpp
+
+//------------------------------------------------------------------------------
+// std includes
+#include <iterator>
+// boost includes
+#include <boost/function.hpp>
+#include <boost/bind.hpp>
+#include <boost/ref.hpp>
+// base/auxi includes
+#include <base/auxi/parallel.hpp>
+
+//------------------------------------------------------------------------------
+namespace base{
+    namespace nitsche{
+
+        namespace detail_{
+
+            //------------------------------------------------------------------
+            //! Generate the normal or the transposed tuple from the binder
+            template<typename SURFACETUPLEBINDER, bool TRANSPOSED>
+            struct MakeSurfaceTuple
+            {
+                typedef typename SURFACETUPLEBINDER::Tuple Type;
+
+                template<typename EPT>
+                static Type apply( const EPT& ept )
+                {
+                    return SURFACETUPLEBINDER::makeTuple( ept );
+                }
+            };
+
+            template<typename SURFACETUPLEBINDER>
+            struct MakeSurfaceTuple<SURFACETUPLEBINDER,true>
+            {
+                typedef typename SURFACETUPLEBINDER::TransposedTuple Type;
+
+                template<typename EPT>
+                static Type apply( const EPT& ept )
+                {
+                    return SURFACETUPLEBINDER::makeTransposedTuple( ept );
+                }
+            };
+
+            //------------------------------------------------------------------
+            //! Weight of the energy terms: sign * parameter.energyWeight()
+            template<typename PARAMETER>
+            class EnergyWeight
+            {
+            public:
+                EnergyWeight( const PARAMETER& parameter,
+                              const bool inOut, const bool plusMinus )
+                    : parameter_( parameter ), inOut_( inOut ),
+                      sign_( plusMinus ? 1.0 : -1.0 ) { }
+
+                template<typename ITER>
+                double operator()( const ITER iter ) const
+                {
+                    return sign_ * parameter_.energyWeight( iter, inOut_ );
+                }
+
+            private:
+                const PARAMETER& parameter_;
+                const bool       inOut_;
+                const double     sign_;
+            };
+
+            //------------------------------------------------------------------
+            //! Weight of the penalty terms: multiplier * parameter.penaltyWeight()
+            template<typename PARAMETER>
+            class PenaltyWeight
+            {
+            public:
+                PenaltyWeight( const PARAMETER& parameter, const double multiplier )
+                    : parameter_( parameter ), multiplier_( multiplier ) { }
+
+                template<typename ITER>
+                double operator()( const ITER iter ) const
+                {
+                    return multiplier_ * parameter_.penaltyWeight( iter );
+                }
+
+            private:
+                const PARAMETER& parameter_;
+                const double     multiplier_;
+            };
+
+        }
+
+        template<typename INTEGRATOR, typename SURFACETUPLEBINDER,
+                 bool TRANSPOSED, typename BOUNDFIELD, typename WEIGHT>
+        class WeightedSurfaceTerm;
+
+        //----------------------------------------------------------------------
+        /** Assemble a surface term with element-wise weights in parallel.
+         *  \tparam INTEGRATOR Type of integrator (base::asmb::StiffnessMatrix
+         *                     or base::asmb::ForceIntegrator)
+         *  \tparam SURFACETUPLEBINDER Binder of the surface field tuple
+         *  \tparam TRANSPOSED Flag for the use of the transposed tuple
+         *  \param[in] weightedKernel Kernel with the weight as fourth argument
+         *  \param[in] quadrature     Surface quadrature
+         *  \param[in] solver         Solver to assemble to
+         *  \param[in] boundField     Surface field binder
+         *  \param[in] weight         Computes the weight from an element iterator
+         */
+        template<typename INTEGRATOR, typename SURFACETUPLEBINDER, bool TRANSPOSED,
+                 typename BOUNDFIELD, typename WEIGHT>
+        void assembleWeightedSurfaceTerm(
+            const typename WeightedSurfaceTerm<INTEGRATOR,SURFACETUPLEBINDER,
+                                               TRANSPOSED,BOUNDFIELD,
+                                               WEIGHT>::WeightedKernel& weightedKernel,
+            const typename INTEGRATOR::Quadrature& quadrature,
+            typename INTEGRATOR::Solver&           solver,
+            const BOUNDFIELD&                      boundField,
+            const WEIGHT&                          weight )
+        {
+            typedef WeightedSurfaceTerm<INTEGRATOR,SURFACETUPLEBINDER,
+                                        TRANSPOSED,BOUNDFIELD,WEIGHT> Term;
+            Term term( weightedKernel, quadrature, solver, boundField, weight );
+
+            const std::size_t numElements =
+                std::distance( boundField.elementsBegin(),
+                               boundField.elementsEnd() );
+
+            base::auxi::applyToAllIndices( numElements, term );
+        }
+
+    }
+}
+
+//------------------------------------------------------------------------------
+/** Integration of a surface term whose kernel is scaled by an element weight.
+ *  The terms of Nitsche's method (base::nitsche::Energy and
+ *  base::nitsche::Penalty) carry a factor which is computed for every surface
+ *  element from the method's parameters (see base::nitsche::Parameters).
+ *  Instead of storing this factor in the kernel object before each element,
+ *  which prevents a parallel loop over the elements, this object computes the
+ *  weight as a local variable, binds it to the kernel function and calls the
+ *  integrator with the resulting kernel. The object has no mutable state and
+ *  is applied to the element indices concurrently, the insertion into the
+ *  system is the same as for the volume terms.
+ *
+ *  \tparam INTEGRATOR         Type of integrator
+ *  \tparam SURFACETUPLEBINDER Binder of the surface field tuple
+ *  \tparam TRANSPOSED         Flag for the use of the transposed tuple
+ *  \tparam BOUNDFIELD         Type of surface field binder
+ *  \tparam WEIGHT             Function object: element iterator to weight
+ */
+template<typename INTEGRATOR, typename SURFACETUPLEBINDER,
+         bool TRANSPOSED, typename BOUNDFIELD, typename WEIGHT>
+class base::nitsche::WeightedSurfaceTerm
+{
+public:
+    //! @name Template parameter
+    //@{
+    typedef INTEGRATOR Integrator;
+    typedef BOUNDFIELD BoundField;
+    typedef WEIGHT     Weight;
+    //@}
+
+    typedef detail_::MakeSurfaceTuple<SURFACETUPLEBINDER,TRANSPOSED> MakeTuple;
+
+    //! Type of field tuple passed to the integrator
+    typedef typename MakeTuple::Type FieldTuple;
+
+    //! Kernel type of the integrator
+    typedef typename Integrator::Kernel    Kernel;
+
+    //! Result container of the kernel
+    typedef typename Integrator::Result    Result;
+
+    //! Kernel function with an additional weight argument
+    typedef boost::function< void( const FieldTuple&,
+                                   const typename Integrator::Quadrature::VecDim&,
+                                   const double,
+                                   const double,
+                                   Result& ) > WeightedKernel;
+
+    //! Constructor with all references
+    WeightedSurfaceTerm( const WeightedKernel&                  weightedKernel,
+                         const typename Integrator::Quadrature& quadrature,
+                         typename Integrator::Solver&           solver,
+                         const BoundField&                      boundField,
+                         const Weight&                          weight )
+        : weightedKernel_( weightedKernel ), quadrature_( quadrature ),
+          solver_( solver ), boundField_( boundField ), weight_( weight )
+    { }
+
+    //! Integrate the term on the surface element with index e
+    void operator()( const std::size_t e ) const
+    {
+        typename BoundField::FieldIterator iter = boundField_.elementsBegin();
+        std::advance( iter, e );
+
+        // element weight as local data
+        const double w = weight_( iter );
+
+        Kernel kernel = boost::bind( boost::cref( weightedKernel_ ),
+                                     _1, _2, _3, w, _4 );
+
+        Integrator integrator( kernel, quadrature_, solver_ );
+        integrator( MakeTuple::apply( *iter ) );
+    }
+
+private:
+    const WeightedKernel&                  weightedKernel_;
+    const typename Integrator::Quadrature& quadrature_;
+    typename Integrator::Solver&           solver_;
+    const BoundField&                      boundField_;
+    const Weight&                          weight_;
+};
+
+#endif
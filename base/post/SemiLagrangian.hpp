@@ -0,0 +1,446 @@
+//------------------------------------------------------------------------------
+// <preamble>
+// </preamble>
+//------------------------------------------------------------------------------
+
+//! @file   SemiLagrangian.hpp
+//! @author agent
+//! @date   2026
+
+#ifndef base_post_semilagrangian_hpp
+#define base_post_semilagrangian_hpp
+
+//------------------------------------------------------------------------------
+// std  includes
+#include <vector>
+#include <utility>
+#include <limits>
+#include <algorithm>
+// boost includes
+#include <boost/utility.hpp>
+// base includes
+#include <base/verify.hpp>
+#include <base/linearAlgebra.hpp>
+#include <base/geometry.hpp>
+#include <base/auxi/parallel.hpp>
+#include <base/auxi/Profiler.hpp>
+// base/mesh includes
+#include <base/mesh/ElementNeighbours.hpp>
+// base/dof includes
+#include <base/dof/location.hpp>
+// base/post includes
+#include <base/post/findLocation.hpp>
+
+//------------------------------------------------------------------------------
+namespace base{
+    namespace post{
+
+        template<typename MESH, typename FIELD>
+        class SemiLagrangian;
+
+        namespace detail_{
+
+            //------------------------------------------------------------------
+            /** Copy of the DoF values of a field, indexed by the DoF IDs.
+             *  The field can be evaluated from this copy while the DoFs are
+             *  overwritten by other threads.
+             */
+            template<typename FIELD>
+            class FieldSnapshot
+            {
+            public:
+                static const unsigned size = FIELD::DegreeOfFreedom::size;
+                typedef typename base::Vector<size>::Type VecDoF;
+
+                FieldSnapshot( const FIELD& field )
+                {
+                    values_.resize( std::distance( field.doFsBegin(),
+                                                   field.doFsEnd() ) );
+                    typename FIELD::DoFPtrConstIter dIter = field.doFsBegin();
+                    typename FIELD::DoFPtrConstIter dEnd  = field.doFsEnd();
+                    for ( ; dIter != dEnd; ++dIter ) {
+                        VecDoF& value = values_[ (*dIter) -> getID() ];
+                        for ( unsigned d = 0; d < size; d++ )
+                            value[d] = (*dIter) -> getValue( d );
+                    }
+                }
+
+                //! Interpolate in a field element at a local coordinate
+                template<typename GEOMELEMENT>
+                VecDoF evaluate( const GEOMELEMENT* geomEp,
+                                 const typename FIELD::Element* fieldEp,
+                                 const typename FIELD::Element::FEFun::VecDim& xi ) const
+                {
+                    typename FIELD::Element::FEFun::FunArray funValues;
+                    ( fieldEp -> fEFun() ).evaluate( geomEp, xi, funValues );
+
+                    VecDoF result = base::constantVector<size>( 0. );
+                    typename FIELD::Element::DoFPtrConstIter dIter = fieldEp -> doFsBegin();
+                    for ( unsigned f = 0; f < funValues.size(); f++, ++dIter )
+                        result += funValues[f] * values_[ (*dIter) -> getID() ];
+                    return result;
+                }
+
+            private:
+                std::vector<VecDoF> values_;
+            };
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+/** Semi-Lagrangian advection of a field by a velocity field.
+ *  For every DoF at location \f$ x \f$ the characteristic
+ *  \f[
+ *      \frac{d X}{d \tau} = u(X), \quad X(t_{n+1}) = x
+ *  \f]
+ *  is traced backwards over the step size \f$ \Delta t \f$ by a number of
+ *  explicit Runge-Kutta sub-steps (order 1, 2 or 4), and the DoF takes the
+ *  value of the field at the departure point \f$ X(t_n) \f$. Velocity and
+ *  advected field are interpolated from copies taken before the update,
+ *  such that the DoFs can be processed in parallel and the velocity may even
+ *  be the advected field itself.
+ *
+ *  Points are located by a walk through the face neighbours, starting from
+ *  the element of the previous evaluation point (initially the element of
+ *  the DoF): the walk moves greedily to the neighbour whose centroid is
+ *  closest to the point until findLocationInElement() succeeds. If it gets
+ *  stuck, the surrounding elements are visited in the order of the distance
+ *  of their centroids to the point. If a number of visited elements does not
+ *  bring the walk closer, the point lies outside of the mesh (e.g. an inflow
+ *  boundary) or behind a concave part of the boundary; the tracing stops and
+ *  the closest point found is used instead. The search works on fixed-size
+ *  arrays and does not allocate.
+ *
+ *  \note Constrained DoFs are overwritten as well, their constraint values
+ *        are only re-applied by the next solution.
+ *  \tparam MESH   Type of mesh
+ *  \tparam FIELD  Type of field to advect
+ */
+template<typename MESH, typename FIELD>
+class base::post::SemiLagrangian
+    : boost::noncopyable
+{
+public:
+    //! @name Template parameter
+    //@{
+    typedef MESH  Mesh;
+    typedef FIELD Field;
+    //@}
+
+    typedef typename Mesh::Element               GeomElement;
+    typedef base::GeomTraits<GeomElement>        GT;
+    typedef typename GT::GlobalVecDim            GlobalVecDim;
+    typedef typename GT::LocalVecDim             LocalVecDim;
+
+    //--------------------------------------------------------------------------
+    /** Constructor prepares the neighbour lists and the DoF locations.
+     *  \param[in] mesh       Mesh of the field
+     *  \param[in] field      Field to advect (only its DoF layout is used)
+     *  \param[in] tolerance  Coordinate tolerance of the point location
+     *  \param[in] maxIter    Maximal Newton iterations per element
+     */
+    SemiLagrangian( const Mesh& mesh, const Field& field,
+                    const double tolerance = 1.e-10,
+                    const unsigned maxIter = 10 )
+        : mesh_( mesh ), tolerance_( tolerance ), maxIter_( maxIter ),
+          numClipped_( 0 )
+    {
+        neighbours_.create( mesh.elementsBegin(), mesh.elementsEnd() );
+
+        const LocalVecDim xiC = base::ShapeCentroid<GeomElement::shape>::apply();
+        typename Mesh::ElementPtrConstIter eIter = mesh.elementsBegin();
+        typename Mesh::ElementPtrConstIter eLast = mesh.elementsEnd();
+        for ( ; eIter != eLast; ++eIter )
+            centroids_.push_back( base::Geometry<GeomElement>()( *eIter, xiC ) );
+
+        base::dof::associateLocation( field, doFLocation_ );
+    }
+
+    //--------------------------------------------------------------------------
+    /** Advect the field over one time step.
+     *  \param[in]     velocity     Velocity field on the same mesh
+     *  \param[in,out] field        Field to advect
+     *  \param[in]     stepSize     Time step size \f$ \Delta t \f$
+     *  \param[in]     numSubSteps  Number of Runge-Kutta steps for the tracing
+     *  \param[in]     order        Order of the Runge-Kutta method (1, 2, 4)
+     */
+    template<typename VELOCITY>
+    void advect( const VELOCITY& velocity, Field& field,
+                 const double   stepSize,
+                 const unsigned numSubSteps = 1,
+                 const unsigned order       = 2 )
+    {
+        PROFILE_REGION( "post::semiLagrangian" );
+
+        STATIC_ASSERT_MSG( VELOCITY::DegreeOfFreedom::size == GT::globalDim,
+                           "Velocity field has the wrong size" );
+        VERIFY_MSG( ( order == 1 ) or ( order == 2 ) or ( order == 4 ),
+                    "Runge-Kutta order has to be 1, 2 or 4" );
+        VERIFY_MSG( numSubSteps > 0, "At least one sub-step is needed" );
+
+        // read-only copies for the interpolation
+        const detail_::FieldSnapshot<VELOCITY> velocitySnapshot( velocity );
+        const detail_::FieldSnapshot<Field>    fieldSnapshot(    field    );
+
+        numClipped_ = 0;
+        Trace_<VELOCITY> trace( *this, velocity, velocitySnapshot,
+                                field, fieldSnapshot,
+                                stepSize / static_cast<double>( numSubSteps ),
+                                numSubSteps, order );
+        base::auxi::applyToAllIndices( doFLocation_.size(), trace );
+    }
+
+    //! Number of DoFs whose tracing left the mesh in the last advection
+    std::size_t numClipped() const { return numClipped_; }
+
+    //--------------------------------------------------------------------------
+    /** Locate a point by a walk through the mesh.
+     *  \param[in]     x     Physical coordinate to locate
+     *  \param[in,out] elem  Start element of the walk, element of x on exit
+     *  \param[out]    xi    Local coordinate of x, or of the closest point
+     *                       found if x has not been found
+     *  \return              Success flag
+     */
+    bool locate( const GlobalVecDim& x, std::size_t& elem, LocalVecDim& xi ) const
+    {
+        // closest point found so far
+        double      minResidual = std::numeric_limits<double>::max();
+        std::size_t closestElem = elem;
+        LocalVecDim closestXi   = base::ShapeCentroid<GeomElement::shape>::apply();
+
+        // greedy walk to the neighbour with the closest centroid
+        std::size_t current = elem;
+        double      minDist = ( centroids_[ current ] - x ).norm();
+        while ( true ) {
+            if ( this -> tryElement_( x, current, xi,
+                                      minResidual, closestElem, closestXi ) ) {
+                elem = current;
+                return true;
+            }
+
+            std::size_t next = current;
+            base::mesh::ElementNeighbours::NeighbourIter nIter =
+                neighbours_.begin( current );
+            base::mesh::ElementNeighbours::NeighbourIter nEnd  =
+                neighbours_.end(   current );
+            for ( ; nIter != nEnd; ++nIter ) {
+                const double dist = ( centroids_[ *nIter ] - x ).norm();
+                if ( dist < minDist ) {
+                    minDist = dist;
+                    next    = *nIter;
+                }
+            }
+            if ( next == current ) break;
+            current = next;
+        }
+
+        // local minimum of the centroid distance: visit the surrounding
+        // elements ordered by the distance of their centroids to x
+        typedef std::pair<double,std::size_t> Candidate;
+        Candidate   candidates[ maxVisited_ ];
+        std::size_t visited[    maxVisited_ ];
+        unsigned    numCandidates = 0;
+        unsigned    numVisited    = 0;
+        unsigned    numFutile     = 0;
+
+        visited[ numVisited++ ] = current;
+        while ( true ) {
+
+            // add the unvisited neighbours of the current element
+            base::mesh::ElementNeighbours::NeighbourIter nIter =
+                neighbours_.begin( current );
+            base::mesh::ElementNeighbours::NeighbourIter nEnd  =
+                neighbours_.end(   current );
+            for ( ; ( nIter != nEnd ) and ( numVisited < maxVisited_ ); ++nIter ) {
+                if ( std::find( visited, visited + numVisited, *nIter ) !=
+                     visited + numVisited ) continue;
+                visited[ numVisited++ ] = *nIter;
+                candidates[ numCandidates++ ] =
+                    Candidate( ( centroids_[ *nIter ] - x ).norm(), *nIter );
+            }
+
+            if ( ( numCandidates == 0 ) or ( numFutile >= maxFutile_ ) ) break;
+
+            // take the closest candidate
+            Candidate* closest = std::min_element( candidates,
+                                                   candidates + numCandidates );
+            const Candidate candidate = *closest;
+            *closest = candidates[ --numCandidates ];
+            current  = candidate.second;
+
+            if ( this -> tryElement_( x, current, xi,
+                                      minResidual, closestElem, closestXi ) ) {
+                elem = current;
+                return true;
+            }
+
+            // count the steps which do not approach x
+            if ( candidate.first < minDist ) {
+                minDist   = candidate.first;
+                numFutile = 0;
+            }
+            else numFutile++;
+        }
+
+        elem = closestElem;
+        xi   = closestXi;
+        return false;
+    }
+
+private:
+    //--------------------------------------------------------------------------
+    //! Trace the characteristic of one DoF and set its new value
+    template<typename VELOCITY>
+    class Trace_
+    {
+    public:
+        Trace_( SemiLagrangian& sl,
+                const VELOCITY& velocity,
+                const detail_::FieldSnapshot<VELOCITY>& velocitySnapshot,
+                Field& field,
+                const detail_::FieldSnapshot<Field>& fieldSnapshot,
+                const double h, const unsigned numSubSteps, const unsigned order )
+            : sl_( sl ), velocity_( velocity ), velocitySnapshot_( velocitySnapshot ),
+              field_( field ), fieldSnapshot_( fieldSnapshot ),
+              h_( h ), numSubSteps_( numSubSteps ), order_( order )
+        { }
+
+        void operator()( const std::size_t i )
+        {
+            typename Field::DegreeOfFreedom* doFPtr = field_.doFsBegin()[i];
+            std::size_t elem = sl_.doFLocation_[ doFPtr -> getID() ].first;
+            LocalVecDim xi   = sl_.doFLocation_[ doFPtr -> getID() ].second;
+            GlobalVecDim x   =
+                base::Geometry<GeomElement>()( sl_.mesh_.elementPtr( elem ), xi );
+
+            bool inside = true;
+            for ( unsigned s = 0; ( s < numSubSteps_ ) and inside; s++ )
+                inside = this -> step_( x, elem, xi );
+
+            if ( not inside ) {
+#ifdef _OPENMP
+#pragma omp atomic
+#endif
+                sl_.numClipped_++;
+            }
+
+            const typename detail_::FieldSnapshot<Field>::VecDoF value =
+                fieldSnapshot_.evaluate( sl_.mesh_.elementPtr( elem ),
+                                         field_.elementPtr( elem ), xi );
+            for ( unsigned d = 0; d < Field::DegreeOfFreedom::size; d++ )
+                doFPtr -> setValue( d, value[d] );
+        }
+
+    private:
+        //! Velocity at a located point
+        GlobalVecDim velocityIn_( const std::size_t elem, const LocalVecDim& xi ) const
+        {
+            return velocitySnapshot_.evaluate( sl_.mesh_.elementPtr( elem ),
+                                               velocity_.elementPtr( elem ), xi );
+        }
+
+        //! Velocity at a point which is located first
+        GlobalVecDim velocityAt_( const GlobalVecDim& x, std::size_t elem ) const
+        {
+            LocalVecDim xi;
+            sl_.locate( x, elem, xi );
+            return this -> velocityIn_( elem, xi );
+        }
+
+        /** One Runge-Kutta step backwards in time.
+         *  On entry, (elem,xi) is the location of x, on exit the location of
+         *  the new x. If that is outside of the mesh, x is moved to the
+         *  closest point found and false is returned.
+         */
+        bool step_( GlobalVecDim& x, std::size_t& elem, LocalVecDim& xi ) const
+        {
+            const GlobalVecDim k1 = this -> velocityIn_( elem, xi );
+            GlobalVecDim dx;
+            if ( order_ == 1 ) {
+                dx = h_ * k1;
+            }
+            else if ( order_ == 2 ) {
+                const GlobalVecDim k2 = this -> velocityAt_( x - 0.5 * h_ * k1, elem );
+                dx = h_ * k2;
+            }
+            else {
+                const GlobalVecDim k2 = this -> velocityAt_( x - 0.5 * h_ * k1, elem );
+                const GlobalVecDim k3 = this -> velocityAt_( x - 0.5 * h_ * k2, elem );
+                const GlobalVecDim k4 = this -> velocityAt_( x -       h_ * k3, elem );
+                dx = ( h_ / 6. ) * ( k1 + 2. * k2 + 2. * k3 + k4 );
+            }
+
+            x -= dx;
+            const bool found = sl_.locate( x, elem, xi );
+            if ( not found )
+                x = base::Geometry<GeomElement>()( sl_.mesh_.elementPtr( elem ), xi );
+            return found;
+        }
+
+        SemiLagrangian&                          sl_;
+        const VELOCITY&                          velocity_;
+        const detail_::FieldSnapshot<VELOCITY>&  velocitySnapshot_;
+        Field&                                   field_;
+        const detail_::FieldSnapshot<Field>&     fieldSnapshot_;
+        const double                             h_;
+        const unsigned                           numSubSteps_;
+        const unsigned                           order_;
+    };
+
+    const Mesh&                            mesh_;       //!< Geometry
+    const double                           tolerance_;  //!< Location tolerance
+    const unsigned                         maxIter_;    //!< Newton iterations
+    base::mesh::ElementNeighbours          neighbours_; //!< Face neighbours
+    std::vector<GlobalVecDim>              centroids_;  //!< Element centroids
+    std::vector<std::pair<std::size_t,LocalVecDim> > doFLocation_; //!< DoF sites
+    std::size_t                            numClipped_; //!< Failed tracings
+
+    //--------------------------------------------------------------------------
+    /** Try to find x in an element, otherwise keep the closest point.
+     *  \param[in]     x           Physical coordinate to locate
+     *  \param[in]     elem        Element to search
+     *  \param[out]    xi          Local coordinate of x if found
+     *  \param[in,out] minResidual Distance of the closest point so far
+     *  \param[in,out] closestElem Element of the closest point
+     *  \param[in,out] closestXi   Local coordinate of the closest point
+     *  \return                    Success flag
+     */
+    bool tryElement_( const GlobalVecDim& x, const std::size_t elem,
+                      LocalVecDim& xi, double& minResidual,
+                      std::size_t& closestElem, LocalVecDim& closestXi ) const
+    {
+        const std::pair<LocalVecDim,bool> trial =
+            base::post::findLocationInElement( mesh_.elementPtr( elem ),
+                                               x, tolerance_, maxIter_ );
+        if ( trial.second ) {
+            xi = trial.first;
+            return true;
+        }
+
+        // keep the closest point in case x is outside of the mesh
+        const LocalVecDim xiSnap =
+            base::SnapToShape<GeomElement::shape>::apply( trial.first );
+        const double residual =
+            ( x - base::Geometry<GeomElement>()( mesh_.elementPtr( elem ),
+                                                 xiSnap ) ).norm();
+        if ( residual < minResidual ) {
+            minResidual = residual;
+            closestElem = elem;
+            closestXi   = xiSnap;
+        }
+        return false;
+    }
+
+    //! Walk steps without approaching the point before giving up
+    static const unsigned maxFutile_ =
+        base::NumNFaces<GeomElement::shape,
+                        base::ShapeSurface<GeomElement::shape>::value>::value *
+        base::NumNFaces<GeomElement::shape,
+                        base::ShapeSurface<GeomElement::shape>::value>::value;
+
+    //! Capacity of the search around a local minimum of the centroid distance
+    static const unsigned maxVisited_ = 4 * maxFutile_;
+};
+
+#endif
@@ -0,0 +1,286 @@
+//------------------------------------------------------------------------------
+// <preamble>
+// </preamble>
+//------------------------------------------------------------------------------
+
+//! @file   Tabulation.hpp
+//! @author agent
+//! @date   2026
+
+#ifndef base_sfun_tabulation_hpp
+#define base_sfun_tabulation_hpp
+
+//------------------------------------------------------------------------------
+// std   includes
+#include <vector>
+#include <cstring>
+// boost includes
+#include <boost/array.hpp>
+#include <boost/utility.hpp>
+#include <boost/unordered_map.hpp>
+#include <boost/cstdint.hpp>
+// base  includes
+#include <base/verify.hpp>
+#include <base/linearAlgebra.hpp>
+// base/auxi includes
+#include <base/auxi/parallel.hpp>
+
+//------------------------------------------------------------------------------
+namespace base{
+    namespace sfun{
+
+        template<typename SFUN>
+        class Tabulation;
+
+        namespace detail_{
+
+            //------------------------------------------------------------------
+            //! Interface of a tabulation for a given parameter dimension
+            template<unsigned DIM>
+            class TabulationBase
+            {
+            public:
+                typedef typename base::Vector<DIM>::Type VecDim;
+                typedef std::vector<VecDim>              PointSet;
+
+                virtual void tabulate( const PointSet& points ) = 0;
+                virtual ~TabulationBase() { }
+            };
+
+            //------------------------------------------------------------------
+            /** Registry of point sets and shape function tabulations.
+             *  Quadrature rules register their points and every tabulated
+             *  shape function type registers its table, such that all tables
+             *  contain the values at all registered points. The order of these
+             *  registrations is irrelevant. Since the tables are read without
+             *  locks during the (parallel) assembly, they are only modified
+             *  outside of parallel regions. Quadrature objects and shape
+             *  function tables created within such a region are not
+             *  registered, their values are evaluated directly.
+             */
+            template<unsigned DIM>
+            class TabulationRegistry
+                : public boost::noncopyable
+            {
+            public:
+                typedef TabulationBase<DIM>             Table;
+                typedef typename Table::PointSet        PointSet;
+
+                static TabulationRegistry& instance()
+                {
+                    static TabulationRegistry registry;
+                    return registry;
+                }
+
+                //! Register a new set of points and tabulate it everywhere
+                void addPoints( const PointSet& points )
+                {
+                    VERIFY_MSG( not base::auxi::inParallelRegion(),
+                                "Quadrature points cannot be registered in a parallel region" );
+
+                    for ( std::size_t s = 0; s < pointSets_.size(); s++ )
+                        if ( equal_( pointSets_[s], points ) ) return;
+
+                    pointSets_.push_back( points );
+                    for ( std::size_t t = 0; t < tables_.size(); t++ )
+                        tables_[t] -> tabulate( points );
+                }
+
+                //! Register a new table and tabulate all known point sets
+                bool addTable( Table* table )
+                {
+                    VERIFY_MSG( not base::auxi::inParallelRegion(),
+                                "Shape function table cannot be registered in a parallel region" );
+
+                    tables_.push_back( table );
+                    for ( std::size_t s = 0; s < pointSets_.size(); s++ )
+                        table -> tabulate( pointSets_[s] );
+                    return true;
+                }
+
+            private:
+                TabulationRegistry() { }
+
+                static bool equal_( const PointSet& a, const PointSet& b )
+                {
+                    if ( a.size() != b.size() ) return false;
+                    for ( std::size_t p = 0; p < a.size(); p++ )
+                        if ( a[p] != b[p] ) return false;
+                    return true;
+                }
+
+            private:
+                std::vector<PointSet> pointSets_; //!< Registered points
+                std::vector<Table*>   tables_;    //!< Registered tables
+            };
+
+            //------------------------------------------------------------------
+            //! Registration of the points of a quadrature rule
+            template<typename QUAD>
+            void registerQuadraturePoints( const QUAD& quadrature )
+            {
+                // nothing to tabulate for point evaluations
+                if ( QUAD::dim == 0 ) return;
+
+                // the tables cannot be extended in parallel
+                if ( base::auxi::inParallelRegion() ) return;
+
+                typedef TabulationRegistry<QUAD::dim> Registry;
+                typename Registry::PointSet points;
+                for ( typename QUAD::Iter qIter = quadrature.begin();
+                      qIter != quadrature.end(); ++qIter )
+                    points.push_back( qIter -> second );
+
+                Registry::instance().addPoints( points );
+            }
+
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+/** Values and parametric gradients of a shape function at fixed points.
+ *  The standard quadrature rules (base::Quadrature) use the same points in
+ *  reference coordinates for every element, but the shape functions and
+ *  their gradients are evaluated anew at every point of every element in
+ *  every assembly pass. This object holds these values, computed once per
+ *  shape function type and point. The points are taken from the registry
+ *  detail_::TabulationRegistry, to which every base::Quadrature object adds
+ *  its points on construction. Shape functions (base::LagrangeShapeFun and
+ *  base::BSplineShapeFun) look up the evaluation coordinate in their table
+ *  and fall back to the direct evaluation for any other point, e.g., the
+ *  points of a cut-cell quadrature.
+ *
+ *  The table is registered with the first call of instance() outside of a
+ *  parallel region. Until then, the look-up fails and the shape function
+ *  evaluates directly, e.g. if it is first used within a parallel loop.
+ *
+ *  Points are identified by the exact bit pattern of their coordinates,
+ *  which holds since the quadrature object passes its stored points to
+ *  the kernels. Only the parametric values are tabulated, the mapping to
+ *  the physical element remains with the kernel.
+ *
+ *  \tparam SFUN Type of parametric shape function
+ */
+template<typename SFUN>
+class base::sfun::Tabulation
+    : public base::sfun::detail_::TabulationBase<SFUN::dim>,
+      public boost::noncopyable
+{
+public:
+    //! Template parameter: shape function
+    typedef SFUN ShapeFun;
+
+    //! Dimension of the parameter space
+    static const unsigned dim = ShapeFun::dim;
+
+    //! @name Types of the shape function
+    //@{
+    typedef typename ShapeFun::VecDim    VecDim;
+    typedef typename ShapeFun::FunArray  FunArray;
+    typedef typename ShapeFun::GradArray GradArray;
+    //@}
+
+    //! Point set type
+    typedef typename detail_::TabulationBase<dim>::PointSet PointSet;
+
+    //! Access to the unique table of this shape function
+    static const Tabulation& instance()
+    {
+        static Tabulation table;
+        if ( ( not table.isRegistered_ ) and
+             ( not base::auxi::inParallelRegion() ) ) {
+            detail_::TabulationRegistry<dim>::instance().addTable( &table );
+            table.isRegistered_ = true;
+        }
+        return table;
+    }
+
+    //! Look up the function values, returns false if xi is not tabulated
+    bool fun( const VecDim& xi, FunArray& values ) const
+    {
+        std::size_t p;
+        if ( not this -> find_( xi, p ) ) return false;
+        values = funValues_[p];
+        return true;
+    }
+
+    //! Look up the parametric gradients, returns false if xi is not tabulated
+    bool gradient( const VecDim& xi, GradArray& values ) const
+    {
+        std::size_t p;
+        if ( not this -> find_( xi, p ) ) return false;
+        values = gradValues_[p];
+        return true;
+    }
+
+    //! Number of tabulated points
+    std::size_t size() const { return funValues_.size(); }
+
+    //! Evaluate the shape function at all new points of a set
+    void tabulate( const PointSet& points )
+    {
+        ShapeFun shapeFun;
+        for ( std::size_t p = 0; p < points.size(); p++ ) {
+            const Key key = key_( points[p] );
+            if ( index_.find( key ) != index_.end() ) continue;
+
+            FunArray  values;
+            GradArray gradients;
+            shapeFun.fun(      points[p], values );
+            shapeFun.gradient( points[p], gradients );
+
+            index_[ key ] = funValues_.size();
+            funValues_.push_back(  values );
+            gradValues_.push_back( gradients );
+        }
+    }
+
+private:
+    Tabulation() : isRegistered_( false ) { }
+
+    //! Exact coordinates as lookup key
+    typedef boost::array<double,dim> Key;
+
+    static Key key_( const VecDim& xi )
+    {
+        Key key;
+        for ( unsigned d = 0; d < dim; d++ ) key[d] = xi[d];
+        return key;
+    }
+
+    //! Cheap hash of the coordinates' bit patterns
+    struct Hash
+    {
+        std::size_t operator()( const Key& key ) const
+        {
+            boost::uint64_t h = 0;
+            for ( unsigned d = 0; d < dim; d++ ) {
+                boost::uint64_t bits;
+                std::memcpy( &bits, &(key[d]), sizeof( bits ) );
+                h = ( h ^ bits ) * 0x100000001b3ULL;
+                h ^= ( h >> 29 );
+            }
+            return static_cast<std::size_t>( h );
+        }
+    };
+
+    bool find_( const VecDim& xi, std::size_t& p ) const
+    {
+        if ( index_.empty() ) return false;
+        typename Index::const_iterator iter = index_.find( key_( xi ) );
+        if ( iter == index_.end() ) return false;
+        p = iter -> second;
+        return true;
+    }
+
+private:
+    typedef boost::unordered_map<Key,std::size_t,Hash> Index;
+
+    Index                  index_;        //!< Point coordinates to position
+    std::vector<FunArray>  funValues_;    //!< Tabulated values
+    std::vector<GradArray> gradValues_;   //!< Tabulated gradients
+    bool                   isRegistered_; //!< Flag if added to the registry
+};
+
+#endif
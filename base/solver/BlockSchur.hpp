@@ -0,0 +1,598 @@
+//------------------------------------------------------------------------------
+// <preamble>
+// </preamble>
+//------------------------------------------------------------------------------
+
+//! @file   BlockSchur.hpp
+//! @author agent
+//! @date   2026
+
+#ifndef base_solver_blockschur_hpp
+#define base_solver_blockschur_hpp
+
+//------------------------------------------------------------------------------
+// std   includes
+#include <vector>
+#include <set>
+#include <utility>
+#include <string>
+#include <cmath>
+#include <algorithm>
+// boost includes
+#include <boost/shared_ptr.hpp>
+#include <boost/utility.hpp>
+// Eigen includes
+#include <Eigen/Sparse>
+#include <Eigen/Core>
+#include <Eigen/Dense>
+// base includes
+#include <base/verify.hpp>
+#include <base/linearAlgebra.hpp>
+#include <base/io/Format.hpp>
+// base/solver includes
+#include <base/solver/Eigen3.hpp>
+#include <base/solver/TripletContainer.hpp>
+
+//------------------------------------------------------------------------------
+namespace base{
+    namespace solver{
+
+        class BlockSchur;
+
+        namespace detail_{
+
+            //! Sparse matrix type of the blocks
+            typedef Eigen::SparseMatrix<number> SparseMatrix;
+
+            //------------------------------------------------------------------
+            /** Storage of an assembled approximation of the Schur complement.
+             *  Provides the insertion interface of a solver such that the
+             *  standard assembly routines can be used for its computation.
+             *  The DoF numbers passed are those of the global system, they
+             *  are shifted by the size of the first block.
+             *  As for the system matrix, the non-zero pattern has to be
+             *  registered via registerFields() for a parallel assembly.
+             *  After clearLHS(), the approximation can be re-assembled and
+             *  is then converted again by BlockSchur::finishAssembly().
+             */
+            class SchurApproximation : public boost::noncopyable
+            {
+            public:
+                SchurApproximation( const std::size_t shift,
+                                    const std::size_t size )
+                    : shift_( shift ), size_( size ), isAssembled_( false )
+                { }
+
+                template<typename MATRIX, typename RDOFS, typename CDOFS>
+                void insertToLHS( const MATRIX & matrix,
+                                  const RDOFS  & rowDoFs,
+                                  const CDOFS  & colDoFs )
+                {
+                    VERIFY_MSG( not isAssembled_,
+                                "Call clearLHS() before re-assembling the approximation" );
+                    for ( std::size_t i = 0; i < rowDoFs.size(); i ++ ) {
+                        for ( std::size_t j = 0; j < colDoFs.size(); j ++ ) {
+                            VERIFY_MSG( (rowDoFs[i] >= shift_) and
+                                        (colDoFs[j] >= shift_),
+                                        "DoF does not belong to the second block" );
+                            const std::size_t r = rowDoFs[i] - shift_;
+                            const std::size_t c = colDoFs[j] - shift_;
+                            VERIFY_MSG( (r < size_) and (c < size_),
+                                        "Index out of bound" );
+                            triplets_.insert( static_cast<unsigned>( r ),
+                                              static_cast<unsigned>( c ),
+                                              matrix( i, j ) );
+                        }
+                    }
+                }
+
+                //! Contributions to the rhs are meaningless here
+                template<typename VECTOR, typename DOFS>
+                void insertToRHS( const VECTOR &, const DOFS & ) { }
+
+                //--------------------------------------------------------------
+                /** Register the shifted non-zero pattern of the second block.
+                 *  Same as BlockSchur::registerFields, entries of the first
+                 *  block (e.g. masters of constrained DoFs) are ignored.
+                 *  \tparam FIELDTUPLEBINDER Binder of test and trial fields
+                 *  \tparam FIELDBINDER      Binder of mesh and fields
+                 */
+                template<typename FIELDTUPLEBINDER, typename FIELDBINDER>
+                void registerFields( const FIELDBINDER& fieldBinder )
+                {
+                    std::set<std::pair<std::size_t,std::size_t> > pattern;
+
+                    typename FIELDBINDER::FieldIterator iter = fieldBinder.elementsBegin();
+                    typename FIELDBINDER::FieldIterator end  = fieldBinder.elementsEnd();
+                    for ( ; iter != end; ++iter ) {
+
+                        std::vector<std::size_t> rowIDs, colIDs;
+                        if ( not effectiveDoFIDs( FIELDTUPLEBINDER::makeTuple( *iter ),
+                                                  rowIDs, colIDs ) ) continue;
+
+                        for ( std::size_t i = 0; i < rowIDs.size(); i++ ) {
+                            if ( rowIDs[i] < shift_ ) continue;
+                            for ( std::size_t j = 0; j < colIDs.size(); j++ ) {
+                                if ( colIDs[j] < shift_ ) continue;
+                                pattern.insert( std::make_pair( rowIDs[i] - shift_,
+                                                                colIDs[j] - shift_ ) );
+                            }
+                        }
+                    }
+
+                    triplets_.registerIndexPairs( pattern.begin(), pattern.end() );
+                    isAssembled_ = false;
+                }
+
+                //! Reset the values for a re-assembly
+                void clearLHS()
+                {
+                    triplets_.clearValues();
+                    isAssembled_ = false;
+                }
+
+                //! Convert to sparse storage
+                void finishAssembly( const bool destroyTriplet = true )
+                {
+                    triplets_.prepare();
+                    S_.resize( static_cast<int>( size_ ), static_cast<int>( size_ ) );
+                    S_.setFromTriplets( triplets_.begin(), triplets_.end() );
+                    // a registered pattern is kept for the re-assembly
+                    if ( destroyTriplet and not triplets_.isPreStructured() )
+                        triplets_.destroy();
+                    isAssembled_ = true;
+                }
+
+                bool isAssembled() const { return isAssembled_; }
+
+                bool isPreStructured() const { return triplets_.isPreStructured(); }
+
+                const SparseMatrix& matrix() const { return S_; }
+
+            private:
+                const std::size_t shift_;
+                const std::size_t size_;
+                TripletContainer  triplets_;
+                SparseMatrix      S_;
+                bool              isAssembled_;
+            };
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+/** Solver for 2x2 block systems with a Schur complement preconditioner.
+ *  Systems arising from mixed formulations (e.g. fluid::Stokes,
+ *  solid::Incompressible) or coupled problems (e.g. poro-elasticity) have
+ *  the block structure
+ *  \f[
+ *      \begin{pmatrix} A & B \\ C & D \end{pmatrix}
+ *      \begin{pmatrix} x \\ y \end{pmatrix} =
+ *      \begin{pmatrix} f \\ g \end{pmatrix}
+ *  \f]
+ *  where the DoFs of the first field are numbered before the ones of the
+ *  second field, i.e. \f$ x \f$ has the indices \f$ [0,N_1) \f$ and
+ *  \f$ y \f$ the indices \f$ [N_1, N_1+N_2) \f$. The assembly uses the
+ *  same interface and storage as base::solver::Eigen3 (including the
+ *  parallel assembly into a registered pattern), the blocks are separated
+ *  in finishAssembly().
+ *
+ *  The system is solved by a restarted GMRES method which is
+ *  right-preconditioned with the block triangular matrix
+ *  \f[
+ *      P = \begin{pmatrix} A & B \\ 0 & \tilde{S} \end{pmatrix}
+ *  \f]
+ *  where \f$ \tilde{S} \f$ approximates the Schur complement
+ *  \f$ S = D - C A^{-1} B \f$. For \f$ \tilde{S} = S \f$, GMRES
+ *  converges in two iterations. The approximations are
+ *  - SIMPLE: \f$ \tilde{S} = D - C \mathrm{diag}(A)^{-1} B \f$, computed
+ *    from the blocks
+ *  - ASSEMBLED: a matrix assembled via schurApproximation(), e.g. the
+ *    pressure mass matrix scaled by \f$ -1/\mu \f$ for Stokes flow
+ *
+ *  Application of \f$ P^{-1} \f$ requires the sparse LU factorisations of
+ *  \f$ A \f$ and \f$ \tilde{S} \f$. These are computed by factorise() and
+ *  kept until the next call. Since the outer Krylov iteration corrects the
+ *  inexactness of the preconditioner, the factorisations can be reused in
+ *  subsequent time or Newton steps (solveFactorised()) as long as the
+ *  iteration counts remain acceptable. The symbolic analysis is done only
+ *  once if the non-zero pattern is registered.
+ */
+class base::solver::BlockSchur : public boost::noncopyable
+{
+public:
+    //! Type of triplet storage
+    typedef base::solver::TripletContainer TripletContainer;
+
+    //! Type of the matrix blocks
+    typedef detail_::SparseMatrix          SparseMatrix;
+
+    //! Available approximations of the Schur complement
+    enum SchurType { SIMPLE, ASSEMBLED };
+
+    //! Constructor with the sizes \f$ N_1 \f$ and \f$ N_2 \f$ of the blocks
+    BlockSchur( const std::size_t size1, const std::size_t size2,
+                const SchurType   schurType = SIMPLE )
+        : size1_( size1 ), size2_( size2 ),
+          schurType_( schurType ),
+          schurApproximation_( size1, size2 ),
+          analysedA_( false ), analysedS_( false ),
+          residual_( 0. )
+    {
+        b_ = VectorD::Zero( static_cast<int>( size1_ + size2_ ) );
+    }
+
+    //--------------------------------------------------------------------------
+    //! Insert numbers to matrix storage
+    template<typename MATRIX, typename RDOFS, typename CDOFS>
+    void insertToLHS( const MATRIX & matrix,
+                      const RDOFS  & rowDoFs,
+                      const CDOFS  & colDoFs )
+    {
+        const std::size_t numTotalDoFs = this -> size();
+
+        for ( std::size_t i = 0; i < rowDoFs.size(); i ++ ) {
+            for ( std::size_t j = 0; j < colDoFs.size(); j ++ ) {
+                const std::size_t rowIndex = rowDoFs[i];
+                const std::size_t colIndex = colDoFs[j];
+
+                VERIFY_MSG( rowIndex < numTotalDoFs,
+                            "Row index out of bound: " + x2s( rowIndex ) );
+                VERIFY_MSG( colIndex < numTotalDoFs,
+                            "Col index out of bound: " + x2s( colIndex ) );
+
+                tripletContainer_.insert( static_cast<unsigned>( rowIndex ),
+                                          static_cast<unsigned>( colIndex ),
+                                          matrix( i, j ) );
+            }
+        }
+        return;
+    }
+
+    //--------------------------------------------------------------------------
+    //! Insert numbers to RHS vector
+    template<typename VECTOR, typename DOFS>
+    void insertToRHS( const VECTOR & vector,
+                      const DOFS   & dofs )
+    {
+        const std::size_t numTotalDoFs = this -> size();
+
+        for ( std::size_t i = 0; i < dofs.size(); i ++ ) {
+            const std::size_t index = dofs[i];
+            VERIFY_MSG( index < numTotalDoFs, x2s( index ) + " out of bound" );
+#ifdef _OPENMP
+#pragma omp atomic
+            b_[ index ] += vector[i];
+#else
+            b_[ index ] += vector[i];
+#endif
+        }
+        return;
+    }
+
+    //--------------------------------------------------------------------------
+    //! Delegate registering of test and trial field DoFs to tripletContainer
+    template<typename FIELDTUPLEBINDER, typename FIELDBINDER>
+    void registerFields( const FIELDBINDER& fieldBinder )
+    {
+        tripletContainer_.registerFields<FIELDTUPLEBINDER>( fieldBinder );
+        analysedA_ = false;
+        analysedS_ = false;
+    }
+
+    /** Storage for the assembly of the Schur complement approximation.
+     *  Its pattern is registered via schurApproximation().registerFields()
+     *  and it is reset via schurApproximation().clearLHS(), independently
+     *  of the system matrix, such that a constant approximation is
+     *  assembled only once.
+     */
+    detail_::SchurApproximation& schurApproximation()
+    {
+        return schurApproximation_;
+    }
+
+    //--------------------------------------------------------------------------
+    //! Convert the triplets to the four sparse matrix blocks
+    void finishAssembly( const bool destroyTriplet = true )
+    {
+        tripletContainer_.prepare();
+
+        typedef Eigen::Triplet<number> Triplet;
+        std::vector<Triplet> tA, tB, tC, tD;
+
+        const int n1 = static_cast<int>( size1_ );
+
+        std::vector<TripletContainer::Triplet>::const_iterator
+            iter = tripletContainer_.begin();
+        std::vector<TripletContainer::Triplet>::const_iterator
+            end  = tripletContainer_.end();
+        for ( ; iter != end; ++iter ) {
+            const int r = static_cast<int>( iter -> row() );
+            const int c = static_cast<int>( iter -> col() );
+            const number v = iter -> value();
+            if ( r < n1 ) {
+                if ( c < n1 ) tA.push_back( Triplet( r,      c,      v ) );
+                else          tB.push_back( Triplet( r,      c - n1, v ) );
+            }
+            else {
+                if ( c < n1 ) tC.push_back( Triplet( r - n1, c,      v ) );
+                else          tD.push_back( Triplet( r - n1, c - n1, v ) );
+            }
+        }
+
+        const int s1 = static_cast<int>( size1_ );
+        const int s2 = static_cast<int>( size2_ );
+        A_.resize( s1, s1 ); A_.setFromTriplets( tA.begin(), tA.end() );
+        B_.resize( s1, s2 ); B_.setFromTriplets( tB.begin(), tB.end() );
+        C_.resize( s2, s1 ); C_.setFromTriplets( tC.begin(), tC.end() );
+        D_.resize( s2, s2 ); D_.setFromTriplets( tD.begin(), tD.end() );
+
+        if ( destroyTriplet ) tripletContainer_.destroy();
+
+        // (re-)convert the approximation if it has been (re-)assembled
+        if ( schurType_ == ASSEMBLED and not schurApproximation_.isAssembled() )
+            schurApproximation_.finishAssembly( destroyTriplet );
+
+        return;
+    }
+
+    //--------------------------------------------------------------------------
+    //! @name Re-use of the solver object, see base::solver::Eigen3
+    //@{
+    void clearRHS() { b_.setZero(); }
+
+    void clearLHS()
+    {
+        tripletContainer_.clearValues();
+        if ( not tripletContainer_.isPreStructured() ) analysedA_ = false;
+    }
+    //@}
+
+    //--------------------------------------------------------------------------
+    //! Compute and store the factorisations of A and of the Schur approximation
+    void factorise()
+    {
+        if ( not factorA_ ) factorA_.reset( new Factorisation );
+        if ( not factorS_ ) factorS_.reset( new Factorisation );
+
+        factoriseBlock_( A_, *factorA_, analysedA_, "A" );
+
+        // the SIMPLE approximation can change its pattern with A
+        if ( schurType_ == SIMPLE ) {
+            this -> simpleSchurComplement_( S_ );
+            analysedS_ = false;
+        }
+        else {
+            VERIFY_MSG( schurApproximation_.isAssembled(),
+                        "Schur complement approximation has not been assembled" );
+            S_ = schurApproximation_.matrix();
+            // a re-assembled approximation can have a new pattern
+            if ( not schurApproximation_.isPreStructured() ) analysedS_ = false;
+        }
+
+        factoriseBlock_( S_, *factorS_, analysedS_, "S" );
+    }
+
+    /** Krylov solution with the stored factorisations as preconditioner
+     *  \param[in] tolerance Relative residual tolerance
+     *  \param[in] maxIter   Maximal number of iterations
+     *  \param[in] restart   Number of iterations before a restart of GMRES
+     *  \return              Number of iterations
+     */
+    unsigned solveFactorised( const double   tolerance = 1.e-10,
+                              const unsigned maxIter   = 500,
+                              const unsigned restart   = 50 )
+    {
+        VERIFY_MSG( factorA_ and factorS_,
+                    "Call factorise() before solveFactorised()" );
+        VectorD x = VectorD::Zero( b_.size() );
+        const unsigned numIter = this -> gmres_( b_, x, tolerance, maxIter, restart );
+        b_ = x;
+        return numIter;
+    }
+
+    //! Factorise the blocks and solve, arguments as in solveFactorised()
+    unsigned schurSolve( const double   tolerance = 1.e-10,
+                         const unsigned maxIter   = 500,
+                         const unsigned restart   = 50 )
+    {
+        this -> factorise();
+        return this -> solveFactorised( tolerance, maxIter, restart );
+    }
+
+    //! Relative residual achieved by the last Krylov solve
+    double lastResidual() const { return residual_; }
+    //@}
+
+    //--------------------------------------------------------------------------
+    //! Give the norm of the rhs/solution vector
+    double norm() const
+    {
+        return ( this -> norm( 0, b_.size() ) );
+    }
+
+    double norm( const std::size_t first,
+                 const std::size_t last  ) const
+    {
+        return ( b_.segment( first, last-first).norm() /
+                 static_cast<double>( b_.segment( first, last-first).size() ) );
+    }
+
+    //! Direct access to an entry in the RHS/solution vector
+    number getValue( const std::size_t index ) const
+    {
+        return b_[ index ];
+    }
+
+    //! Direct access to the full RHS/solution vector
+    const VectorD& getVector() const { return b_; }
+
+    //! Size of the system
+    std::size_t size() const { return size1_ + size2_; }
+
+    //! @name Access to the blocks
+    //@{
+    const SparseMatrix& blockA() const { return A_; }
+    const SparseMatrix& blockB() const { return B_; }
+    const SparseMatrix& blockC() const { return C_; }
+    const SparseMatrix& blockD() const { return D_; }
+    //@}
+
+private:
+    typedef detail_::Factorisation Factorisation;
+
+    //--------------------------------------------------------------------------
+    static void factoriseBlock_( const SparseMatrix& M, Factorisation& factor,
+                                 bool& analysed, const std::string& name )
+    {
+        if ( not analysed ) {
+            factor.analyzePattern( M );
+            analysed = true;
+        }
+        factor.factorize( M );
+        VERIFY_MSG( factor.info() == Eigen::Success,
+                    "LU factorisation of block " + name + " failed" );
+    }
+
+    //--------------------------------------------------------------------------
+    //! SIMPLE approximation  S = D - C diag(A)^{-1} B
+    void simpleSchurComplement_( SparseMatrix& S ) const
+    {
+        VectorD invDiag = A_.diagonal();
+        for ( int i = 0; i < invDiag.size(); i++ ) {
+            VERIFY_MSG( std::abs( invDiag[i] ) > 0.,
+                        "Zero diagonal entry in block A" );
+            invDiag[i] = 1. / invDiag[i];
+        }
+
+        SparseMatrix DinvB = invDiag.asDiagonal() * B_;
+        S = D_;
+        S -= C_ * DinvB;
+        S.makeCompressed();
+    }
+
+    //--------------------------------------------------------------------------
+    //! Matrix-vector product with the full system
+    void multiply_( const VectorD& u, VectorD& v ) const
+    {
+        const int s1 = static_cast<int>( size1_ );
+        const int s2 = static_cast<int>( size2_ );
+        v.resize( u.size() );
+        v.head( s1 ) = A_ * u.head( s1 ) + B_ * u.tail( s2 );
+        v.tail( s2 ) = C_ * u.head( s1 ) + D_ * u.tail( s2 );
+    }
+
+    //! Application of the inverse block triangular preconditioner
+    void precondition_( const VectorD& r, VectorD& z ) const
+    {
+        const int s1 = static_cast<int>( size1_ );
+        const int s2 = static_cast<int>( size2_ );
+        z.resize( r.size() );
+
+        const VectorD z2 = factorS_ -> solve( VectorD( r.tail( s2 ) ) );
+        const VectorD r1 = r.head( s1 ) - B_ * z2;
+        z.head( s1 ) = factorA_ -> solve( r1 );
+        z.tail( s2 ) = z2;
+    }
+
+    //--------------------------------------------------------------------------
+    /** Right-preconditioned restarted GMRES, see Saad, Iterative Methods for
+     *  Sparse Linear Systems, Alg. 9.5
+     */
+    unsigned gmres_( const VectorD& rhs, VectorD& x,
+                     const double tolerance, const unsigned maxIter,
+                     const unsigned restart )
+    {
+        const double rhsNorm = rhs.norm();
+        residual_ = 0.;
+        if ( rhsNorm == 0. ) { x.setZero(); return 0; }
+
+        const int m = static_cast<int>( restart );
+        std::vector<VectorD> V( m+1 ), Z( m );
+        Eigen::MatrixXd H = Eigen::MatrixXd::Zero( m+1, m );
+        VectorD cs( m ), sn( m ), g( m+1 );
+        VectorD w;
+
+        unsigned iter = 0;
+        while ( iter < maxIter ) {
+
+            // residual and first basis vector
+            this -> multiply_( x, w );
+            VectorD r = rhs - w;
+            double beta = r.norm();
+            residual_ = beta / rhsNorm;
+            if ( residual_ <= tolerance ) break;
+
+            V[0] = r / beta;
+            g.setZero(); g[0] = beta;
+
+            int j = 0;
+            bool converged = false;
+            while ( (j < m) and (iter < maxIter) and (not converged) ) {
+
+                // Arnoldi step with modified Gram-Schmidt
+                this -> precondition_( V[j], Z[j] );
+                this -> multiply_(   Z[j], w );
+                for ( int i = 0; i <= j; i++ ) {
+                    H(i,j) = w.dot( V[i] );
+                    w     -= H(i,j) * V[i];
+                }
+                H(j+1,j) = w.norm();
+                if ( H(j+1,j) > 0. ) V[j+1] = w / H(j+1,j);
+
+                // apply previous Givens rotations
+                for ( int i = 0; i < j; i++ ) {
+                    const double tmp =  cs[i] * H(i,j) + sn[i] * H(i+1,j);
+                    H(i+1,j)         = -sn[i] * H(i,j) + cs[i] * H(i+1,j);
+                    H(i,j)           = tmp;
+                }
+
+                // new rotation
+                const double denom = std::sqrt( H(j,j)*H(j,j) + H(j+1,j)*H(j+1,j) );
+                cs[j] = H(j,j)   / denom;
+                sn[j] = H(j+1,j) / denom;
+                H(j,j)   = denom;
+                H(j+1,j) = 0.;
+                g[j+1] = -sn[j] * g[j];
+                g[j]   =  cs[j] * g[j];
+
+                residual_ = std::abs( g[j+1] ) / rhsNorm;
+                converged = ( residual_ <= tolerance );
+                j++; iter++;
+            }
+
+            // solve the upper triangular system and update
+            VectorD y = H.topLeftCorner( j, j ).triangularView<Eigen::Upper>().
+                solve( g.head( j ) );
+            for ( int i = 0; i < j; i++ ) x += y[i] * Z[i];
+
+            if ( converged ) break;
+        }
+
+        return iter;
+    }
+
+private:
+    const std::size_t size1_;      //!< Size of the first block
+    const std::size_t size2_;      //!< Size of the second block
+    const SchurType   schurType_;  //!< Type of Schur complement approximation
+
+    TripletContainer              tripletContainer_;  //!< Assembly storage
+    detail_::SchurApproximation   schurApproximation_; //!< Assembled S
+    VectorD                       b_;                 //!< RHS and solution
+
+    SparseMatrix A_, B_, C_, D_;  //!< System blocks
+    SparseMatrix S_;              //!< Schur complement approximation
+
+    //! @name Stored factorisations
+    //@{
+    boost::shared_ptr<Factorisation> factorA_;
+    boost::shared_ptr<Factorisation> factorS_;
+    bool                             analysedA_;
+    bool                             analysedS_;
+    //@}
+
+    double residual_; //!< Relative residual of the last solve
+};
+
+#endif
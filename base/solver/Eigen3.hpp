@@ -16,6 +16,7 @@
 #include <vector>
 #include <set>
 #include <boost/unordered_set.hpp>
+#include <boost/shared_ptr.hpp>
 
 // Eigen includes
 #include <Eigen/Sparse>
@@ -37,12 +38,29 @@
 // base includes
 #include <base/linearAlgebra.hpp>
 #include <base/io/Format.hpp>
+#include <base/auxi/Profiler.hpp>
 #include <base/solver/TripletContainer.hpp>
+#include <base/solver/SubdomainContainer.hpp>
+#include <base/solver/Multigrid.hpp>
 
 //------------------------------------------------------------------------------
 namespace base{
     namespace solver{
         class Eigen3;
+
+        namespace detail_{
+
+            //! Sparse LU factorisation used for repeated solves
+#ifdef LOAD_PARDISO
+            typedef Eigen::PardisoLU<Eigen::SparseMatrix<number> > Factorisation;
+#elif defined(LOAD_UMFPACK)
+            typedef Eigen::UmfPackLU<Eigen::SparseMatrix<number> > Factorisation;
+#elif defined(LOAD_SUPERLU)
+            typedef Eigen::SuperLU<  Eigen::SparseMatrix<number> > Factorisation;
+#else
+            typedef Eigen::SparseLU< Eigen::SparseMatrix<number> > Factorisation;
+#endif
+        }
     }
 }
 
@@ -59,16 +77,23 @@ namespace base{
  *  The storage and solution functionality of this object is entirely based on
  *  <a href="http://eigen.tuxfamily.org/">Eigen3</a> which provides the
  *  interface to several solver packages.
- *  
+ *
+ *  By default, the matrix entries are collected in a TripletContainer. With
+ *  the flag subdomainAssembly, a SubdomainContainer is used instead in which
+ *  every thread assembles into its private storage and the interface rows are
+ *  merged in finishAssembly. In this case, all fields have to be registered.
  */
 class base::solver::Eigen3
 {
 public:
     //!
     typedef base::solver::TripletContainer TripletContainer;
+    typedef base::solver::SubdomainContainer SubdomainContainer;
 
     //! Constructor with the size \f$ N \f$ of matrix and vector
-    Eigen3( const std::size_t size )
+    Eigen3( const std::size_t size, const bool subdomainAssembly = false )
+        : subdomainAssembly_( subdomainAssembly ),
+          analysed_( false )
     {
         b_.resize( size );
         b_.fill( 0. );
@@ -97,9 +122,14 @@ public:
                 VERIFY_MSG( colIndex < numTotalDoFs,
                             "Col index out of bound: " + x2s( colIndex ) );
 
-                tripletContainer_.insert( static_cast<unsigned>( rowIndex ),
-                                          static_cast<unsigned>( colIndex ),
-                                          matrix( i, j ) );
+                if ( subdomainAssembly_ )
+                    subdomainContainer_.insert( static_cast<unsigned>( rowIndex ),
+                                                static_cast<unsigned>( colIndex ),
+                                                matrix( i, j ) );
+                else
+                    tripletContainer_.insert( static_cast<unsigned>( rowIndex ),
+                                              static_cast<unsigned>( colIndex ),
+                                              matrix( i, j ) );
             }
         }
         return;
@@ -118,7 +148,12 @@ public:
         for ( std::size_t i = 0; i < numNewDoFs; i ++ ) {
             const std::size_t index = dofs[i];
             VERIFY_MSG( index < numTotalDoFs, x2s( index ) + " out of bound" );
-            b_[ dofs[i] ] += vector[i];
+#ifdef _OPENMP
+#pragma omp atomic
+            b_[ index ] += vector[i];
+#else
+            b_[ index ] += vector[i];
+#endif
         }
         return;
     }
@@ -141,6 +176,14 @@ public:
     //! Convert the triplet to sparse matrix storage
     void finishAssembly( const bool destroyTriplet = true )
     {
+        PROFILE_REGION( "Eigen3::finishAssembly" );
+        // merge the thread-private storage
+        if ( subdomainAssembly_ ) {
+            subdomainContainer_.assemble( A_ );
+            if ( destroyTriplet ) subdomainContainer_.destroy();
+            return;
+        }
+        
         tripletContainer_.prepare();
         
 
@@ -152,10 +195,67 @@ public:
         return;
     }
 
+    //--------------------------------------------------------------------------
+    /** @name Re-use of the solver object.
+     *  In nonlinear iterations, the same object can be used repeatedly: the
+     *  rhs vector and the matrix values are reset while the registered
+     *  non-zero pattern (see registerFields) and its symbolic analysis are
+     *  kept. Note that finishAssembly( false ) has to be called in order not
+     *  to destroy the pattern.
+     */
+    //@{
+    void clearRHS() { b_.setZero(); }
+    
+    void clearLHS()
+    {
+        if ( subdomainAssembly_ ) {
+            subdomainContainer_.clearValues();
+            return;
+        }
+        
+        tripletContainer_.clearValues();
+        // in the dynamic case the pattern can change
+        if ( not tripletContainer_.isPreStructured() ) analysed_ = false;
+    }
+    //@}
+
+    //--------------------------------------------------------------------------
+    /** @name Solution with a stored LU factorisation.
+     *  A call to factorise() computes and keeps the factorisation of the
+     *  current matrix, subsequent calls of solveFactorised() only carry out
+     *  forward and backward substitution with the current rhs. This allows,
+     *  e.g., a modified Newton method.
+     */
+    //@{
+    void factorise()
+    {
+        PROFILE_REGION( "Eigen3::factorise" );
+        if ( not factorisation_ )
+            factorisation_.reset( new detail_::Factorisation );
+        
+        if ( not analysed_ ) {
+            factorisation_ -> analyzePattern( A_ );
+            analysed_ = true;
+        }
+        factorisation_ -> factorize( A_ );
+        VERIFY_MSG( factorisation_ -> info() == Eigen::Success,
+                    "LU factorisation failed" );
+    }
+
+    void solveFactorised()
+    {
+        PROFILE_REGION( "Eigen3::solveFactorised" );
+        VERIFY_MSG( factorisation_, "Call factorise() before solveFactorised()" );
+        VectorD x = factorisation_ -> solve( b_ );
+        b_ = x;
+    }
+    //@}
+
     //--------------------------------------------------------------------------
     //! For A s.p.d., solution by a Cholesky method
     void choleskySolve()
     {
+        PROFILE_REGION( "Eigen3::choleskySolve" );
         // create a LLT-decomposition from the system matrix
         Eigen::SimplicialLDLT< Eigen::SparseMatrix<number> > chol( A_ );
 
@@ -205,6 +305,7 @@ public:
 #ifdef LOAD_SUPERLU
     void superLUSolve()
     {
+        PROFILE_REGION( "Eigen3::superLUSolve" );
         Eigen::SuperLU< Eigen::SparseMatrix<number> >  superLU( A_ );
         VectorD x = superLU.solve( b_ );
         b_ = x;
@@ -213,6 +314,7 @@ public:
 
     void luSolve()
     {
+        PROFILE_REGION( "Eigen3::luSolve" );
 #ifdef LOAD_PARDISO
         this -> pardisoLUSolve();
 #elif defined(LOAD_UMFPACK)
@@ -228,11 +330,62 @@ public:
 #endif
         return;
     }
-    
+
+    //--------------------------------------------------------------------------
+    /** Direct solution with a single precision factorisation.
+     *  The factorisation of \f$ A \f$ is carried out in single precision,
+     *  which halves the memory of the factors, and the solution is improved
+     *  by iterative refinement in double precision
+     *  \f[
+     *       r^k = b - A x^k, \quad  \tilde{A} d^k = r^k, \quad
+     *       x^{k+1} = x^k + d^k
+     *  \f]
+     *  with the single precision factors \f$ \tilde{A} \f$. For a moderate
+     *  condition number \f$ \kappa(A) \ll 10^7 \f$, every step reduces the
+     *  residual by a factor of about \f$ \kappa(A) \cdot 10^{-7} \f$. If the
+     *  factorisation fails, the residual is not reduced by at least half
+     *  in a step or the tolerance is not reached within the given number of
+     *  steps, the system is solved by choleskySolve() or luSolve() instead.
+     *  \param[in] isSPD      Use a Cholesky instead of an LU factorisation
+     *  \param[in] tolerance  Relative residual tolerance
+     *  \param[in] maxIter    Maximal number of refinement steps
+     *  \return               Number of refinement steps, -1 if the double
+     *                        precision solver had to be used
+     */
+    int mixedPrecisionSolve( const bool     isSPD     = false,
+                             const double   tolerance = 1.e-12,
+                             const unsigned maxIter   = 10 )
+    {
+        PROFILE_REGION( "Eigen3::mixedPrecisionSolve" );
+        typedef Eigen::SparseMatrix<float> SingleMatrix;
+        const SingleMatrix Af = A_.cast<float>();
+
+        int iter;
+        if ( isSPD ) {
+            Eigen::SimplicialLDLT<SingleMatrix> chol( Af );
+            iter = this -> refine_( chol, tolerance, maxIter );
+        }
+        else {
+            Eigen::SparseLU<SingleMatrix> lu;
+            lu.analyzePattern( Af );
+            lu.factorize( Af );
+            iter = this -> refine_( lu, tolerance, maxIter );
+        }
+
+        // fall back to double precision
+        if ( iter < 0 ) {
+            if ( isSPD ) this -> choleskySolve();
+            else         this -> luSolve();
+        }
+
+        return iter;
+    }
+
 
 #ifdef LOAD_PARDISO
     void pardisoLUSolve( const bool outOfCore = true )
     {
+        PROFILE_REGION( "Eigen3::pardisoLUSolve" );
         Eigen::PardisoLU<Eigen::SparseMatrix<number> > pardisoLU;
         //Eigen::PardisoLU<Eigen::SparseMatrix<number> > pardisoLU( A_ );
         if ( not outOfCore ) pardisoLU.pardisoParameterArray()[59] = 0;
@@ -243,6 +396,7 @@ public:
 
     void pardisoCholeskySolve()
     {
+        PROFILE_REGION( "Eigen3::pardisoCholeskySolve" );
         Eigen::PardisoLDLT<Eigen::SparseMatrix<number> > pardisoLDLT( A_ );
         VectorD x = pardisoLDLT.solve( b_ );
         b_ = x;
@@ -253,6 +407,7 @@ public:
 #ifdef LOAD_UMFPACK
     void umfPackLUSolve()
     {
+        PROFILE_REGION( "Eigen3::umfPackLUSolve" );
         Eigen::UmfPackLU<Eigen::SparseMatrix<number> > umfPackLU( A_ );
         VectorD x = umfPackLU.solve( b_ );
         b_ = x;
@@ -261,10 +416,15 @@ public:
     //@}
     //--------------------------------------------------------------------------
     
-    //! Use a conjugate gradient method for solution (A=A' and A > 0 !!)
-    int cgSolve()
+    /** Use a conjugate gradient method for solution (A=A' and A > 0 !!)
+     *  \param[in] tolerance  Relative residual tolerance (default of Eigen if 0)
+     *  \return               Number of iterations
+     */
+    int cgSolve( const double tolerance = 0. )
     {
+        PROFILE_REGION( "Eigen3::cgSolve" );
         Eigen::ConjugateGradient<Eigen::SparseMatrix<number> > cg;
+        if ( tolerance > 0. ) cg.setTolerance( tolerance );
         cg.compute( A_ );
         VectorD x = cg.solve( b_ );
         // std::cout << "#iterations: " << cg.iterations() << std::endl;
@@ -274,11 +434,14 @@ public:
         return cg.iterations();
     }
 
-    int biCGStabSolve()
+    //! Use a preconditioned BiCGSTAB method, arguments as in cgSolve
+    int biCGStabSolve( const double tolerance = 0. )
     {
+        PROFILE_REGION( "Eigen3::biCGStabSolve" );
         typedef Eigen::IncompleteLUT<number> PreCond;
         
         Eigen::BiCGSTAB<Eigen::SparseMatrix<number>,PreCond > biCG;
+        if ( tolerance > 0. ) biCG.setTolerance( tolerance );
         biCG.compute( A_ );
         VectorD x = biCG.solve( b_ );
         // std::cout << "#iterations: "     << biCG.iterations() << std::endl;
@@ -288,6 +451,30 @@ public:
         return biCG.iterations();
     }
     
+    /** Geometric multigrid method, standalone or as CG preconditioner
+     *  \param[in] multigrid         Multigrid object with level hierarchy
+     *  \param[in] tolerance         Relative residual tolerance
+     *  \param[in] asPreconditioner  Use one cycle as CG preconditioner
+     *  \param[in] maxIter           Maximal number of iterations
+     *  \return                      Number of iterations
+     */
+    int multigridSolve( base::solver::Multigrid& multigrid,
+                        const double   tolerance        = 1.e-10,
+                        const bool     asPreconditioner = true,
+                        const unsigned maxIter          = 200 )
+    {
+        PROFILE_REGION( "Eigen3::multigridSolve" );
+        multigrid.compute( A_ );
+        VectorD x = VectorD::Zero( b_.size() );
+        const unsigned iter =
+            ( asPreconditioner ?
+              multigrid.pcgSolve( b_, x, tolerance, maxIter ) :
+              multigrid.solve(    b_, x, tolerance, maxIter ) );
+        b_ = x;
+
+        return static_cast<int>( iter );
+    }
+    
     //--------------------------------------------------------------------------
     //! Direct access to an entry in the RHS/solution vector
     number getValue( const std::size_t index ) const
@@ -295,6 +482,18 @@ public:
         return b_[ index ];
     }
 
+    //! Direct access to the full RHS/solution vector
+    const VectorD& getVector() const { return b_; }
+
+    //! Size of the system
+    std::size_t size() const { return static_cast<std::size_t>( b_.size() ); }
+
+    //! Number of stored entries of the matrix (after finishAssembly)
+    std::size_t numNonZeros() const
+    {
+        return static_cast<std::size_t>( A_.nonZeros() );
+    }
+
     //--------------------------------------------------------------------------
     //! @name Debug routines for printing
     //@{
@@ -328,17 +527,85 @@ public:
 
     
     //--------------------------------------------------------------------------
-    //! Delegate registering of test and trial field DoFs to tripletContainer
+    //! Delegate registering of test and trial field DoFs to the container
     template<typename FIELDTUPLEBINDER, typename FIELDBINDER>
     void registerFields( const FIELDBINDER& fieldBinder )
     {
-        tripletContainer_.registerFields<FIELDTUPLEBINDER>( fieldBinder );
+        PROFILE_REGION( "Eigen3::registerFields" );
+        if ( subdomainAssembly_ )
+            subdomainContainer_.registerFields<FIELDTUPLEBINDER>( fieldBinder );
+        else
+            tripletContainer_.registerFields<FIELDTUPLEBINDER>( fieldBinder );
+        analysed_ = false;
     }
-    
+
+    //! Delegate registering of a given non-zero pattern to tripletContainer
+    template<typename PAIRITER>
+    void registerIndexPairs( PAIRITER first, PAIRITER last )
+    {
+        VERIFY_MSG( not subdomainAssembly_,
+                    "Subdomain assembly needs the fields to be registered" );
+        tripletContainer_.registerIndexPairs( first, last );
+        analysed_ = false;
+    }
+
 private:
-    TripletContainer            tripletContainer_; //!< Temp. storage of triplets
+    /** Iterative refinement with single precision factors.
+     *  The residual is scaled to unit norm before the conversion in order
+     *  not to underflow in single precision. On success, the solution
+     *  replaces the rhs \f$ b \f$, otherwise \f$ b \f$ remains unchanged.
+     *  \return Number of refinement steps or -1 in case of failure
+     */
+    template<typename FACTORISATION>
+    int refine_( const FACTORISATION& factors,
+                 const double tolerance, const unsigned maxIter )
+    {
+        if ( factors.info() != Eigen::Success ) return -1;
+
+        const double bNorm = b_.norm();
+        if ( bNorm == 0. ) return 0;
+
+        VectorD x = VectorD::Zero( b_.size() );
+        VectorD r = b_;
+        double rNorm = bNorm;
+
+        for ( unsigned k = 0; k <= maxIter; k++ ) {
+
+            // correction with the scaled residual
+            const Eigen::VectorXf rf = ( r / rNorm ).cast<float>();
+            const Eigen::VectorXf df = factors.solve( rf );
+            x += rNorm * df.cast<number>();
+
+            // new residual in double precision
+            r = b_ - A_ * x;
+            const double rNormNew = r.norm();
+
+            if ( not ( rNormNew == rNormNew ) ) return -1;
+            if ( rNormNew <= tolerance * bNorm ) {
+                b_ = x;
+                return static_cast<int>( k );
+            }
+
+            // refinement stalls
+            if ( rNormNew > 0.5 * rNorm ) return -1;
+            rNorm = rNormNew;
+        }
+
+        return -1;
+    }
+
+private:
+    const bool                  subdomainAssembly_;  //!< Use thread storage
+    TripletContainer            tripletContainer_;   //!< Temp. storage of triplets
+    SubdomainContainer          subdomainContainer_; //!< Thread-private storage
     VectorD                     b_;                //!< Given force vector
     Eigen::SparseMatrix<number> A_;                //!< Sparse matrix
+
+    //! @name Stored factorisation
+    //@{
+    boost::shared_ptr<detail_::Factorisation> factorisation_;
+    bool                                      analysed_; //!< Pattern analysed
+    //@}
 };
 
 #endif
@@ -0,0 +1,525 @@
+//------------------------------------------------------------------------------
+// <preamble>
+// </preamble>
+//------------------------------------------------------------------------------
+
+//! @file   Multigrid.hpp
+//! @author agent
+//! @date   2026
+
+#ifndef base_solver_multigrid_hpp
+#define base_solver_multigrid_hpp
+
+//------------------------------------------------------------------------------
+// std includes
+#include <vector>
+#include <utility>
+#include <iterator>
+#include <cmath>
+// boost includes
+#include <boost/shared_ptr.hpp>
+// Eigen includes
+#include <Eigen/Dense>
+#include <Eigen/Sparse>
+// base includes
+#include <base/numbers.hpp>
+#include <base/linearAlgebra.hpp>
+#include <base/MultiIndex.hpp>
+#include <base/verify.hpp>
+#include <base/io/Format.hpp>
+// base/sfun includes
+#include <base/sfun/ShapeFunTraits.hpp>
+
+//------------------------------------------------------------------------------
+namespace base{
+    namespace solver{
+
+        class Multigrid;
+
+        template<typename FEBASIS, typename FIELD>
+        void structuredProlongations(
+            const FIELD& field,
+            const typename base::MultiIndex<FEBASIS::FEFun::dim>::Type& gridSizes,
+            const unsigned numLevels,
+            Multigrid& multigrid );
+
+        namespace detail_{
+
+            //! Sparse rows of a 1D prolongation: pairs of coarse index and weight
+            typedef std::vector< std::vector< std::pair<std::size_t,double> > >
+            Prolongation1D;
+
+            //------------------------------------------------------------------
+            /** Prolongation of a 1D spline space to the uniformly refined one.
+             *  The coarse space is contained in the fine one and the fine
+             *  element \f$ 2e + s \f$ lies in the half \f$ s \f$ of the coarse
+             *  element \f$ e \f$. On every fine element, the \f$ p+1 \f$ fine
+             *  shape functions span the polynomials of degree \f$ p \f$, hence
+             *  the coefficients of the coarse shape functions in the fine
+             *  basis follow from a collocation at \f$ p+1 \f$ points inside
+             *  this element. This holds for any inter-element continuity and
+             *  only makes use of the 1D shape function evaluation.
+             *  \tparam SFUN1D  Type of 1D shape function
+             *  \param[in]  numCoarse  Number of coarse elements
+             *  \param[out] rows       Rows of the fine DoFs
+             */
+            template<typename SFUN1D>
+            void prolongation1D( const std::size_t numCoarse,
+                                 Prolongation1D& rows )
+            {
+                static const unsigned degree     = SFUN1D::degree;
+                static const unsigned continuity = SFUN1D::continuity;
+                static const unsigned numFun     = SFUN1D::numFun;
+                static const unsigned stride     = degree - continuity;
+
+                const std::size_t numFine = 2 * numCoarse;
+                rows.assign( stride * numFine + continuity + 1,
+                             std::vector< std::pair<std::size_t,double> >() );
+
+                SFUN1D sFun;
+                typename SFUN1D::VecDim  xi;
+                typename SFUN1D::FunArray values;
+
+                for ( unsigned s = 0; s < 2; s++ ) {
+
+                    // collocation matrices of fine and coarse functions
+                    base::MatrixD fine( numFun, numFun ), coarse( numFun, numFun );
+                    for ( unsigned k = 0; k < numFun; k++ ) {
+                        const double t = ( k + 0.5 ) / static_cast<double>( numFun );
+
+                        xi[0] = t;
+                        sFun.fun( xi, values );
+                        for ( unsigned i = 0; i < numFun; i++ ) fine( k, i ) = values[i];
+
+                        xi[0] = 0.5 * ( s + t );
+                        sFun.fun( xi, values );
+                        for ( unsigned j = 0; j < numFun; j++ ) coarse( k, j ) = values[j];
+                    }
+
+                    // coefficients of the coarse functions in the fine basis
+                    const base::MatrixD X = fine.fullPivLu().solve( coarse );
+
+                    for ( std::size_t e = 0; e < numCoarse; e++ ) {
+                        const std::size_t fineFirst   = stride * ( 2*e + s );
+                        const std::size_t coarseFirst = stride * e;
+
+                        for ( unsigned i = 0; i < numFun; i++ ) {
+                            std::vector< std::pair<std::size_t,double> >& row =
+                                rows[ fineFirst + i ];
+
+                            for ( unsigned j = 0; j < numFun; j++ ) {
+                                if ( std::abs( X( i, j ) ) < 1.e-12 ) continue;
+
+                                // shared fine DoFs are visited several times
+                                bool isNew = true;
+                                for ( std::size_t r = 0; r < row.size(); r++ )
+                                    if ( row[r].first == coarseFirst + j ) isNew = false;
+                                if ( isNew )
+                                    row.push_back( std::make_pair( coarseFirst + j,
+                                                                   X( i, j ) ) );
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+/** Geometric multigrid method.
+ *  For the linear system \f$ A_0 x = b \f$, a hierarchy of levels \f$ l =
+ *  0, \ldots, L \f$ is given by the prolongation operators \f$ P_l \f$ from
+ *  level \f$ l+1 \f$ to level \f$ l \f$. The coarse operators are formed by
+ *  the Galerkin products
+ *  \f[
+ *      A_{l+1} = P_l^T A_l P_l
+ *  \f]
+ *  and the system on the coarsest level is solved by a sparse LU
+ *  factorisation. One cycle on level \f$ l \f$ consists of pre-smoothing,
+ *  restriction of the residual by \f$ P_l^T \f$, \f$ \gamma \f$ cycles on
+ *  level \f$ l+1 \f$ (V-cycle for \f$ \gamma = 1 \f$, W-cycle for
+ *  \f$ \gamma = 2 \f$), prolongation of the correction and post-smoothing.
+ *  The smoother is either damped Jacobi or Gauss-Seidel. In the latter case,
+ *  the post-smoothing sweeps run backwards such that a cycle is a symmetric
+ *  operator and can serve as preconditioner for a CG method.
+ *
+ *  The prolongations are added from fine to coarse, for structured grids
+ *  they are generated by base::solver::structuredProlongations. Then,
+ *  compute() sets up the hierarchy for a given matrix and solve() or
+ *  pcgSolve() carry out the iterations.
+ */
+class base::solver::Multigrid
+{
+public:
+    //! Type of sparse matrix
+    typedef Eigen::SparseMatrix<number>                 SparseMatrix;
+
+    //! Row-wise storage for the smoothers
+    typedef Eigen::SparseMatrix<number,Eigen::RowMajor> RowMatrix;
+
+    //! Available smoothers
+    enum Smoother { JACOBI, GAUSS_SEIDEL };
+
+    /** Constructor with the cycle parameters
+     *  \param[in] numPreSmooth   Number of pre-smoothing steps
+     *  \param[in] numPostSmooth  Number of post-smoothing steps
+     *  \param[in] cycleIndex     1 for a V-cycle, 2 for a W-cycle
+     *  \param[in] smoother       Type of smoother
+     *  \param[in] damping        Damping factor of the Jacobi smoother
+     */
+    Multigrid( const unsigned numPreSmooth  = 2,
+               const unsigned numPostSmooth = 2,
+               const unsigned cycleIndex    = 1,
+               const Smoother smoother      = GAUSS_SEIDEL,
+               const double   damping       = 0.6 )
+        : numPreSmooth_(  numPreSmooth ),
+          numPostSmooth_( numPostSmooth ),
+          cycleIndex_(    cycleIndex ),
+          smoother_(      smoother ),
+          damping_(       damping )
+    { }
+
+    //--------------------------------------------------------------------------
+    //! @name Definition of the level hierarchy
+    //@{
+    //! Add the prolongation from a new coarsest level to the current one
+    void addProlongation( const SparseMatrix& P )
+    {
+        VERIFY_MSG( prolongations_.empty() or
+                    ( prolongations_.back().cols() == P.rows() ),
+                    "Prolongation does not fit to the coarsest level" );
+        prolongations_.push_back( P );
+    }
+
+    //! Remove all levels
+    void clearProlongations() { prolongations_.clear(); }
+
+    //! Number of levels, including the finest one
+    std::size_t numLevels() const { return prolongations_.size() + 1; }
+    //@}
+
+    //--------------------------------------------------------------------------
+    //! Set up the coarse operators and factorise the coarsest one
+    void compute( const SparseMatrix& A )
+    {
+        VERIFY_MSG( prolongations_.empty() or
+                    ( prolongations_[0].rows() == A.rows() ),
+                    "Matrix size " + x2s( A.rows() ) +
+                    " does not fit to the finest level" );
+
+        operators_.assign( 1, RowMatrix( A ) );
+        SparseMatrix Al = A;
+        for ( std::size_t l = 0; l < prolongations_.size(); l++ ) {
+            const SparseMatrix& P = prolongations_[l];
+            const SparseMatrix AP = Al * P;
+            Al = SparseMatrix( P.transpose() ) * AP;
+            operators_.push_back( RowMatrix( Al ) );
+        }
+
+        // diagonals for the smoothers
+        invDiagonals_.resize( operators_.size() );
+        for ( std::size_t l = 0; l < operators_.size(); l++ ) {
+            const RowMatrix& Al = operators_[l];
+            invDiagonals_[l] = VectorD::Zero( Al.rows() );
+            for ( int i = 0; i < Al.outerSize(); i++ )
+                for ( RowMatrix::InnerIterator it( Al, i ); it; ++it )
+                    if ( it.col() == i ) invDiagonals_[l][i] = 1. / it.value();
+        }
+
+        // direct solver on the coarsest level
+        coarseSolver_.reset( new CoarseSolver );
+        coarseSolver_ -> compute( Al );
+        VERIFY_MSG( coarseSolver_ -> info() == Eigen::Success,
+                    "Factorisation on the coarsest level failed" );
+    }
+
+    //--------------------------------------------------------------------------
+    //! Apply one cycle on the finest level with initial guess x
+    void cycle( const VectorD& b, VectorD& x ) const
+    {
+        this -> cycle_( 0, b, x );
+    }
+
+    /** Multigrid iteration until the relative residual falls below tolerance
+     *  \param[in]    b          Right hand side
+     *  \param[inout] x          Initial guess and solution
+     *  \param[in]    tolerance  Relative residual tolerance
+     *  \param[in]    maxIter    Maximal number of cycles
+     *  \return                  Number of cycles carried out
+     */
+    unsigned solve( const VectorD& b, VectorD& x,
+                    const double tolerance, const unsigned maxIter ) const
+    {
+        const double bNorm = ( b.norm() > 0. ? b.norm() : 1. );
+
+        unsigned iter = 0;
+        for ( ; iter < maxIter; iter++ ) {
+            const VectorD r = b - operators_[0] * x;
+            if ( r.norm() <= tolerance * bNorm ) break;
+            this -> cycle_( 0, b, x );
+        }
+        return iter;
+    }
+
+    /** Conjugate gradient method preconditioned by one cycle, arguments as in
+     *  solve(). The system matrix has to be symmetric positive definite and
+     *  the Jacobi smoother requires the same number of pre- and
+     *  post-smoothing steps.
+     */
+    unsigned pcgSolve( const VectorD& b, VectorD& x,
+                       const double tolerance, const unsigned maxIter ) const
+    {
+        const RowMatrix& A = operators_[0];
+        const double bNorm = ( b.norm() > 0. ? b.norm() : 1. );
+
+        VectorD r = b - A * x;
+        VectorD z = VectorD::Zero( r.size() );
+        this -> cycle_( 0, r, z );
+        VectorD p = z;
+        double rz = r.dot( z );
+
+        unsigned iter = 0;
+        for ( ; iter < maxIter; iter++ ) {
+            if ( r.norm() <= tolerance * bNorm ) break;
+
+            const VectorD Ap = A * p;
+            const double alpha = rz / p.dot( Ap );
+            x += alpha * p;
+            r -= alpha * Ap;
+
+            z.setZero();
+            this -> cycle_( 0, r, z );
+            const double rzNew = r.dot( z );
+            p = z + ( rzNew / rz ) * p;
+            rz = rzNew;
+        }
+        return iter;
+    }
+
+    //! Size of the system on a level
+    std::size_t size( const std::size_t level = 0 ) const
+    {
+        return static_cast<std::size_t>( operators_[level].rows() );
+    }
+
+private:
+    //! Recursive cycle on a level
+    void cycle_( const std::size_t level, const VectorD& b, VectorD& x ) const
+    {
+        // coarsest level: direct solve
+        if ( level + 1 == operators_.size() ) {
+            x = coarseSolver_ -> solve( b );
+            return;
+        }
+
+        const RowMatrix&    A = operators_[level];
+        const SparseMatrix& P = prolongations_[level];
+
+        for ( unsigned s = 0; s < numPreSmooth_; s++ )
+            this -> smooth_( level, b, x, true );
+
+        // coarse grid correction
+        const VectorD r  = b - A * x;
+        const VectorD rc = P.transpose() * r;
+        VectorD ec = VectorD::Zero( rc.size() );
+        for ( unsigned g = 0; g < cycleIndex_; g++ )
+            this -> cycle_( level+1, rc, ec );
+        x += P * ec;
+
+        for ( unsigned s = 0; s < numPostSmooth_; s++ )
+            this -> smooth_( level, b, x, false );
+    }
+
+    //! One smoothing step, Gauss-Seidel sweeps run forward or backward
+    void smooth_( const std::size_t level, const VectorD& b, VectorD& x,
+                  const bool forward ) const
+    {
+        const RowMatrix& A       = operators_[level];
+        const VectorD&   invDiag = invDiagonals_[level];
+
+        if ( smoother_ == JACOBI ) {
+            const VectorD r = b - A * x;
+            x += damping_ * invDiag.cwiseProduct( r );
+            return;
+        }
+
+        const int n = static_cast<int>( A.rows() );
+        for ( int k = 0; k < n; k++ ) {
+            const int i = ( forward ? k : n-1-k );
+            double sum = b[i];
+            for ( RowMatrix::InnerIterator it( A, i ); it; ++it )
+                sum -= it.value() * x[ it.col() ];
+            x[i] += invDiag[i] * sum;
+        }
+    }
+
+private:
+    //! Direct solver on the coarsest level
+    typedef Eigen::SparseLU<SparseMatrix> CoarseSolver;
+
+    const unsigned  numPreSmooth_;  //!< Number of pre-smoothing steps
+    const unsigned  numPostSmooth_; //!< Number of post-smoothing steps
+    const unsigned  cycleIndex_;    //!< Number of recursive cycles
+    const Smoother  smoother_;      //!< Type of smoother
+    const double    damping_;       //!< Damping of the Jacobi smoother
+
+    std::vector<SparseMatrix>          prolongations_; //!< P_l
+    std::vector<RowMatrix>             operators_;     //!< A_l
+    std::vector<VectorD>               invDiagonals_;  //!< diag(A_l)^{-1}
+    boost::shared_ptr<CoarseSolver>    coarseSolver_;  //!< LU of A_L
+};
+
+//------------------------------------------------------------------------------
+/** Generate the prolongations of a hierarchy of structured grids.
+ *  The field is discretised on a structured grid with the dimensions
+ *  \f$ N \f$ (see base::mesh::Structured::gridSizes) and a lexicographic
+ *  basis, e.g. B-splines of any continuity. The coarser levels correspond to
+ *  the grids with \f$ N/2, N/4, \ldots \f$ elements per direction, hence
+ *  \f$ N \f$ has to be divisible by \f$ 2^{L-1} \f$ for \f$ L \f$ levels. No
+ *  coarse grid or field has to be generated, the prolongations are tensor
+ *  products of the 1D subdivision operators (see
+ *  detail_::prolongation1D).
+ *
+ *  On the finest level, the indices are the ones of the active DoF
+ *  components as given by the numbering of the field. Constrained and
+ *  inactive DoF components are not part of the system, their rows are
+ *  omitted from the prolongation and a coarse DoF component is only kept if
+ *  it contributes to any remaining fine one. The coarse indices are numbered
+ *  consecutively.
+ *
+ *  \tparam FEBASIS  Type of FE basis of the field
+ *  \tparam FIELD    Type of field
+ *  \param[in]  field      Numbered field on the finest grid
+ *  \param[in]  gridSizes  Number of elements per direction of the finest grid
+ *  \param[in]  numLevels  Total number of levels \f$ L \f$
+ *  \param[out] multigrid  Multigrid object which receives the prolongations
+ */
+template<typename FEBASIS, typename FIELD>
+void base::solver::structuredProlongations(
+    const FIELD& field,
+    const typename base::MultiIndex<FEBASIS::FEFun::dim>::Type& gridSizes,
+    const unsigned numLevels,
+    Multigrid& multigrid )
+{
+    typedef typename FEBASIS::FEFun              FEFun;
+    typedef typename FEFun::ShapeFun1D           ShapeFun1D;
+    static const unsigned dim     = FEFun::dim;
+    static const unsigned doFSize = FIELD::DegreeOfFreedom::size;
+
+    STATIC_ASSERT_MSG( (FEFun::ordering == base::sfun::LEXICOGRAPHIC),
+                       "Structured multigrid requires a lexicographic basis" );
+
+    typedef base::MultiIndex<dim>           MultiIndex;
+    typedef typename MultiIndex::Type       MultiIndexType;
+
+    static const unsigned stride = ShapeFun1D::degree - ShapeFun1D::continuity;
+    static const unsigned offset = ShapeFun1D::continuity + 1;
+
+    // level indices of the finest level from the DoF numbering
+    std::vector<std::size_t> fineIndices;
+    std::size_t numFine = 0;
+    {
+        const std::size_t numDoFs =
+            static_cast<std::size_t>( std::distance( field.doFsBegin(),
+                                                     field.doFsEnd() ) );
+        VERIFY_MSG( numDoFs == MultiIndex::length( stride * gridSizes + offset ),
+                    "Field does not match the structured grid" );
+
+        fineIndices.assign( numDoFs * doFSize, base::invalidInt );
+        typename FIELD::DoFPtrConstIter dIter = field.doFsBegin();
+        typename FIELD::DoFPtrConstIter dEnd  = field.doFsEnd();
+        for ( ; dIter != dEnd; ++dIter ) {
+            for ( unsigned d = 0; d < doFSize; d++ ) {
+                if ( not (*dIter) -> isActive( d ) ) continue;
+                const std::size_t index = (*dIter) -> getIndex( d );
+                fineIndices[ (*dIter) -> getID() * doFSize + d ] = index;
+                if ( index + 1 > numFine ) numFine = index + 1;
+            }
+        }
+    }
+
+    multigrid.clearProlongations();
+    MultiIndexType fineSizes = gridSizes;
+
+    for ( unsigned l = 1; l < numLevels; l++ ) {
+
+        // sizes of the coarse grid
+        MultiIndexType coarseSizes;
+        for ( unsigned d = 0; d < dim; d++ ) {
+            VERIFY_MSG( fineSizes[d] % 2 == 0,
+                        "Grid size " + x2s( fineSizes[d] ) +
+                        " cannot be coarsened" );
+            coarseSizes[d] = fineSizes[d] / 2;
+        }
+        const MultiIndexType fineDoFs   = stride * fineSizes   + offset;
+        const MultiIndexType coarseDoFs = stride * coarseSizes + offset;
+
+        // 1D operators per direction
+        std::vector<detail_::Prolongation1D> rows1D( dim );
+        for ( unsigned d = 0; d < dim; d++ )
+            detail_::prolongation1D<ShapeFun1D>( coarseSizes[d], rows1D[d] );
+
+        // tensor product of the 1D operators
+        typedef Eigen::Triplet<number> Triplet;
+        std::vector<Triplet> triplets;
+        const std::size_t numCoarseDoFs = MultiIndex::length( coarseDoFs );
+        std::vector<std::size_t> coarseIndices( numCoarseDoFs * doFSize,
+                                                base::invalidInt );
+
+        for ( std::size_t f = 0; f < MultiIndex::length( fineDoFs ); f++ ) {
+            const MultiIndexType fM = MultiIndex::wrap( f, fineDoFs );
+
+            // number of combinations of the 1D entries
+            MultiIndexType numEntries;
+            for ( unsigned d = 0; d < dim; d++ )
+                numEntries[d] = static_cast<int>( rows1D[d][ fM[d] ].size() );
+            if ( ( numEntries == 0 ).any() ) continue;
+
+            for ( std::size_t c = 0; c < MultiIndex::length( numEntries ); c++ ) {
+                const MultiIndexType cM = MultiIndex::wrap( c, numEntries );
+
+                MultiIndexType coarseM;
+                double weight = 1.;
+                for ( unsigned d = 0; d < dim; d++ ) {
+                    coarseM[d] = static_cast<int>( rows1D[d][ fM[d] ][ cM[d] ].first );
+                    weight    *= rows1D[d][ fM[d] ][ cM[d] ].second;
+                }
+                const std::size_t coarse = MultiIndex::unwrap( coarseM, coarseDoFs );
+
+                for ( unsigned d = 0; d < doFSize; d++ ) {
+                    const std::size_t row = fineIndices[ f * doFSize + d ];
+                    if ( row == base::invalidInt ) continue;
+
+                    // mark as used, the column is the coarse DoF key for now
+                    coarseIndices[ coarse * doFSize + d ] = 0;
+                    triplets.push_back( Triplet( static_cast<int>( row ),
+                                                 static_cast<int>( coarse * doFSize + d ),
+                                                 weight ) );
+                }
+            }
+        }
+
+        // consecutive numbering of the used coarse DoF components
+        std::size_t numCoarse = 0;
+        for ( std::size_t k = 0; k < coarseIndices.size(); k++ )
+            if ( coarseIndices[k] != base::invalidInt ) coarseIndices[k] = numCoarse++;
+
+        for ( std::size_t t = 0; t < triplets.size(); t++ )
+            triplets[t] = Triplet( triplets[t].row(),
+                                   static_cast<int>( coarseIndices[ triplets[t].col() ] ),
+                                   triplets[t].value() );
+
+        Multigrid::SparseMatrix P( static_cast<int>( numFine ),
+                                   static_cast<int>( numCoarse ) );
+        P.setFromTriplets( triplets.begin(), triplets.end() );
+        multigrid.addProlongation( P );
+
+        // coarse level becomes the fine level
+        fineIndices.swap( coarseIndices );
+        numFine   = numCoarse;
+        fineSizes = coarseSizes;
+    }
+}
+
+#endif
@@ -0,0 +1,421 @@
+//------------------------------------------------------------------------------
+// <preamble>
+// </preamble>
+//------------------------------------------------------------------------------
+
+//! @file   Newton.hpp
+//! @author agent
+//! @date   2026
+
+#ifndef base_solver_newton_hpp
+#define base_solver_newton_hpp
+
+//------------------------------------------------------------------------------
+// std   includes
+#include <ostream>
+#include <vector>
+#include <limits>
+#include <algorithm>
+#include <cmath>
+// boost includes
+#include <boost/function.hpp>
+#include <boost/utility.hpp>
+// base includes
+#include <base/numbers.hpp>
+#include <base/linearAlgebra.hpp>
+#include <base/verify.hpp>
+#include <base/auxi/Timer.hpp>
+// base/solver includes
+#include <base/solver/Eigen3.hpp>
+
+//------------------------------------------------------------------------------
+namespace base{
+    namespace solver{
+
+        class ScaledVector;
+
+        template<typename SOLVER = base::solver::Eigen3>
+        class Newton;
+
+        //! Choice of the linear solver in the Newton iterations
+        enum LinearSolve
+        {
+            DIRECT,   //!< Stored LU factorisation (re-used in modified Newton)
+            CG,       //!< Inexact conjugate gradients (symmetric tangent)
+            BICGSTAB  //!< Inexact BiCGSTAB
+        };
+
+        //! Telemetry of a single Newton iteration
+        struct NewtonIteration
+        {
+            unsigned iteration;        //!< Iteration counter
+            double   residualNorm;     //!< Norm of residual before the update
+            double   incrementNorm;    //!< Norm of the applied increment
+            double   stepLength;       //!< Line search factor
+            bool     newTangent;       //!< Tangent matrix has been rebuilt
+            int      linearIterations; //!< Iterations of linear solver (or 0)
+            double   assemblyTime;     //!< Time of assembly in milliseconds
+            double   solveTime;        //!< Time of linear solve in milliseconds
+        };
+    }
+}
+
+//------------------------------------------------------------------------------
+/** Source of values for the DoF distribution with a scaled vector.
+ *  Provides the getValue interface of the solver, such that
+ *  base::dof::addToDoFsFromSolver can be used with a fraction of the Newton
+ *  increment as determined by a line search.
+ */
+class base::solver::ScaledVector
+{
+public:
+    ScaledVector( const base::VectorD& vec, const double factor )
+        : vec_( vec ), factor_( factor ) { }
+
+    number getValue( const std::size_t index ) const
+    {
+        return factor_ * vec_[ static_cast<int>( index ) ];
+    }
+
+private:
+    const base::VectorD& vec_;
+    const double         factor_;
+};
+
+//------------------------------------------------------------------------------
+/** Newton-Raphson method for the nonlinear system \f$ R(u) = 0 \f$.
+ *  The solver object and its registered non-zero pattern are kept over all
+ *  iterations and all calls of solve(). The application provides
+ *  -  a residual function which assembles the rhs \f$ -R(u) \f$ into the
+ *     solver (e.g. via base::asmb::computeResidualForces and external forces)
+ *  -  a tangent function which assembles the matrix \f$ \partial R/\partial u \f$
+ *     (e.g. via base::asmb::stiffnessMatrixComputation)
+ *  -  an update function which adds the given increment to the DoFs, e.g.
+ *     \code{.cpp}
+ *     void update( const base::solver::ScaledVector& dx, Field& field )
+ *     {
+ *         base::dof::addToDoFsFromSolver( dx, field );
+ *     }
+ *     \endcode
+ *     bound by boost::bind( &update, _1, boost::ref( field ) )
+ *
+ *  Features which reduce the number of factorisations and assemblies:
+ *  -  Modified Newton: the tangent (and its factorisation) is only rebuilt if
+ *     the residual reduction \f$ |R_k| / |R_{k-1}| \f$ exceeds a given ratio,
+ *     after a given number of re-uses or after a damped step. The tangent is
+ *     always built in the first iteration of solve(), because it also
+ *     carries the contribution of changed Dirichlet constraints.
+ *  -  Backtracking line search: the increment is halved until the residual
+ *     norm has decreased sufficiently (Armijo condition). The residual of
+ *     the accepted step is kept for the next iteration.
+ *  -  Inexact solves: for the iterative linear solvers the tolerance is
+ *     chosen by the forcing term of Eisenstat and Walker,
+ *     \f$ \eta_k = \min( \eta_{max}, 0.9 (|R_k|/|R_{k-1}|)^2 ) \f$.
+ *
+ *  Every iteration is recorded as base::solver::NewtonIteration.
+ *  Convergence is measured with the norm of the solver (see Eigen3::norm)
+ *  either by the residual or the increment. The residual norm used for the
+ *  line search, the rebuild ratio and the forcing term is always taken from
+ *  the residual function alone. The tangent assembly adds the terms of
+ *  changed Dirichlet values to the rhs, therefore the convergence check uses
+ *  the full rhs and a step with such terms is not damped.
+ *
+ *  \tparam SOLVER Type of linear solver
+ */
+template<typename SOLVER>
+class base::solver::Newton
+    : public boost::noncopyable
+{
+public:
+    //! Template parameter: type of solver
+    typedef SOLVER Solver;
+
+    //! @name Callback types
+    //@{
+    typedef boost::function<void( Solver& )>             AssembleFun;
+    typedef boost::function<void( const ScaledVector& )> UpdateFun;
+    //@}
+
+    //--------------------------------------------------------------------------
+    /** Constructor with problem size and callbacks
+     *  \param[in] size     Number of unknowns
+     *  \param[in] residual Assembly of the residual (rhs)
+     *  \param[in] tangent  Assembly of the tangent matrix (lhs)
+     *  \param[in] update   Distribution of the increment to the DoFs
+     */
+    Newton( const std::size_t size,
+            const AssembleFun& residual,
+            const AssembleFun& tangent,
+            const UpdateFun&   update )
+        : solver_( size ),
+          residual_( residual ), tangent_( tangent ), update_( update ),
+          residualTolerance_( 1.e-10 ), incrementTolerance_( 1.e-10 ),
+          maxIterations_( 20 ),
+          modified_( false ), rebuildRatio_( 0.25 ), maxReuse_( 5 ),
+          lineSearch_( false ), maxBacktracks_( 6 ), armijo_( 1.e-4 ),
+          linearSolve_( DIRECT ), etaMax_( 1.e-2 ),
+          numFactorisations_( 0 ), numAssemblies_( 0 )
+    { }
+
+    //--------------------------------------------------------------------------
+    //! @name Configuration
+    //@{
+    void setTolerances( const double residual, const double increment )
+    {
+        residualTolerance_  = residual;
+        incrementTolerance_ = increment;
+    }
+
+    void setMaxIterations( const unsigned maxIter ) { maxIterations_ = maxIter; }
+
+    /** Enable the modified Newton method
+     *  \param[in] rebuildRatio Rebuild tangent if residual reduction is worse
+     *  \param[in] maxReuse     Maximal number of iterations with old tangent
+     */
+    void setModifiedNewton( const double rebuildRatio = 0.25,
+                            const unsigned maxReuse = 5 )
+    {
+        modified_     = true;
+        rebuildRatio_ = rebuildRatio;
+        maxReuse_     = maxReuse;
+    }
+
+    /** Enable the backtracking line search
+     *  \param[in] maxBacktracks Maximal number of halvings of the step
+     *  \param[in] armijo        Factor of the sufficient decrease condition
+     */
+    void setLineSearch( const unsigned maxBacktracks = 6,
+                        const double armijo = 1.e-4 )
+    {
+        lineSearch_    = true;
+        maxBacktracks_ = maxBacktracks;
+        armijo_        = armijo;
+    }
+
+    /** Choose the linear solver
+     *  \param[in] linearSolve Type of linear solver
+     *  \param[in] etaMax      Maximal tolerance of the iterative solvers
+     */
+    void setLinearSolve( const LinearSolve linearSolve,
+                         const double etaMax = 1.e-2 )
+    {
+        linearSolve_ = linearSolve;
+        etaMax_      = etaMax;
+    }
+    //@}
+
+    //! Access to the solver, e.g. for registerFields
+    Solver& solver() { return solver_; }
+
+    //--------------------------------------------------------------------------
+    /** Carry out the Newton iterations.
+     *  \return Flag if the iterations have converged
+     */
+    bool solve()
+    {
+        history_.clear();
+
+        bool   forceTangent = true;
+        unsigned numReuse   = 0;
+        double prevResidual = std::numeric_limits<double>::max();
+
+        // residual of the accepted line search step, still in the solver
+        bool   haveTrial = false;
+        double trialNorm = 0.;
+
+        for ( unsigned iter = 0; iter < maxIterations_; iter++ ) {
+
+            NewtonIteration info;
+            info.iteration        = iter;
+            info.incrementNorm    = 0.;
+            info.stepLength       = 0.;
+            info.linearIterations = 0;
+            info.solveTime        = 0.;
+
+            base::auxi::Timer timer;
+
+            // residual, its norm is taken before the tangent assembly adds
+            // the terms of the Dirichlet increments; after a line search the
+            // rhs of the accepted step is already assembled
+            const double residualNorm =
+                ( haveTrial ? trialNorm : this -> residualNorm_() );
+            haveTrial = false;
+
+            // tangent only if requested
+            bool newTangent = forceTangent or (not modified_) or
+                ( numReuse >= maxReuse_ );
+
+            // poor convergence with the old tangent: rebuild now
+            if ( (not newTangent) and
+                 ( residualNorm > rebuildRatio_ * prevResidual ) )
+                newTangent = true;
+
+            if ( newTangent ) this -> assembleTangent_();
+
+            // norm of the full rhs, differs if Dirichlet values are imposed
+            const double rhsNorm = solver_.norm();
+            const bool dirichletStep = ( rhsNorm != residualNorm );
+
+            info.residualNorm = residualNorm;
+            info.newTangent   = newTangent;
+            info.assemblyTime = timer.milliSeconds();
+
+            // convergence by residual
+            if ( rhsNorm < residualTolerance_ ) {
+                history_.push_back( info );
+                return true;
+            }
+
+            // linear solve
+            timer.reset();
+            info.linearIterations =
+                this -> solveLinear_( newTangent, residualNorm, prevResidual );
+            info.solveTime = timer.milliSeconds();
+            increment_ = solver_.getVector();
+
+            // update with line search
+            timer.reset();
+            double alpha = 1.0;
+            update_( ScaledVector( increment_, alpha ) );
+
+            // a step which imposes Dirichlet values is taken in full, the
+            // residual before the step does not contain these values
+            if ( lineSearch_ and (not dirichletStep) ) {
+                trialNorm = this -> residualNorm_();
+                for ( unsigned b = 0;
+                      ( b < maxBacktracks_ ) and
+                          ( trialNorm > (1. - armijo_ * alpha) * residualNorm );
+                      b++ ) {
+                    const double newAlpha = 0.5 * alpha;
+                    update_( ScaledVector( increment_, newAlpha - alpha ) );
+                    alpha = newAlpha;
+                    trialNorm = this -> residualNorm_();
+                }
+                haveTrial = true;
+            }
+            info.assemblyTime += timer.milliSeconds();
+
+            info.stepLength    = alpha;
+            info.incrementNorm = alpha * increment_.norm() /
+                static_cast<double>( increment_.size() );
+            history_.push_back( info );
+
+            // book-keeping for the modified Newton method
+            numReuse     = ( newTangent ? 0 : numReuse + 1 );
+            forceTangent = ( alpha < 1.0 );
+            prevResidual = residualNorm;
+
+            // convergence by increment
+            if ( info.incrementNorm < incrementTolerance_ ) return true;
+        }
+
+        return false;
+    }
+
+    //--------------------------------------------------------------------------
+    //! @name Telemetry
+    //@{
+    const std::vector<NewtonIteration>& history() const { return history_; }
+
+    unsigned numIterations() const
+    {
+        return static_cast<unsigned>( history_.size() );
+    }
+
+    //! Accumulated numbers over all calls of solve()
+    unsigned numFactorisations() const { return numFactorisations_; }
+    unsigned numAssemblies()     const { return numAssemblies_; }
+
+    //! Write a table of the last iterations
+    void writeHistory( std::ostream& out ) const
+    {
+        out << "# iter  residual  increment  alpha  tangent  linIter"
+            << "  tAssembly[ms]  tSolve[ms] \n";
+        for ( std::size_t i = 0; i < history_.size(); i++ ) {
+            const NewtonIteration& info = history_[i];
+            out << info.iteration        << "  "
+                << info.residualNorm     << "  "
+                << info.incrementNorm    << "  "
+                << info.stepLength       << "  "
+                << info.newTangent       << "  "
+                << info.linearIterations << "  "
+                << info.assemblyTime     << "  "
+                << info.solveTime        << "\n";
+        }
+    }
+    //@}
+
+private:
+    //! Assemble and finish the tangent matrix, keeping the pattern
+    void assembleTangent_()
+    {
+        solver_.clearLHS();
+        tangent_( solver_ );
+        solver_.finishAssembly( false );
+    }
+
+    //! Evaluate the residual and return its norm
+    double residualNorm_()
+    {
+        solver_.clearRHS();
+        residual_( solver_ );
+        numAssemblies_++;
+        return solver_.norm();
+    }
+
+    //! Solve for the increment, return number of linear iterations
+    int solveLinear_( const bool newTangent, const double residualNorm,
+                     const double prevResidual )
+    {
+        if ( linearSolve_ == DIRECT ) {
+            if ( newTangent or ( numFactorisations_ == 0 ) ) {
+                solver_.factorise();
+                numFactorisations_++;
+            }
+            solver_.solveFactorised();
+            return 0;
+        }
+
+        // forcing term of Eisenstat-Walker
+        double eta = etaMax_;
+        if ( prevResidual < std::numeric_limits<double>::max() ) {
+            const double ratio = residualNorm / prevResidual;
+            eta = std::min( etaMax_, 0.9 * ratio * ratio );
+        }
+
+        if ( linearSolve_ == CG ) return solver_.cgSolve( eta );
+        return solver_.biCGStabSolve( eta );
+    }
+
+private:
+    Solver      solver_;   //!< Linear solver kept over the iterations
+
+    //! @name Callbacks
+    //@{
+    AssembleFun residual_;
+    AssembleFun tangent_;
+    UpdateFun   update_;
+    //@}
+
+    //! @name Parameters
+    //@{
+    double      residualTolerance_;
+    double      incrementTolerance_;
+    unsigned    maxIterations_;
+    bool        modified_;
+    double      rebuildRatio_;
+    unsigned    maxReuse_;
+    bool        lineSearch_;
+    unsigned    maxBacktracks_;
+    double      armijo_;
+    LinearSolve linearSolve_;
+    double      etaMax_;
+    //@}
+
+    base::VectorD                increment_;         //!< Newton increment
+    std::vector<NewtonIteration> history_;           //!< Telemetry
+    unsigned                     numFactorisations_; //!< Counter
+    unsigned                     numAssemblies_;     //!< Counter
+};
+
+#endif
@@ -0,0 +1,398 @@
+//------------------------------------------------------------------------------
+// <preamble>
+// </preamble>
+//------------------------------------------------------------------------------
+
+//! @file   StaticCondensation.hpp
+//! @author agent
+//! @date   2026
+
+#ifndef base_solver_staticcondensation_hpp
+#define base_solver_staticcondensation_hpp
+
+//------------------------------------------------------------------------------
+// std includes
+#include <vector>
+#include <set>
+#include <utility>
+#include <algorithm>
+// Eigen includes
+#include <Eigen/Dense>
+// base includes
+#include <base/linearAlgebra.hpp>
+#include <base/verify.hpp>
+#include <base/io/Format.hpp>
+// base/solver includes
+#include <base/solver/TripletContainer.hpp>
+
+//------------------------------------------------------------------------------
+namespace base{
+    namespace solver{
+
+        template<typename SOLVER>
+        class StaticCondensation;
+
+        namespace detail_{
+
+            //------------------------------------------------------------------
+            //! Blocks of the system matrix and RHS belonging to one element
+            struct CondensedElement
+            {
+                std::size_t first;   //!< First interior index
+                std::size_t num;     //!< Number of interior indices
+
+                std::vector<std::size_t> coupled; //!< Coupled global indices
+
+                base::MatrixD Kii;   //!< Interior-interior block
+                base::MatrixD Kic;   //!< Interior-coupled block
+                base::MatrixD Kci;   //!< Coupled-interior block
+                base::VectorD fi;    //!< Interior RHS
+
+                base::MatrixD X;     //!< Kii^{-1} Kic
+                base::VectorD y;     //!< Kii^{-1} fi
+
+                //! Local position of a registered global index (sorted storage)
+                std::size_t coupledIndex( const std::size_t index ) const
+                {
+                    std::vector<std::size_t>::const_iterator pos =
+                        std::lower_bound( coupled.begin(), coupled.end(), index );
+                    VERIFY_MSG( (pos != coupled.end()) and (*pos == index),
+                                "Coupled index " + x2s( index ) +
+                                " has not been registered" );
+                    return static_cast<std::size_t>( pos - coupled.begin() );
+                }
+
+                //! Add global indices to the coupled ones
+                void addCoupled( const std::vector<std::size_t>& indices )
+                {
+                    coupled.insert( coupled.end(), indices.begin(), indices.end() );
+                    std::sort( coupled.begin(), coupled.end() );
+                    coupled.erase( std::unique( coupled.begin(), coupled.end() ),
+                                   coupled.end() );
+                }
+            };
+
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+/** Static condensation of element-interior unknowns.
+ *  With higher-order elements, a significant part of the unknowns belongs to
+ *  a single element only (e.g., the bubble functions of quadratic Lagrange
+ *  elements). Splitting the unknowns into these interior ones \f$ u_i \f$
+ *  and the coupled ones \f$ u_c \f$, the element contribution reads
+ *  \f[
+ *      \begin{pmatrix} K_{cc} & K_{ci} \\ K_{ic} & K_{ii} \end{pmatrix}
+ *      \begin{pmatrix} u_c \\ u_i \end{pmatrix} =
+ *      \begin{pmatrix} f_c \\ f_i \end{pmatrix}
+ *  \f]
+ *  and the interior unknowns are eliminated element by element via
+ *  \f[
+ *      (K_{cc} - K_{ci} K_{ii}^{-1} K_{ic}) u_c = f_c - K_{ci} K_{ii}^{-1} f_i
+ *  \f]
+ *  before the reduced system is inserted into the global solver. After the
+ *  solution of the global system, recover() computes the interior unknowns
+ *  \f$ u_i = K_{ii}^{-1} ( f_i - K_{ic} u_c ) \f$.
+ *
+ *  This object replaces the solver in the assembly calls (base::asmb) and
+ *  forwards the entries of the coupled unknowns directly to the global solver,
+ *  which therefore has only the size \f$ N \f$ of the coupled unknowns.
+ *  It relies on a numbering as given by base::dof::numberDoFsInteriorLast,
+ *  i.e., indices \f$ \geq N \f$ are interior and every element's interior
+ *  indices form a contiguous range. As for the pre-structured solver, the
+ *  coupling of the element blocks is given once by registerFields(), such
+ *  that the blocks have fixed sizes during the assembly. All matrix and RHS
+ *  contributions have to be inserted before finishAssembly(), which performs
+ *  the condensation.
+ *  Every entry of an element block stems from this element only, such that
+ *  the blocks are filled without synchronisation also by a threaded
+ *  assembly; the coupled entries are inserted concurrently into the global
+ *  solver, which registerFields() has pre-structured. After recover(), the object serves as
+ *  source of the values for base::dof::setDoFsFromSolver.
+ *
+ *  \tparam SOLVER  Type of global solver, e.g. base::solver::Eigen3
+ */
+template<typename SOLVER>
+class base::solver::StaticCondensation
+{
+public:
+    //! Template parameter: global solver
+    typedef SOLVER Solver;
+
+    /** Constructor
+     *  \param[in] solver     Global solver of size numCoupled
+     *  \param[in] numCoupled Number \f$ N \f$ of coupled unknowns
+     *  \param[in] interior   Element number of every interior index
+     */
+    StaticCondensation( Solver& solver,
+                        const std::size_t numCoupled,
+                        const std::vector<std::size_t>& interior )
+        : solver_( solver ), numCoupled_( numCoupled )
+    {
+        VERIFY_MSG( solver.size() == numCoupled,
+                    "Solver size does not match the number of coupled DoFs" );
+
+        // map from interior index to element block
+        blockOf_.resize( interior.size() );
+        for ( std::size_t k = 0; k < interior.size(); k++ ) {
+            if ( (k == 0) or (interior[k] != interior[k-1]) ) {
+                detail_::CondensedElement block;
+                block.first = numCoupled + k;
+                block.num   = 0;
+                elements_.push_back( block );
+            }
+            VERIFY_MSG( (k == 0) or (interior[k] >= interior[k-1]),
+                        "Interior indices are not numbered element-wise" );
+            elements_.back().num++;
+            blockOf_[k] = elements_.size() - 1;
+        }
+
+        this -> clear();
+    }
+
+    //--------------------------------------------------------------------------
+    /** Register the coupled indices of the element blocks.
+     *  Every interior index of an element tuple couples to all effective
+     *  (active and constraining) indices of the other space. Has to be
+     *  called for every field tuple binder used in the assembly. The
+     *  entries of the coupled unknowns and the element Schur complements are
+     *  registered with the global solver, which is thereby pre-structured.
+     *  \tparam FIELDTUPLEBINDER Binder of test and trial fields
+     *  \tparam FIELDBINDER      Binder of mesh and fields
+     */
+    template<typename FIELDTUPLEBINDER, typename FIELDBINDER>
+    void registerFields( const FIELDBINDER& fieldBinder )
+    {
+        std::set<std::pair<std::size_t,std::size_t> > pattern;
+
+        typename FIELDBINDER::FieldIterator iter = fieldBinder.elementsBegin();
+        typename FIELDBINDER::FieldIterator end  = fieldBinder.elementsEnd();
+        for ( ; iter != end; ++iter ) {
+
+            std::vector<std::size_t> rowIDs, colIDs;
+            if ( not base::solver::detail_::effectiveDoFIDs(
+                     FIELDTUPLEBINDER::makeTuple( *iter ), rowIDs, colIDs ) )
+                continue;
+
+            this -> addCoupling_( rowIDs, colIDs );
+            this -> addCoupling_( colIDs, rowIDs );
+
+            // direct entries of the coupled unknowns
+            for ( std::size_t i = 0; i < rowIDs.size(); i++ )
+                for ( std::size_t j = 0; j < colIDs.size(); j++ )
+                    if ( (rowIDs[i] < numCoupled_) and (colIDs[j] < numCoupled_) )
+                        pattern.insert( std::make_pair( rowIDs[i], colIDs[j] ) );
+        }
+
+        // entries of the Schur complements
+        for ( std::size_t e = 0; e < elements_.size(); e++ ) {
+            const std::vector<std::size_t>& coupled = elements_[e].coupled;
+            for ( std::size_t i = 0; i < coupled.size(); i++ )
+                for ( std::size_t j = 0; j < coupled.size(); j++ )
+                    pattern.insert( std::make_pair( coupled[i], coupled[j] ) );
+        }
+
+        solver_.registerIndexPairs( pattern.begin(), pattern.end() );
+        this -> clear();
+    }
+
+    //--------------------------------------------------------------------------
+    //! Distribute the matrix entries to the global system and element blocks
+    template<typename MATRIX, typename RDOFS, typename CDOFS>
+    void insertToLHS( const MATRIX & matrix,
+                      const RDOFS  & rowDoFs,
+                      const CDOFS  & colDoFs )
+    {
+        const std::size_t numRowDoFs = rowDoFs.size();
+        const std::size_t numColDoFs = colDoFs.size();
+
+        // entries of the coupled unknowns go directly to the solver
+        std::vector<std::size_t> rowPos, colPos, rowIDs, colIDs;
+        for ( std::size_t i = 0; i < numRowDoFs; i++ )
+            if ( rowDoFs[i] < numCoupled_ ) {
+                rowPos.push_back( i ); rowIDs.push_back( rowDoFs[i] );
+            }
+        for ( std::size_t j = 0; j < numColDoFs; j++ )
+            if ( colDoFs[j] < numCoupled_ ) {
+                colPos.push_back( j ); colIDs.push_back( colDoFs[j] );
+            }
+
+        if ( (rowPos.size() > 0) and (colPos.size() > 0) ) {
+            base::MatrixD subMatrix( rowPos.size(), colPos.size() );
+            for ( std::size_t i = 0; i < rowPos.size(); i++ )
+                for ( std::size_t j = 0; j < colPos.size(); j++ )
+                    subMatrix( i, j ) = matrix( rowPos[i], colPos[j] );
+            solver_.insertToLHS( subMatrix, rowIDs, colIDs );
+        }
+
+        // entries with interior unknowns go to the element blocks
+        for ( std::size_t i = 0; i < numRowDoFs; i++ ) {
+            const std::size_t rowIndex = rowDoFs[i];
+            for ( std::size_t j = 0; j < numColDoFs; j++ ) {
+                const std::size_t colIndex = colDoFs[j];
+                const double value = matrix( i, j );
+
+                if ( rowIndex >= numCoupled_ ) {
+                    detail_::CondensedElement& block = this -> block_( rowIndex );
+                    const std::size_t r = rowIndex - block.first;
+
+                    if ( colIndex >= numCoupled_ ) {
+                        VERIFY_MSG( &(this -> block_( colIndex )) == &block,
+                                    "Interior DoFs of different elements coupled" );
+                        block.Kii( r, colIndex - block.first ) += value;
+                    }
+                    else
+                        block.Kic( r, block.coupledIndex( colIndex ) ) += value;
+                }
+                else if ( colIndex >= numCoupled_ ) {
+                    detail_::CondensedElement& block = this -> block_( colIndex );
+                    block.Kci( block.coupledIndex( rowIndex ),
+                               colIndex - block.first ) += value;
+                }
+            }
+        }
+        return;
+    }
+
+    //--------------------------------------------------------------------------
+    //! Distribute the vector entries to the global system and element blocks
+    template<typename VECTOR, typename DOFS>
+    void insertToRHS( const VECTOR & vector,
+                      const DOFS   & dofs )
+    {
+        std::vector<std::size_t> pos, ids;
+        for ( std::size_t i = 0; i < dofs.size(); i++ ) {
+            const std::size_t index = dofs[i];
+            if ( index < numCoupled_ ) {
+                pos.push_back( i ); ids.push_back( index );
+            }
+            else {
+                detail_::CondensedElement& block = this -> block_( index );
+                block.fi[ index - block.first ] += vector[i];
+            }
+        }
+
+        if ( pos.size() > 0 ) {
+            base::VectorD subVector( pos.size() );
+            for ( std::size_t i = 0; i < pos.size(); i++ )
+                subVector[i] = vector[ pos[i] ];
+            solver_.insertToRHS( subVector, ids );
+        }
+        return;
+    }
+
+    //--------------------------------------------------------------------------
+    /** Condense the element blocks into the global system.
+     *  \param[in] destroyTriplet Passed to the global solver's finishAssembly
+     */
+    void finishAssembly( const bool destroyTriplet = true )
+    {
+        for ( std::size_t e = 0; e < elements_.size(); e++ ) {
+            detail_::CondensedElement& block = elements_[e];
+
+            // local factorisation of the interior block
+            const Eigen::FullPivLU<base::MatrixD> lu( block.Kii );
+            VERIFY_MSG( lu.isInvertible(),
+                        "Singular interior block of element block " +
+                        x2s( e ) );
+            block.X = lu.solve( block.Kic );
+            block.y = lu.solve( block.fi );
+
+            if ( block.coupled.empty() ) continue;
+
+            // Schur complement and condensed RHS
+            const base::MatrixD schur = -block.Kci * block.X;
+            const base::VectorD rhs   = -block.Kci * block.y;
+            solver_.insertToLHS( schur, block.coupled, block.coupled );
+            solver_.insertToRHS( rhs,   block.coupled );
+        }
+
+        solver_.finishAssembly( destroyTriplet );
+        return;
+    }
+
+    //--------------------------------------------------------------------------
+    //! Compute the interior unknowns from the solution of the global solver
+    void recover()
+    {
+        interiorValues_.resize( blockOf_.size() );
+
+        for ( std::size_t e = 0; e < elements_.size(); e++ ) {
+            const detail_::CondensedElement& block = elements_[e];
+
+            base::VectorD uc( block.coupled.size() );
+            for ( std::size_t c = 0; c < block.coupled.size(); c++ )
+                uc[c] = solver_.getValue( block.coupled[c] );
+
+            const base::VectorD ui = block.y - block.X * uc;
+            for ( std::size_t i = 0; i < block.num; i++ )
+                interiorValues_[ block.first - numCoupled_ + i ] = ui[i];
+        }
+        return;
+    }
+
+    //--------------------------------------------------------------------------
+    //! Reset all element blocks for a new assembly, keeping their structure
+    void clear()
+    {
+        for ( std::size_t e = 0; e < elements_.size(); e++ ) {
+            detail_::CondensedElement& block = elements_[e];
+            const int n = static_cast<int>( block.num );
+            const int m = static_cast<int>( block.coupled.size() );
+            block.Kii = base::MatrixD::Zero( n, n );
+            block.Kic = base::MatrixD::Zero( n, m );
+            block.Kci = base::MatrixD::Zero( m, n );
+            block.fi  = base::VectorD::Zero( n );
+        }
+        return;
+    }
+
+    //--------------------------------------------------------------------------
+    //! Value of the solution, coupled or interior (after recover())
+    number getValue( const std::size_t index ) const
+    {
+        if ( index < numCoupled_ ) return solver_.getValue( index );
+        return interiorValues_[ index - numCoupled_ ];
+    }
+
+    //! Total number of unknowns, coupled and interior
+    std::size_t size() const { return numCoupled_ + blockOf_.size(); }
+
+    //! Number of coupled unknowns, i.e. the size of the global system
+    std::size_t numCoupled() const { return numCoupled_; }
+
+    //! Access to the global solver
+    Solver& solver() { return solver_; }
+
+private:
+    //! Let the interior indices of one side couple to the others' indices
+    void addCoupling_( const std::vector<std::size_t>& interiorIDs,
+                       const std::vector<std::size_t>& otherIDs )
+    {
+        std::vector<std::size_t> coupled;
+        for ( std::size_t j = 0; j < otherIDs.size(); j++ )
+            if ( otherIDs[j] < numCoupled_ ) coupled.push_back( otherIDs[j] );
+
+        for ( std::size_t i = 0; i < interiorIDs.size(); i++ )
+            if ( interiorIDs[i] >= numCoupled_ )
+                this -> block_( interiorIDs[i] ).addCoupled( coupled );
+    }
+
+    //! Element block of an interior index
+    detail_::CondensedElement& block_( const std::size_t index )
+    {
+        VERIFY_MSG( index < this -> size(),
+                    "Index out of bound: " + x2s( index ) );
+        return elements_[ blockOf_[ index - numCoupled_ ] ];
+    }
+
+private:
+    Solver&                                 solver_;     //!< Global solver
+    const std::size_t                       numCoupled_; //!< Size of global system
+    std::vector<std::size_t>                blockOf_;    //!< Interior index to block
+    std::vector<detail_::CondensedElement>  elements_;   //!< Element blocks
+    std::vector<number>                     interiorValues_; //!< Recovered values
+};
+
+#endif
@@ -0,0 +1,444 @@
+//------------------------------------------------------------------------------
+// <preamble>
+// </preamble>
+//------------------------------------------------------------------------------
+
+//! @file   SubdomainContainer.hpp
+//! @author agent
+//! @date   2026
+
+#ifndef base_solver_subdomaincontainer_hpp
+#define base_solver_subdomaincontainer_hpp
+
+// std includes
+#include <vector>
+#include <algorithm>
+#include <utility>
+// boost includes
+#include <boost/utility.hpp>
+// Eigen includes
+#include <Eigen/Sparse>
+// base includes
+#include <base/verify.hpp>
+#include <base/numbers.hpp>
+#include <base/auxi/parallel.hpp>
+// base/solver includes
+#include <base/solver/TripletContainer.hpp>
+
+//------------------------------------------------------------------------------
+namespace base{
+    namespace solver{
+
+        class SubdomainContainer;
+
+        namespace detail_{
+
+            class SubdomainBlock;
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+/** Compressed row storage of the matrix entries of one subdomain.
+ *  Only the rows touched by the elements of the subdomain are stored, their
+ *  global numbers are kept in a sorted array. The block is built and
+ *  written to by one thread only, hence no synchronisation is needed.
+ */
+class base::solver::detail_::SubdomainBlock
+{
+public:
+    typedef int                       Index;
+    typedef std::pair<Index,Index>    Entry;
+
+    //--------------------------------------------------------------------------
+    /** Build the storage from the non-zero pattern.
+     *  \param[in,out] entries  Unsorted (row,col) pairs, emptied on exit
+     */
+    void build( std::vector<Entry>& entries )
+    {
+        // previously registered entries are kept
+        for ( std::size_t r = 0; r < rows_.size(); r++ )
+            for ( Index k = rowPtr_[r]; k < rowPtr_[r+1]; k++ )
+                entries.push_back( Entry( rows_[r], cols_[k] ) );
+
+        std::sort( entries.begin(), entries.end() );
+        entries.erase( std::unique( entries.begin(), entries.end() ),
+                       entries.end() );
+
+        rows_.clear();
+        rowPtr_.clear();
+        cols_.resize( entries.size() );
+
+        for ( std::size_t e = 0; e < entries.size(); e++ ) {
+            if ( rows_.empty() or ( rows_.back() != entries[e].first ) ) {
+                rows_.push_back(   entries[e].first );
+                rowPtr_.push_back( static_cast<Index>( e ) );
+            }
+            cols_[e] = entries[e].second;
+        }
+        rowPtr_.push_back( static_cast<Index>( entries.size() ) );
+
+        // values are allocated (first touched) by the calling thread
+        values_.assign( entries.size(), 0. );
+        std::vector<Entry>().swap( entries );
+    }
+
+    //--------------------------------------------------------------------------
+    /** Add a value to the entry (i,j).
+     *  \return False if the entry is not part of this block
+     */
+    bool add( const Index i, const Index j, const number value )
+    {
+        std::vector<Index>::iterator rIter =
+            std::lower_bound( rows_.begin(), rows_.end(), i );
+        if ( ( rIter == rows_.end() ) or ( *rIter != i ) ) return false;
+
+        const std::size_t r = std::distance( rows_.begin(), rIter );
+        std::vector<Index>::iterator first = cols_.begin() + rowPtr_[r  ];
+        std::vector<Index>::iterator last  = cols_.begin() + rowPtr_[r+1];
+        std::vector<Index>::iterator cIter =
+            std::lower_bound( first, last, j );
+        if ( ( cIter == last ) or ( *cIter != j ) ) return false;
+
+        values_[ std::distance( cols_.begin(), cIter ) ] += value;
+        return true;
+    }
+
+    //--------------------------------------------------------------------------
+    //! @name Access to the compressed rows
+    //@{
+    std::size_t numRows()                  const { return rows_.size(); }
+    Index       row( const std::size_t r ) const { return rows_[r]; }
+    Index       rowBegin( const std::size_t r ) const { return rowPtr_[r];   }
+    Index       rowEnd(   const std::size_t r ) const { return rowPtr_[r+1]; }
+    Index       col(   const Index k ) const { return cols_[k];   }
+    number      value( const Index k ) const { return values_[k]; }
+    //@}
+
+    //! Reset values, keep pattern
+    void clearValues() { std::fill( values_.begin(), values_.end(), 0. ); }
+
+    //! Free all storage
+    void destroy()
+    {
+        std::vector<Index>().swap( rows_ );
+        std::vector<Index>().swap( rowPtr_ );
+        std::vector<Index>().swap( cols_ );
+        std::vector<number>().swap( values_ );
+    }
+
+private:
+    std::vector<Index>  rows_;   //!< Sorted global row numbers
+    std::vector<Index>  rowPtr_; //!< Begin of a row in cols_ and values_
+    std::vector<Index>  cols_;   //!< Sorted column numbers per row
+    std::vector<number> values_; //!< Matrix entries
+};
+
+//------------------------------------------------------------------------------
+/** Thread-private assembly storage as an alternative to TripletContainer.
+ *  During registerFields, every element is assigned to the thread which
+ *  visits it in the statically scheduled element loop of
+ *  base::auxi::applyToAllFieldTuple. The elements of one thread form its
+ *  subdomain and the matrix rows touched by them are stored in a
+ *  thread-private compressed block (detail_::SubdomainBlock). Since the
+ *  block is allocated by its thread, its memory is local to the thread's
+ *  socket on NUMA machines.
+ *
+ *  Later assembly loops over the same field binder let each thread add to its
+ *  own block without atomic operations. In assemble(), the rows which are
+ *  only held by one subdomain are copied and the interface rows, which
+ *  appear in several blocks, are merged. Both operations run in parallel
+ *  over the rows of the system.
+ *
+ *  Note that the subdomains follow the element numbering of the mesh, a
+ *  bandwidth reducing numbering yields compact subdomains with few
+ *  interface rows. Unlike TripletContainer, there is no dynamic mode and
+ *  all fields have to be registered.
+ */
+class base::solver::SubdomainContainer : boost::noncopyable
+{
+public:
+    typedef detail_::SubdomainBlock Block;
+    typedef Block::Index            Index;
+    typedef Block::Entry            Entry;
+
+    //--------------------------------------------------------------------------
+    /** Registering of active DoF IDs for test and trial fields.
+     *  Each thread collects the non-zero pattern of its elements and builds
+     *  its block. Repeated calls extend the pattern of the blocks.
+     *  \tparam FIELDTUPLEBINDER Type to determine which is test and trial field
+     *  \tparam FIELDBINDER      Type of mesh and field binder
+     *  \param[in] fieldBinder Binder of mesh and fields
+     */
+    template<typename FIELDTUPLEBINDER, typename FIELDBINDER>
+    void registerFields( const FIELDBINDER& fieldBinder )
+    {
+        VERIFY_MSG( not base::auxi::inParallelRegion(),
+                    "Registering has to be called outside a parallel region" );
+
+        const std::size_t numThreads =
+            static_cast<std::size_t>( base::auxi::setNumThreads() );
+        if ( blocks_.size() < numThreads ) blocks_.resize( numThreads );
+
+        // collect the pattern per thread
+        std::vector< std::vector<Entry> > entries( blocks_.size() );
+        Register_<FIELDTUPLEBINDER> registerOp( entries );
+        base::auxi::applyToAllFieldTuple<FIELDTUPLEBINDER>( fieldBinder,
+                                                            registerOp );
+
+        // every thread builds its block
+        Build_ buildOp( blocks_, entries );
+        base::auxi::applyToAllIndices( blocks_.size(), buildOp );
+    }
+
+    //--------------------------------------------------------------------------
+    /** Insert a value at given row and column position.
+     *  In a parallel region, the value has to belong to the block of the
+     *  calling thread, i.e. the current element loop has to be registered.
+     *  Outside, any block holding the entry is used.
+     */
+    void insert( const unsigned i, const unsigned j, const base::number value )
+    {
+        const Index row = static_cast<Index>( i );
+        const Index col = static_cast<Index>( j );
+
+        const std::size_t t = static_cast<std::size_t>( base::auxi::threadNum() );
+        if ( ( t < blocks_.size() ) and blocks_[t].add( row, col, value ) )
+            return;
+
+        VERIFY_MSG( not base::auxi::inParallelRegion(),
+                    "Entry is not in the subdomain of the calling thread" );
+
+        for ( std::size_t b = 0; b < blocks_.size(); b++ )
+            if ( blocks_[b].add( row, col, value ) ) return;
+
+        VERIFY_MSG( false, "SubdomainContainer had not been properly set up" );
+    }
+
+    //--------------------------------------------------------------------------
+    /** Merge the blocks into a sparse matrix.
+     *  The compressed rows of the result are counted and filled in parallel,
+     *  the interface rows are the sum of the rows of their blocks.
+     *  \param[out] matrix  Sparse matrix, its size is kept
+     */
+    template<typename MATRIX>
+    void assemble( MATRIX& matrix ) const
+    {
+        const std::size_t numRows = static_cast<std::size_t>( matrix.rows() );
+
+        // for every global row, the blocks and their local rows
+        std::vector<Index> rowBlocksPtr( numRows + 1, 0 );
+        for ( std::size_t b = 0; b < blocks_.size(); b++ )
+            for ( std::size_t r = 0; r < blocks_[b].numRows(); r++ )
+                rowBlocksPtr[ blocks_[b].row( r ) + 1 ]++;
+        for ( std::size_t r = 0; r < numRows; r++ )
+            rowBlocksPtr[r+1] += rowBlocksPtr[r];
+
+        std::vector<Entry> rowBlocks( rowBlocksPtr.back() );
+        {
+            std::vector<Index> fill( rowBlocksPtr.begin(), rowBlocksPtr.end()-1 );
+            for ( std::size_t b = 0; b < blocks_.size(); b++ )
+                for ( std::size_t r = 0; r < blocks_[b].numRows(); r++ )
+                    rowBlocks[ fill[ blocks_[b].row( r ) ]++ ] =
+                        Entry( static_cast<Index>( b ), static_cast<Index>( r ) );
+        }
+
+        // number of entries per row
+        std::vector<Index> rowPtr( numRows + 1, 0 );
+        std::vector<Index> cols;
+        std::vector<number> values;
+        {
+            Merge_ countOp( blocks_, rowBlocksPtr, rowBlocks, rowPtr, cols, values );
+            base::auxi::applyToAllIndices( numRows, countOp );
+        }
+
+        // offsets
+        for ( std::size_t r = 0; r < numRows; r++ )
+            rowPtr[r+1] += rowPtr[r];
+
+        // fill the rows
+        cols.resize(   rowPtr.back() );
+        values.resize( rowPtr.back() );
+        {
+            Merge_ fillOp( blocks_, rowBlocksPtr, rowBlocks, rowPtr, cols, values );
+            base::auxi::applyToAllIndices( numRows, fillOp );
+        }
+
+        // convert from row-wise storage
+        typedef Eigen::SparseMatrix<number,Eigen::RowMajor,Index> RowMatrix;
+        const Eigen::Map<const RowMatrix>
+            rowMatrix( matrix.rows(), matrix.cols(), rowPtr.back(),
+                       &rowPtr[0], cols.empty() ? 0 : &cols[0],
+                       values.empty() ? 0 : &values[0] );
+        matrix = rowMatrix;
+    }
+
+    //--------------------------------------------------------------------------
+    //! Set all values to zero but keep the pattern
+    void clearValues()
+    {
+        ClearValues_ clearOp( blocks_ );
+        base::auxi::applyToAllIndices( blocks_.size(), clearOp );
+    }
+
+    //! Flag if a non-zero pattern has been registered
+    bool isPreStructured() const { return not blocks_.empty(); }
+
+    //! Free all blocks
+    void destroy() { std::vector<Block>().swap( blocks_ ); }
+
+private:
+    //--------------------------------------------------------------------------
+    //! Collect the pattern of an element in the storage of the calling thread
+    template<typename FIELDTUPLEBINDER>
+    class Register_
+    {
+    public:
+        Register_( std::vector< std::vector<Entry> >& entries )
+            : entries_( entries ) { }
+
+        void operator()( const typename FIELDTUPLEBINDER::Tuple& tuple )
+        {
+            std::vector<std::size_t> effRowDoFIDs, effColDoFIDs;
+            if ( not detail_::effectiveDoFIDs( tuple, effRowDoFIDs,
+                                               effColDoFIDs ) ) return;
+
+            std::vector<Entry>& entries = entries_[ base::auxi::threadNum() ];
+            for ( std::size_t r = 0; r < effRowDoFIDs.size(); r++ )
+                for ( std::size_t c = 0; c < effColDoFIDs.size(); c++ )
+                    entries.push_back( Entry( static_cast<Index>( effRowDoFIDs[r] ),
+                                              static_cast<Index>( effColDoFIDs[c] ) ) );
+        }
+
+    private:
+        std::vector< std::vector<Entry> >& entries_;
+    };
+
+    //--------------------------------------------------------------------------
+    //! Build every block by its own thread
+    class Build_
+    {
+    public:
+        Build_( std::vector<Block>& blocks,
+                std::vector< std::vector<Entry> >& entries )
+            : blocks_( blocks ), entries_( entries ) { }
+
+        void operator()( const std::size_t b )
+        {
+            blocks_[b].build( entries_[b] );
+        }
+
+    private:
+        std::vector<Block>&                blocks_;
+        std::vector< std::vector<Entry> >& entries_;
+    };
+
+    //--------------------------------------------------------------------------
+    //! Reset the values of a block
+    class ClearValues_
+    {
+    public:
+        ClearValues_( std::vector<Block>& blocks ) : blocks_( blocks ) { }
+
+        void operator()( const std::size_t b ) { blocks_[b].clearValues(); }
+
+    private:
+        std::vector<Block>& blocks_;
+    };
+
+    //--------------------------------------------------------------------------
+    /** Merge the rows of the blocks into one global row.
+     *  If the column storage is empty, only the number of entries of the row
+     *  is computed (stored at position row+1), otherwise the row is filled.
+     */
+    class Merge_
+    {
+    public:
+        Merge_( const std::vector<Block>&  blocks,
+                const std::vector<Index>&  rowBlocksPtr,
+                const std::vector<Entry>&  rowBlocks,
+                std::vector<Index>&        rowPtr,
+                std::vector<Index>&        cols,
+                std::vector<number>&       values )
+            : blocks_( blocks ), rowBlocksPtr_( rowBlocksPtr ),
+              rowBlocks_( rowBlocks ), rowPtr_( rowPtr ),
+              cols_( cols ), values_( values ) { }
+
+        void operator()( const std::size_t r )
+        {
+            const bool count = cols_.empty();
+            const Index first = rowBlocksPtr_[r];
+            const Index last  = rowBlocksPtr_[r+1];
+            if ( first == last ) return;
+
+            // row of a single subdomain: copy
+            if ( last - first == 1 ) {
+                const Block& block = blocks_[ rowBlocks_[first].first ];
+                const std::size_t lr = rowBlocks_[first].second;
+                if ( count ) {
+                    rowPtr_[r+1] = block.rowEnd( lr ) - block.rowBegin( lr );
+                    return;
+                }
+                Index pos = rowPtr_[r];
+                for ( Index k = block.rowBegin( lr ); k < block.rowEnd( lr ); k++ ) {
+                    cols_[  pos] = block.col(   k );
+                    values_[pos] = block.value( k );
+                    pos++;
+                }
+                return;
+            }
+
+            // interface row: sort the entries of all blocks and sum up
+            std::vector< std::pair<Index,number> > entries;
+            for ( Index b = first; b < last; b++ ) {
+                const Block& block = blocks_[ rowBlocks_[b].first ];
+                const std::size_t lr = rowBlocks_[b].second;
+                for ( Index k = block.rowBegin( lr ); k < block.rowEnd( lr ); k++ )
+                    entries.push_back( std::make_pair( block.col( k ),
+                                                       block.value( k ) ) );
+            }
+            std::stable_sort( entries.begin(), entries.end(), LessCol_() );
+
+            Index pos = rowPtr_[r] - 1;
+            Index numEntries = 0;
+            for ( std::size_t e = 0; e < entries.size(); e++ ) {
+                const bool isNew = ( e == 0 ) or
+                    ( entries[e].first != entries[e-1].first );
+                if ( count ) {
+                    if ( isNew ) numEntries++;
+                    continue;
+                }
+                if ( isNew ) {
+                    pos++;
+                    cols_[  pos] = entries[e].first;
+                    values_[pos] = 0.;
+                }
+                values_[pos] += entries[e].second;
+            }
+            if ( count ) rowPtr_[r+1] = numEntries;
+        }
+
+    private:
+        //! Comparison of the column only, the summation order is deterministic
+        struct LessCol_
+        {
+            bool operator()( const std::pair<Index,number>& a,
+                             const std::pair<Index,number>& b ) const
+            {
+                return a.first < b.first;
+            }
+        };
+
+        const std::vector<Block>&  blocks_;
+        const std::vector<Index>&  rowBlocksPtr_;
+        const std::vector<Entry>&  rowBlocks_;
+        std::vector<Index>&        rowPtr_;
+        std::vector<Index>&        cols_;
+        std::vector<number>&       values_;
+    };
+
+private:
+    std::vector<Block> blocks_; //!< Thread-private storage
+};
+
+#endif
@@ -51,6 +51,96 @@ namespace base{
         }
 
         class TripletContainer;
+
+        namespace detail_{
+
+            //------------------------------------------------------------------
+            /** Collect the system rows and columns of an element's entries.
+             *  These are the IDs of the ACTIVE DoF components and the IDs of
+             *  the masters of the CONSTRAINED ones.
+             *  \tparam TUPLE  Tuple of field element pointers
+             *  \param[in]  tuple         Test and trial elements
+             *  \param[out] effRowDoFIDs  Row IDs
+             *  \param[out] effColDoFIDs  Column IDs
+             *  \return     False if the element has no entries
+             */
+            template<typename TUPLE>
+            bool effectiveDoFIDs( const TUPLE& tuple,
+                                  std::vector<std::size_t>& effRowDoFIDs,
+                                  std::vector<std::size_t>& effColDoFIDs )
+            {
+                typedef typename TUPLE::TestElement      TestElement;
+                typedef typename TUPLE::TrialElement     TrialElement;
+
+                // extract test and trial elements from tuple
+                TestElement*  testEp  = tuple.testElementPtr();
+                TrialElement* trialEp = tuple.trialElementPtr();
+
+                // if pointers are identical, Galerkin-Bubnov scheme
+                const bool isBubnov =
+                    base::auxi::EqualPointers<TestElement,
+                                              TrialElement>::apply( testEp,
+                                                                    trialEp );
+
+                // dof statuses, IDs, values (placeholder) and constraints
+                std::vector<base::dof::DoFStatus> rowDoFStatus, colDoFStatus;
+                std::vector<std::size_t> rowDoFIDs, colDoFIDs;
+                std::vector<base::number> rowDoFValues, colDoFValues;
+                base::asmb::ElementConstraints rowConstraints, colConstraints;
+
+                // Collect dof entities from element
+                bool doSomething = 
+                    base::asmb::collectFromDoFs( testEp, rowDoFStatus,
+                                                 rowDoFIDs, rowDoFValues,
+                                                 rowConstraints,
+                                                 false );
+
+                // if no row dof is ACTIVE or CONSTRAINED, nothing to do
+                if ( not doSomething ) return false;
+
+                // In case of identical test and trial spaces, just copy
+                if ( isBubnov ) {
+                    colDoFStatus   = rowDoFStatus;
+                    colDoFIDs      = rowDoFIDs;
+                }
+                else // otherwise, collect for trial space
+                    doSomething = 
+                        base::asmb::collectFromDoFs( trialEp, colDoFStatus,
+                                                     colDoFIDs, colDoFValues,
+                                                     colConstraints,
+                                                     false );
+
+                // if no col dof is ACTIVE or CONSTRAINED, nothing to do
+                if ( not doSomething ) return false;
+
+                // collect active row dof IDs from this element
+                effRowDoFIDs.clear();
+                for ( unsigned r = 0; r < rowDoFIDs.size(); r++ )
+                    if ( rowDoFStatus[r] == base::dof::ACTIVE )
+                        effRowDoFIDs.push_back( rowDoFIDs[r] );
+
+                // collect master dof IDs from linear constraints
+                effRowDoFIDs.insert( effRowDoFIDs.end(),
+                                     rowConstraints.ids().begin(),
+                                     rowConstraints.ids().end() );
+
+                // if test- and trial-spaces are equal, just copy the IDs
+                if ( isBubnov ) effColDoFIDs = effRowDoFIDs;
+                // otherwise, do the same for the column (i.e trial) space
+                else {
+                    effColDoFIDs.clear();
+                    for ( unsigned c = 0; c < colDoFIDs.size(); c++ )
+                        if ( colDoFStatus[c] == base::dof::ACTIVE )
+                            effColDoFIDs.push_back( colDoFIDs[c] );
+
+                    effColDoFIDs.insert( effColDoFIDs.end(),
+                                         colConstraints.ids().begin(),
+                                         colConstraints.ids().end() );
+                }
+
+                return true;
+            }
+        }
     }
 }
 
@@ -158,104 +248,19 @@ public:
     template<typename FIELDTUPLEBINDER, typename FIELDBINDER>
     void registerFields( const FIELDBINDER& fieldBinder )
     {
-        // Convenience typedefs
-        typedef typename FIELDTUPLEBINDER::Tuple Tuple;
-        typedef typename Tuple::TestElement      TestElement;
-        typedef typename Tuple::TrialElement     TrialElement;
-
-        // flag for symmetry
-        bool isBubnov = false;
-        
         // Go through all elements
         typename FIELDBINDER::FieldIterator iter = fieldBinder.elementsBegin();
         typename FIELDBINDER::FieldIterator end  = fieldBinder.elementsEnd();
-        for ( std::size_t i = 0; iter != end; ++iter, i++ ) {
-            
-            // make the tuple of field element pointers
-            Tuple tuple = FIELDTUPLEBINDER::makeTuple( *iter );
-
-            // extract test and trial elements from tuple
-            TestElement*  testEp  = tuple.testElementPtr();
-            TrialElement* trialEp = tuple.trialElementPtr();
-
-            // if pointers are identical, Galerkin-Bubnov scheme (check only once)
-            if ( i == 0 ) isBubnov =
-                              base::auxi::EqualPointers<TestElement,
-                                                        TrialElement>::apply( testEp,
-                                                                              trialEp );
-
-            // dof statuses 
-            std::vector<base::dof::DoFStatus> rowDoFStatus, colDoFStatus;
-
-            // dof IDs 
-            std::vector<std::size_t> rowDoFIDs, colDoFIDs;
-
-            // dof values (just placeholder)
-            std::vector<base::number> rowDoFValues, colDoFValues;
-
-            // dof constraints 
-            typedef std::pair<unsigned, std::vector< std::pair<base::number,std::size_t> > >
-                WeightedDoFIDs;
-            std::vector<WeightedDoFIDs> rowConstraints, colConstraints;
-
-            // Collect dof entities from element
-            bool doSomething = 
-                base::asmb::collectFromDoFs( testEp, rowDoFStatus,
-                                             rowDoFIDs, rowDoFValues,
-                                             rowConstraints,
-                                             false );
-
-            // if no row dof is ACTIVE or CONSTRAINED, go to next element
-            if ( not doSomething ) continue;
+        for ( ; iter != end; ++iter ) {
             
-            // In case of identical test and trial spaces, just copy
-            if ( isBubnov ) {
-                colDoFStatus   = rowDoFStatus;
-                colDoFIDs      = rowDoFIDs;
-                colDoFValues   = rowDoFValues;
-                colConstraints = rowConstraints;
-            }
-            else // otherwise, collect for trial space
-                doSomething = 
-                    base::asmb::collectFromDoFs( trialEp, colDoFStatus,
-                                                 colDoFIDs, colDoFValues,
-                                                 colConstraints,
-                                                 false );
-
-            // if no col dof is ACTIVE or CONSTRAINED, go to next element
-            if ( not doSomething ) continue;
-
-
             // Collect all ID numbers (ACTIVE and CONSTRAINED)
             std::vector<std::size_t> effRowDoFIDs, effColDoFIDs;
-            {
-                // collect active row dof IDs from this element
-                for ( unsigned r = 0; r < rowDoFIDs.size(); r++ )
-                    if ( rowDoFStatus[r] == base::dof::ACTIVE )
-                        effRowDoFIDs.push_back( rowDoFIDs[r] );
+            const bool doSomething =
+                detail_::effectiveDoFIDs( FIELDTUPLEBINDER::makeTuple( *iter ),
+                                          effRowDoFIDs, effColDoFIDs );
 
-                // collect master dof IDs from linear constraints
-                for ( unsigned r = 0; r < rowConstraints.size(); r++ ) {
-                    for ( unsigned r2 = 0; r2 < (rowConstraints[r]).second.size(); r2++ ) {
-                        effRowDoFIDs.push_back( (rowConstraints[r].second[r2].second) );
-                    }
-                }
-
-                // if test- and trial-spaces are equal, just copy the IDs
-                if ( isBubnov ) effColDoFIDs = effRowDoFIDs;
-                // otherwise, do the same for the column (i.e trial) space
-                else {
-                    for ( unsigned c = 0; c < colDoFIDs.size(); c++ )
-                        if ( colDoFStatus[c] == base::dof::ACTIVE )
-                            effColDoFIDs.push_back( colDoFIDs[c] );
-
-                    for ( unsigned c = 0; c < colConstraints.size(); c++ ) {
-                        for ( unsigned c2 = 0; c2 < (colConstraints[c]).second.size(); c2++ ) {
-                            effColDoFIDs.push_back( (colConstraints[c].second[c2].second) );
-                        }
-                    }
-                }
-            }
+            // if no row or col dof is ACTIVE or CONSTRAINED, go to next element
+            if ( not doSomething ) continue;
 
             // go through all indices
             for ( std::size_t r = 0; r < effRowDoFIDs.size(); r++ ) {
@@ -271,32 +276,27 @@ public:
             
         } // for all element tuples
 
-        // append to vector of triplets
-        {
-            // size of existing storage
-            const std::size_t currentNum = triplets_.size();
-            // resize the storage
-            triplets_.resize( currentNum +
-                              std::distance( tmpTriplets_.begin(), tmpTriplets_.end() ) );
-
-            // iterator to the end of the existing storage
-            typename std::vector<Triplet>::iterator insertIter = triplets_.begin();
-            std::advance( insertIter, currentNum );
-
-            // copy from temporary storage into new storage
-            std::copy( tmpTriplets_.begin(), tmpTriplets_.end(), insertIter );
-
-            // destroy current storage
-            tmpTriplets_.clear();
+        this -> appendRegistered_();
+        return;
+    }
 
-            // if container was not empty, it needs to be sorted
-            if ( currentNum > 0 ) {
-                std::sort( triplets_.begin(), triplets_.end() );
-            }
+    //--------------------------------------------------------------------------
+    /** Registering of a given set of matrix positions.
+     *  Same as registerFields, but for callers which determine the non-zero
+     *  pattern themselves, e.g. base::solver::StaticCondensation.
+     *  \tparam PAIRITER Iterator over pairs of row and column index
+     *  \param[in] first, last  Range of the index pairs
+     */
+    template<typename PAIRITER>
+    void registerIndexPairs( PAIRITER first, PAIRITER last )
+    {
+        for ( ; first != last; ++first ) {
+            Triplet triplet( static_cast<typename Triplet::Index>( first -> first ),
+                             static_cast<typename Triplet::Index>( first -> second ), 0. );
+            tmpTriplets_.insert( triplet );
         }
 
-        // set flag that pre-structured version is used
-        preStructured_ = true;
+        this -> appendRegistered_();
         return;
     }
 
@@ -380,6 +380,22 @@ public:
         return triplets_.end();
     }
 
+    //--------------------------------------------------------------------------
+    /** Set all values to zero but keep the pre-determined non-zero pattern.
+     *  In the dynamic case, the storage is simply destroyed.
+     */
+    void clearValues()
+    {
+        if ( preStructured_ ) {
+            for ( std::size_t t = 0; t < triplets_.size(); t++ )
+                triplets_[t] = Triplet( triplets_[t].row(), triplets_[t].col(), 0. );
+        }
+        else this -> destroy();
+    }
+
+    //! Flag if a non-zero pattern has been registered
+    bool isPreStructured() const { return preStructured_; }
+
     //--------------------------------------------------------------------------
     //! Clear local storage
     void destroy()
@@ -399,6 +415,35 @@ public:
 
         return out;
     }
+
+private:
+    //! Append the registered triplets to the vector of triplets
+    void appendRegistered_()
+    {
+        // size of existing storage
+        const std::size_t currentNum = triplets_.size();
+        // resize the storage
+        triplets_.resize( currentNum +
+                          std::distance( tmpTriplets_.begin(), tmpTriplets_.end() ) );
+
+        // iterator to the end of the existing storage
+        std::vector<Triplet>::iterator insertIter = triplets_.begin();
+        std::advance( insertIter, currentNum );
+
+        // copy from temporary storage into new storage
+        std::copy( tmpTriplets_.begin(), tmpTriplets_.end(), insertIter );
+
+        // destroy current storage
+        tmpTriplets_.clear();
+
+        // if container was not empty, it needs to be sorted
+        if ( currentNum > 0 ) {
+            std::sort( triplets_.begin(), triplets_.end() );
+        }
+
+        // set flag that pre-structured version is used
+        preStructured_ = true;
+    }
     
 private:
     bool                 preStructured_; //!< Mode of storage
@@ -0,0 +1,198 @@
+#include <sstream>
+#include <vector>
+#include <cmath>
+#include <iterator>
+#include <boost/test/minimal.hpp>
+#include <boost/bind.hpp>
+
+#include <tools/meshGeneration/unitCube/unitCube.hpp>
+#include <base/Unstructured.hpp>
+#include <base/mesh/MeshBoundary.hpp>
+#include <base/io/smf/Reader.hpp>
+#include <base/Quadrature.hpp>
+#include <base/fe/Basis.hpp>
+#include <base/Field.hpp>
+#include <base/dof/numbering.hpp>
+#include <base/dof/generate.hpp>
+#include <base/dof/Distribute.hpp>
+#include <base/dof/constrainBoundary.hpp>
+#include <base/asmb/FieldBinder.hpp>
+#include <base/asmb/StiffnessMatrix.hpp>
+#include <base/asmb/BodyForce.hpp>
+#include <base/kernel/Mass.hpp>
+#include <base/solver/Eigen3.hpp>
+#include <base/solver/BlockSchur.hpp>
+
+#include <fluid/Stokes.hpp>
+
+//! \cond SKIPDOX
+// Stokes flow with Taylor-Hood elements in a driven cavity
+typedef base::Unstructured<base::QUAD,1>                Mesh;
+typedef base::Quadrature<3,base::QUAD>                  Quadrature;
+typedef base::fe::Basis<base::QUAD,2>                   FEBasisU;
+typedef base::fe::Basis<base::QUAD,1>                   FEBasisP;
+typedef base::Field<FEBasisU,2>                         Velocity;
+typedef base::Field<FEBasisP,1>                         Pressure;
+typedef base::asmb::FieldBinder<Mesh,Velocity,Pressure> FieldBinder;
+typedef FieldBinder::TupleBinder<1,1,1>::Type           TopLeft;
+typedef FieldBinder::TupleBinder<1,2>::Type             TopRight;
+typedef FieldBinder::TupleBinder<2,1>::Type             BotLeft;
+typedef FieldBinder::TupleBinder<2,2>::Type             BotRight;
+
+const double viscosity = 2.0;
+
+template<typename DOF>
+void lid( const base::Vector<2>::Type& x, DOF* doFPtr )
+{
+    const double value = ( std::abs( x[1] - 1. ) < 1.e-5 ) ?
+        x[0] * ( 1. - x[0] ) : 0.;
+    if ( doFPtr -> isActive( 0 ) ) doFPtr -> constrainValue( 0, value );
+    if ( doFPtr -> isActive( 1 ) ) doFPtr -> constrainValue( 1, 0.    );
+}
+
+base::Vector<2>::Type force( const base::Vector<2>::Type& x )
+{
+    base::Vector<2>::Type f;
+    f[0] = std::sin( 3. * x[1] );
+    f[1] = x[0] * x[0];
+    return f;
+}
+
+// Assemble the system into a solver
+template<typename SOLVER>
+void assemble( const Quadrature& quadrature, SOLVER& solver, FieldBinder& field )
+{
+    fluid::VectorLaplace<TopLeft::Tuple>       vecLaplace( viscosity );
+    fluid::PressureGradient<TopRight::Tuple>   gradP;
+    fluid::VelocityDivergence<BotLeft::Tuple>  divU;
+
+    base::asmb::stiffnessMatrixComputation<TopLeft>(  quadrature, solver, field, vecLaplace );
+    base::asmb::stiffnessMatrixComputation<TopRight>( quadrature, solver, field, gradP );
+    base::asmb::stiffnessMatrixComputation<BotLeft>(  quadrature, solver, field, divU );
+    base::asmb::bodyForceComputation<TopLeft>( quadrature, solver, field,
+                                               boost::bind( &force, _1 ) );
+}
+
+// Solve directly (type < 0) or with the Schur complement method
+std::vector<double> solve( const int type )
+{
+    Mesh mesh;
+    {
+        std::stringstream smf;
+        tools::meshGeneration::unitCube::SMF<2,false,1>::apply( 4, 3, 1, smf );
+        base::io::smf::readMesh( smf, mesh );
+    }
+    Quadrature quadrature;
+    Velocity velocity;
+    base::dof::generate<FEBasisU>( mesh, velocity );
+    Pressure pressure;
+    base::dof::generate<FEBasisP>( mesh, pressure );
+
+    base::mesh::MeshBoundary meshBoundary;
+    meshBoundary.create( mesh.elementsBegin(), mesh.elementsEnd() );
+    base::dof::constrainBoundary<FEBasisU>(
+        meshBoundary.begin(), meshBoundary.end(), mesh, velocity,
+        boost::bind( &lid<Velocity::DegreeOfFreedom>, _1, _2 ) );
+
+    // fix one pressure
+    Pressure::DoFPtrIter pIter = pressure.doFsBegin();
+    std::advance( pIter, std::distance( pressure.doFsBegin(), pressure.doFsEnd() )/2 );
+    (*pIter) -> constrainValue( 0, 0.0 );
+
+    const std::size_t numDoFsU =
+        base::dof::numberDoFsConsecutively( velocity.doFsBegin(), velocity.doFsEnd() );
+    const std::size_t numDoFsP =
+        base::dof::numberDoFsConsecutively( pressure.doFsBegin(), pressure.doFsEnd(),
+                                            numDoFsU );
+
+    FieldBinder field( mesh, velocity, pressure );
+
+    if ( type < 0 ) {
+        base::solver::Eigen3 solver( numDoFsU + numDoFsP );
+        solver.registerFields<TopLeft >( field );
+        solver.registerFields<TopRight>( field );
+        solver.registerFields<BotLeft >( field );
+        assemble( quadrature, solver, field );
+        solver.finishAssembly();
+        solver.luSolve();
+        base::dof::setDoFsFromSolver( solver, velocity );
+        base::dof::setDoFsFromSolver( solver, pressure );
+    }
+    else {
+        typedef base::solver::BlockSchur Solver;
+        const Solver::SchurType schurType =
+            ( type == 0 ) ? Solver::SIMPLE : Solver::ASSEMBLED;
+        Solver solver( numDoFsU, numDoFsP, schurType );
+        solver.registerFields<TopLeft >( field );
+        solver.registerFields<TopRight>( field );
+        solver.registerFields<BotLeft >( field );
+        solver.schurApproximation().registerFields<BotRight>( field );
+
+        double firstTrace = 0.;
+
+        // twice, in order to check the re-assembly into the registered patterns
+        for ( unsigned pass = 0; pass < 2; pass++ ) {
+            solver.clearLHS();
+            solver.clearRHS();
+            assemble( quadrature, solver, field );
+
+            // approximation of S by the pressure mass, changed in the 2nd pass
+            const double factor = ( pass == 0 ? -10. : -1. ) / viscosity;
+            if ( schurType == Solver::ASSEMBLED ) {
+                solver.schurApproximation().clearLHS();
+                base::kernel::Mass<BotRight::Tuple> mass( factor );
+                base::asmb::stiffnessMatrixComputation<BotRight>(
+                    quadrature, solver.schurApproximation(), field, mass );
+            }
+
+            solver.finishAssembly( false );
+
+            if ( schurType == Solver::ASSEMBLED ) {
+                // the re-assembled approximation has to be used
+                const Solver::SparseMatrix& S =
+                    solver.schurApproximation().matrix();
+                double trace = 0.;
+                for ( int i = 0; i < S.rows(); i++ ) trace += S.coeff( i, i );
+                BOOST_CHECK( trace < 0. );
+                if ( pass == 0 ) firstTrace = trace;
+                else BOOST_CHECK( std::abs( trace - 0.1 * firstTrace ) <
+                                  1.e-12 * std::abs( firstTrace ) );
+            }
+
+            solver.schurSolve( 1.e-12 );
+            BOOST_CHECK( solver.lastResidual() < 1.e-11 );
+        }
+
+        base::dof::setDoFsFromSolver( solver, velocity );
+        base::dof::setDoFsFromSolver( solver, pressure );
+    }
+
+    // values in the order of the DoF IDs
+    std::vector<double> values;
+    for ( Velocity::DoFPtrIter d = velocity.doFsBegin(); d != velocity.doFsEnd(); ++d )
+        for ( unsigned c = 0; c < 2; c++ ) values.push_back( (*d) -> getValue( c ) );
+    for ( Pressure::DoFPtrIter d = pressure.doFsBegin(); d != pressure.doFsEnd(); ++d )
+        values.push_back( (*d) -> getValue( 0 ) );
+    return values;
+}
+
+int test_main( int, char *[] )
+{
+    const std::vector<double> direct = solve( -1 );
+
+    for ( int type = 0; type < 2; type++ ) {
+        const std::vector<double> schur = solve( type );
+
+        BOOST_CHECK( direct.size() == schur.size() );
+        double maxDiff = 0., maxValue = 0.;
+        for ( std::size_t i = 0; i < direct.size(); i++ ) {
+            maxDiff  = std::max( maxDiff,  std::abs( direct[i] - schur[i] ) );
+            maxValue = std::max( maxValue, std::abs( direct[i] ) );
+        }
+        BOOST_CHECK( maxValue > 0.01 );
+        BOOST_CHECK( maxDiff < 1.e-9 * maxValue );
+    }
+
+    return 0;
+}
+//! \endcond
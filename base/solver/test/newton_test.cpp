@@ -0,0 +1,177 @@
+#include <sstream>
+#include <vector>
+#include <cmath>
+#include <boost/test/minimal.hpp>
+#include <boost/bind.hpp>
+
+#include <tools/meshGeneration/unitCube/unitCube.hpp>
+#include <base/Unstructured.hpp>
+#include <base/mesh/MeshBoundary.hpp>
+#include <base/io/smf/Reader.hpp>
+#include <base/Quadrature.hpp>
+#include <base/fe/Basis.hpp>
+#include <base/Field.hpp>
+#include <base/dof/numbering.hpp>
+#include <base/dof/generate.hpp>
+#include <base/dof/Distribute.hpp>
+#include <base/dof/constrainBoundary.hpp>
+#include <base/asmb/FieldBinder.hpp>
+#include <base/asmb/StiffnessMatrix.hpp>
+#include <base/asmb/ForceIntegrator.hpp>
+#include <base/solver/Eigen3.hpp>
+#include <base/solver/Newton.hpp>
+
+#include <heat/Static.hpp>
+#include <mat/thermal/FenicsTest.hpp>
+
+//! \cond SKIPDOX
+// nonlinear heat problem of reference/04-heat/nonlinearHeat.cpp
+typedef base::Unstructured<base::QUAD,1>       Mesh;
+typedef base::Quadrature<5,base::QUAD>         Quadrature;
+typedef base::fe::Basis<base::QUAD,2>          FEBasis;
+typedef base::Field<FEBasis,1>                 Field;
+typedef base::asmb::FieldBinder<Mesh,Field>    FieldBinder;
+typedef FieldBinder::TupleBinder<1,1>::Type    FTB;
+typedef mat::thermal::FenicsTest               Material;
+typedef heat::Static<Material,FTB::Tuple>      StaticHeat;
+typedef base::solver::Newton<>                 Newton;
+
+// u = 0 on the left and u = 1 on the right side
+template<typename DOF>
+void leftRight( const base::Vector<2>::Type& x, DOF* doFPtr )
+{
+    if ( not doFPtr -> isActive( 0 ) ) return;
+    if ( std::abs( x[0] - 0. ) < 1.e-5 ) doFPtr -> constrainValue( 0, 0. );
+    if ( std::abs( x[0] - 1. ) < 1.e-5 ) doFPtr -> constrainValue( 0, 1. );
+}
+
+struct Problem
+{
+    Problem( const unsigned n )
+        : material( 3.0 ), staticHeat( material ), fieldBinder( mesh, field )
+    {
+        std::stringstream smf;
+        tools::meshGeneration::unitCube::SMF<2,false,1>::apply( n, n, 1, smf );
+        base::io::smf::readMesh( smf, mesh );
+        base::dof::generate<FEBasis>( mesh, field );
+
+        base::mesh::MeshBoundary meshBoundary;
+        meshBoundary.create( mesh.elementsBegin(), mesh.elementsEnd() );
+        base::dof::constrainBoundary<FEBasis>(
+            meshBoundary.begin(), meshBoundary.end(), mesh, field,
+            boost::bind( &leftRight<Field::DegreeOfFreedom>, _1, _2 ) );
+        numDoFs = base::dof::numberDoFsConsecutively( field.doFsBegin(),
+                                                      field.doFsEnd() );
+    }
+
+    void residual( base::solver::Eigen3& solver )
+    {
+        base::asmb::computeResidualForces<FTB>( quadrature, solver,
+                                                fieldBinder, staticHeat );
+    }
+
+    void tangent( base::solver::Eigen3& solver )
+    {
+        base::asmb::stiffnessMatrixComputation<FTB>( quadrature, solver,
+                                                     fieldBinder, staticHeat );
+    }
+
+    void update( const base::solver::ScaledVector& dx )
+    {
+        base::dof::addToDoFsFromSolver( dx, field );
+    }
+
+    std::vector<double> values() const
+    {
+        std::vector<double> result;
+        for ( Field::DoFPtrConstIter d = field.doFsBegin(); d != field.doFsEnd(); ++d )
+            result.push_back( (*d) -> getValue( 0 ) );
+        return result;
+    }
+
+    Mesh        mesh;
+    Field       field;
+    Quadrature  quadrature;
+    Material    material;
+    StaticHeat  staticHeat;
+    FieldBinder fieldBinder;
+    std::size_t numDoFs;
+};
+
+// Newton iterations written out as in the reference application
+std::vector<double> handWritten( Problem& problem )
+{
+    for ( unsigned iter = 0; iter < 10; iter++ ) {
+        base::solver::Eigen3 solver( problem.numDoFs );
+        solver.registerFields<FTB>( problem.fieldBinder );
+        problem.tangent(  solver );
+        problem.residual( solver );
+        if ( solver.norm() < 1.e-10 ) break;
+        solver.finishAssembly();
+        solver.luSolve();
+        base::dof::addToDoFsFromSolver( solver, problem.field );
+    }
+    return problem.values();
+}
+
+// the same iterations with the driver
+std::vector<double> withDriver( Problem& problem,
+                                const bool modified, const bool lineSearch )
+{
+    Newton newton( problem.numDoFs,
+                   boost::bind( &Problem::residual, &problem, _1 ),
+                   boost::bind( &Problem::tangent,  &problem, _1 ),
+                   boost::bind( &Problem::update,   &problem, _1 ) );
+    newton.solver().registerFields<FTB>( problem.fieldBinder );
+    newton.setMaxIterations( 30 );
+    if ( modified )   newton.setModifiedNewton();
+    if ( lineSearch ) newton.setLineSearch();
+
+    BOOST_CHECK( newton.solve() );
+
+    // the step imposing the Dirichlet values is never damped
+    BOOST_CHECK( newton.history()[0].stepLength == 1.0 );
+
+    // the residual norm does not contain the Dirichlet terms: zero initially
+    BOOST_CHECK( newton.history()[0].residualNorm == 0. );
+
+    // one residual per iteration and per backtracking step
+    unsigned numResiduals = newton.numIterations();
+    for ( unsigned i = 0; i < newton.numIterations(); i++ ) {
+        const double alpha = newton.history()[i].stepLength;
+        if ( lineSearch and ( i > 0 ) and ( alpha > 0. ) )
+            numResiduals += static_cast<unsigned>( -std::log( alpha ) / std::log( 2. ) + 0.5 );
+    }
+    BOOST_CHECK( newton.numAssemblies() == numResiduals );
+
+    return problem.values();
+}
+
+double maxDifference( const std::vector<double>& a, const std::vector<double>& b )
+{
+    double result = 0.;
+    for ( std::size_t i = 0; i < a.size(); i++ )
+        result = std::max( result, std::abs( a[i] - b[i] ) );
+    return result;
+}
+
+int test_main( int, char *[] )            
+{
+    Problem reference( 6 );
+    const std::vector<double> uRef = handWritten( reference );
+
+    // plain Newton reproduces the hand-written iterations
+    {
+        Problem problem( 6 );
+        BOOST_CHECK( maxDifference( uRef, withDriver( problem, false, false ) ) < 1.e-12 );
+    }
+    
+    // modified Newton with line search converges to the same solution
+    {
+        Problem problem( 6 );
+        BOOST_CHECK( maxDifference( uRef, withDriver( problem, true, true ) ) < 1.e-8 );
+    }
+
+    return 0;
+}
+//! \endcond
@@ -0,0 +1,126 @@
+#include <sstream>
+#include <vector>
+#include <cmath>
+#include <boost/test/minimal.hpp>
+#include <boost/bind.hpp>
+
+#include <tools/meshGeneration/unitCube/unitCube.hpp>
+#include <base/Unstructured.hpp>
+#include <base/mesh/MeshBoundary.hpp>
+#include <base/io/smf/Reader.hpp>
+#include <base/Quadrature.hpp>
+#include <base/fe/Basis.hpp>
+#include <base/Field.hpp>
+#include <base/dof/numbering.hpp>
+#include <base/dof/generate.hpp>
+#include <base/dof/Distribute.hpp>
+#include <base/dof/constrainBoundary.hpp>
+#include <base/asmb/FieldBinder.hpp>
+#include <base/asmb/StiffnessMatrix.hpp>
+#include <base/asmb/BodyForce.hpp>
+#include <base/solver/Eigen3.hpp>
+#include <base/solver/StaticCondensation.hpp>
+
+#include <heat/Laplace.hpp>
+
+//! \cond SKIPDOX
+// Q2 Laplace problem with a body force and inhomogeneous boundary values
+typedef base::Unstructured<base::QUAD,1>       Mesh;
+typedef base::Quadrature<5,base::QUAD>         Quadrature;
+typedef base::fe::Basis<base::QUAD,2>          FEBasis;
+typedef base::Field<FEBasis,1>                 Field;
+typedef base::asmb::FieldBinder<Mesh,Field>    FieldBinder;
+typedef FieldBinder::TupleBinder<1,1>::Type    FTB;
+typedef heat::Laplace<FTB::Tuple>              Laplace;
+
+template<typename DOF>
+void boundaryValue( const base::Vector<2>::Type& x, DOF* doFPtr )
+{
+    if ( doFPtr -> isActive( 0 ) ) doFPtr -> constrainValue( 0, x[0] * x[1] );
+}
+
+base::Vector<1>::Type force( const base::Vector<2>::Type& x )
+{
+    return base::constantVector<1>( std::sin( 3. * x[0] ) + x[1] );
+}
+
+// set up the problem, number the DoFs and solve with the given method
+std::vector<double> solve( const bool condense )
+{
+    Mesh mesh;
+    {
+        std::stringstream smf;
+        tools::meshGeneration::unitCube::SMF<2,false,1>::apply( 5, 4, 1, smf );
+        base::io::smf::readMesh( smf, mesh );
+    }
+    Quadrature quadrature;
+    Field field;
+    base::dof::generate<FEBasis>( mesh, field );
+
+    base::mesh::MeshBoundary meshBoundary;
+    meshBoundary.create( mesh.elementsBegin(), mesh.elementsEnd() );
+    base::dof::constrainBoundary<FEBasis>(
+        meshBoundary.begin(), meshBoundary.end(), mesh, field,
+        boost::bind( &boundaryValue<Field::DegreeOfFreedom>, _1, _2 ) );
+
+    FieldBinder fieldBinder( mesh, field );
+    Laplace laplace( 1.0 );
+
+    if ( condense ) {
+        std::vector<std::size_t> interior;
+        const std::size_t numCoupled =
+            base::dof::numberDoFsInteriorLast( field, interior );
+        BOOST_CHECK( interior.size() == 20 );
+
+        base::solver::Eigen3 solver( numCoupled );
+        base::solver::StaticCondensation<base::solver::Eigen3>
+            condensation( solver, numCoupled, interior );
+        condensation.registerFields<FTB>( fieldBinder );
+
+        base::asmb::stiffnessMatrixComputation<FTB>( quadrature, condensation,
+                                                     fieldBinder, laplace );
+        base::asmb::bodyForceComputation<FTB>( quadrature, condensation,
+                                               fieldBinder, boost::bind( &force, _1 ) );
+        condensation.finishAssembly();
+        solver.choleskySolve();
+        condensation.recover();
+        base::dof::setDoFsFromSolver( condensation, field );
+    }
+    else {
+        const std::size_t numDoFs =
+            base::dof::numberDoFsConsecutively( field.doFsBegin(), field.doFsEnd() );
+        base::solver::Eigen3 solver( numDoFs );
+        solver.registerFields<FTB>( fieldBinder );
+        base::asmb::stiffnessMatrixComputation<FTB>( quadrature, solver,
+                                                     fieldBinder, laplace );
+        base::asmb::bodyForceComputation<FTB>( quadrature, solver,
+                                               fieldBinder, boost::bind( &force, _1 ) );
+        solver.finishAssembly();
+        solver.choleskySolve();
+        base::dof::setDoFsFromSolver( solver, field );
+    }
+
+    // values in the order of the DoF IDs
+    std::vector<double> values;
+    for ( Field::DoFPtrIter d = field.doFsBegin(); d != field.doFsEnd(); ++d )
+        values.push_back( (*d) -> getValue( 0 ) );
+    return values;
+}
+
+int test_main( int, char *[] )            
+{
+    const std::vector<double> direct    = solve( false );
+    const std::vector<double> condensed = solve( true  );
+
+    BOOST_CHECK( direct.size() == condensed.size() );
+    double maxDiff = 0., maxValue = 0.;
+    for ( std::size_t i = 0; i < direct.size(); i++ ) {
+        maxDiff  = std::max( maxDiff,  std::abs( direct[i] - condensed[i] ) );
+        maxValue = std::max( maxValue, std::abs( direct[i] ) );
+    }
+    BOOST_CHECK( maxValue > 0.1 );
+    BOOST_CHECK( maxDiff < 1.e-10 );
+
+    return 0;
+}
+//! \endcond
@@ -0,0 +1,122 @@
+#include <sstream>
+#include <vector>
+#include <map>
+#include <cmath>
+#include <boost/test/minimal.hpp>
+#include <boost/bind.hpp>
+
+#include <tools/meshGeneration/unitCube/unitCube.hpp>
+#include <base/Unstructured.hpp>
+#include <base/mesh/MeshBoundary.hpp>
+#include <base/io/smf/Reader.hpp>
+#include <base/Quadrature.hpp>
+#include <base/fe/Basis.hpp>
+#include <base/Field.hpp>
+#include <base/dof/numbering.hpp>
+#include <base/dof/generate.hpp>
+#include <base/dof/constrainBoundary.hpp>
+#include <base/asmb/FieldBinder.hpp>
+#include <base/asmb/StiffnessMatrix.hpp>
+#include <base/solver/Eigen3.hpp>
+
+#include <heat/Laplace.hpp>
+
+//! \cond SKIPDOX
+// Q2 Laplace operator with boundary constraints, assembled by all threads
+// (build with APPFLAGS=-fopenmp and NTHREADS > 1 for concurrent insertion)
+typedef base::Unstructured<base::QUAD,1>       Mesh;
+typedef base::Quadrature<5,base::QUAD>         Quadrature;
+typedef base::fe::Basis<base::QUAD,2>          FEBasis;
+typedef base::Field<FEBasis,1>                 Field;
+typedef base::asmb::FieldBinder<Mesh,Field>    FieldBinder;
+typedef FieldBinder::TupleBinder<1,1>::Type    FTB;
+typedef heat::Laplace<FTB::Tuple>              Laplace;
+typedef std::map<std::pair<int,int>,double>    Entries;
+
+template<typename DOF>
+void boundaryValue( const base::Vector<2>::Type& x, DOF* doFPtr )
+{
+    if ( doFPtr -> isActive( 0 ) ) doFPtr -> constrainValue( 0, x[0] );
+}
+
+// non-zero entries of the assembled matrix
+Entries entries( const base::solver::Eigen3& solver )
+{
+    std::stringstream buffer;
+    buffer.precision( 17 );
+    solver.debugLHS( buffer );
+
+    Entries result;
+    int row, col;
+    double value;
+    while ( buffer >> row >> col >> value )
+        result[ std::make_pair( row, col ) ] += value;
+    return result;
+}
+
+// largest difference of the entries relative to the largest entry
+double difference( const Entries& a, const Entries& b )
+{
+    double maxDiff = 0., maxValue = 0.;
+    for ( Entries::const_iterator i = a.begin(); i != a.end(); ++i ) {
+        const Entries::const_iterator j = b.find( i -> first );
+        const double other = ( j == b.end() ? 0. : j -> second );
+        maxDiff  = std::max( maxDiff,  std::abs( i -> second - other ) );
+        maxValue = std::max( maxValue, std::abs( i -> second ) );
+    }
+    for ( Entries::const_iterator j = b.begin(); j != b.end(); ++j )
+        if ( a.find( j -> first ) == a.end() )
+            maxDiff = std::max( maxDiff, std::abs( j -> second ) );
+    return maxDiff / maxValue;
+}
+
+int test_main( int, char *[] )
+{
+    Mesh mesh;
+    {
+        std::stringstream smf;
+        tools::meshGeneration::unitCube::SMF<2,false,1>::apply( 8, 7, 1, smf );
+        base::io::smf::readMesh( smf, mesh );
+    }
+    Quadrature quadrature;
+    Field field;
+    base::dof::generate<FEBasis>( mesh, field );
+
+    base::mesh::MeshBoundary meshBoundary;
+    meshBoundary.create( mesh.elementsBegin(), mesh.elementsEnd() );
+    base::dof::constrainBoundary<FEBasis>(
+        meshBoundary.begin(), meshBoundary.end(), mesh, field,
+        boost::bind( &boundaryValue<Field::DegreeOfFreedom>, _1, _2 ) );
+    const std::size_t numDoFs =
+        base::dof::numberDoFsConsecutively( field.doFsBegin(), field.doFsEnd() );
+
+    FieldBinder fieldBinder( mesh, field );
+    Laplace laplace( 1.0 );
+
+    // pre-structured triplets, shared by all threads
+    base::solver::Eigen3 shared( numDoFs );
+    shared.registerFields<FTB>( fieldBinder );
+    base::asmb::stiffnessMatrixComputation<FTB>( quadrature, shared,
+                                                 fieldBinder, laplace );
+    shared.finishAssembly();
+    const Entries reference = entries( shared );
+
+    // thread-private subdomain storage
+    base::solver::Eigen3 subdomain( numDoFs, true );
+    subdomain.registerFields<FTB>( fieldBinder );
+    base::asmb::stiffnessMatrixComputation<FTB>( quadrature, subdomain,
+                                                 fieldBinder, laplace );
+    subdomain.finishAssembly( false );
+    BOOST_CHECK( reference.size() > numDoFs );
+    BOOST_CHECK( difference( reference, entries( subdomain ) ) < 1.e-13 );
+
+    // re-assembly into the kept storage
+    subdomain.clearLHS();
+    base::asmb::stiffnessMatrixComputation<FTB>( quadrature, subdomain,
+                                                 fieldBinder, laplace );
+    subdomain.finishAssembly();
+    BOOST_CHECK( difference( reference, entries( subdomain ) ) < 1.e-13 );
+
+    return 0;
+}
+//! \endcond
@@ -0,0 +1,104 @@
+#include <cmath>
+#include <cstdlib>
+#include <boost/test/minimal.hpp>
+
+#include <base/linearAlgebra.hpp>
+
+//! \cond SKIPDOX
+typedef base::Matrix<3,3>::Type Mat;
+typedef base::Vector<3>::Type   Vec;
+
+// random rotation matrix
+Mat randomRotation()
+{
+    Mat R;
+    for ( unsigned i = 0; i < 3; i++ )
+        for ( unsigned j = 0; j < 3; j++ )
+            R( i, j ) = std::rand() / double( RAND_MAX ) - 0.5;
+    const Eigen::HouseholderQR<Mat> qr( R );
+    return qr.householderQ();
+}
+
+// check the decomposition of A, optionally against the exact eigenvalues
+bool check( const Mat& A, const Vec* exact = NULL )
+{
+    Mat X;
+    const Vec lambda = base::eigenPairs( A, X );
+    const Vec values = base::eigenValues( A );
+    const double norm = A.norm();
+
+    if ( not ( lambda.allFinite() and X.allFinite() and values.allFinite() ) )
+        return false;
+
+    // ascending order
+    if ( ( lambda[0] > lambda[1] ) or ( lambda[1] > lambda[2] ) ) return false;
+
+    // orthonormal eigenvectors and small residual
+    if ( ( X.transpose() * X - Mat::Identity() ).norm() > 1.e-12 ) return false;
+    if ( ( A * X - X * lambda.asDiagonal() ).norm() > 1.e-12 * norm ) return false;
+
+    // both variants agree
+    if ( ( lambda - values ).norm() > 1.e-12 * norm ) return false;
+
+    if ( exact != NULL and ( lambda - *exact ).norm() > 1.e-12 * norm )
+        return false;
+
+    return true;
+}
+
+// matrix with given eigenvalues in a random basis
+bool checkSpectrum( const double l0, const double l1, const double l2 )
+{
+    const Vec exact( l0, l1, l2 );
+    const Mat R = randomRotation();
+    const Mat A = R * exact.asDiagonal() * R.transpose();
+    return check( 0.5 * ( A + A.transpose() ), &exact );
+}
+
+int test_main( int, char *[] )
+{
+    for ( unsigned n = 0; n < 100; n++ ) {
+        // distinct, double and triple eigenvalues
+        BOOST_CHECK( checkSpectrum( 1.0, 2.0, 3.0 ) );
+        BOOST_CHECK( checkSpectrum( -2.0, 0.5, 7.0 ) );
+        BOOST_CHECK( checkSpectrum( 1.0, 1.0, 3.0 ) );
+        BOOST_CHECK( checkSpectrum( 1.0, 3.0, 3.0 ) );
+        BOOST_CHECK( checkSpectrum( 2.0, 2.0, 2.0 ) );
+        BOOST_CHECK( checkSpectrum( 1.0, 1.0 + 1.e-9, 1.0 + 2.e-9 ) );
+    }
+
+    // multiple of the identity with one entry perturbed by an ulp
+    for ( unsigned n = 0; n < 1000; n++ ) {
+        const double a = std::rand() / double( RAND_MAX ) + 0.1;
+        Mat A = a * Mat::Identity();
+        A( n % 3, n % 3 ) = nextafter( a, 2. );
+        BOOST_CHECK( check( A ) );
+    }
+
+    // the case of the bug report
+    {
+        const double a = 0.678360861576330;
+        Mat A = a * Mat::Identity();
+        A( 0, 0 ) = nextafter( a, 1. );
+        BOOST_CHECK( check( A ) );
+    }
+
+    // random perturbations of a few ulps in all entries
+    for ( unsigned n = 0; n < 1000; n++ ) {
+        const double a = std::rand() / double( RAND_MAX ) + 0.1;
+        Mat A = a * Mat::Identity();
+        for ( unsigned i = 0; i < 3; i++ )
+            for ( unsigned j = i; j < 3; j++ ) {
+                const double d = 4.e-16 * ( std::rand() / double( RAND_MAX ) - 0.5 );
+                A( i, j ) += d;
+                A( j, i ) = A( i, j );
+            }
+        BOOST_CHECK( check( A ) );
+    }
+
+    // zero matrix
+    BOOST_CHECK( check( Mat::Zero() ) );
+
+    return 0;
+}
+//! \endcond
@@ -0,0 +1,58 @@
+#include <vector>
+#include <cmath>
+#include <boost/test/minimal.hpp>
+
+#include <base/Quadrature.hpp>
+#include <base/LagrangeShapeFun.hpp>
+
+//! \cond SKIPDOX
+// Shape function and quadrature types which are first used in a parallel
+// region: the table is not registered there and the values are evaluated
+// directly, the registration follows with the first serial use
+typedef base::LagrangeShapeFun<2,base::TRI> ShapeFun;
+typedef ShapeFun::Base                      Base;
+typedef base::Quadrature<7,base::TRI>       Quadrature;
+
+// maximal deviation of the (tabulated) values from the direct evaluation
+double deviation( const Quadrature& quadrature )
+{
+    ShapeFun shapeFun;
+    Base     direct;
+    double maxDiff = 0.;
+    for ( Quadrature::Iter q = quadrature.begin(); q != quadrature.end(); ++q ) {
+        ShapeFun::FunArray  fun,  funRef;
+        ShapeFun::GradArray grad, gradRef;
+        shapeFun.fun(      q -> second, fun  );
+        shapeFun.gradient( q -> second, grad );
+        direct.fun(        q -> second, funRef  );
+        direct.gradient(   q -> second, gradRef );
+        for ( std::size_t i = 0; i < fun.size(); i++ ) {
+            maxDiff = std::max( maxDiff, std::abs( fun[i] - funRef[i] ) );
+            maxDiff = std::max( maxDiff, ( grad[i] - gradRef[i] ).norm() );
+        }
+    }
+    return maxDiff;
+}
+
+int test_main( int, char *[] )
+{
+    double maxDiff = 0.;
+#ifdef _OPENMP
+#pragma omp parallel num_threads(4) reduction(max:maxDiff)
+#endif
+    {
+        Quadrature quadrature;
+        maxDiff = deviation( quadrature );
+    }
+    BOOST_CHECK( maxDiff == 0. );
+
+    // serial use registers and tabulates
+    Quadrature quadrature;
+    BOOST_CHECK( deviation( quadrature ) == 0. );
+    BOOST_CHECK( ShapeFun::Table::instance().size() >=
+                 static_cast<std::size_t>( std::distance( quadrature.begin(),
+                                                          quadrature.end() ) ) );
+
+    return 0;
+}
+//! \endcond
@@ -0,0 +1,394 @@
+//------------------------------------------------------------------------------
+// <preamble>
+// </preamble>
+//------------------------------------------------------------------------------
+
+//! @file   CentralDifference.hpp
+//! @author agent
+//! @date   2026
+
+#ifndef base_time_centraldifference_hpp
+#define base_time_centraldifference_hpp
+
+//------------------------------------------------------------------------------
+// std includes
+#include <vector>
+#include <limits>
+#include <algorithm>
+// boost includes
+#include <boost/bind.hpp>
+#include <boost/function.hpp>
+// base includes
+#include <base/verify.hpp>
+#include <base/linearAlgebra.hpp>
+#include <base/auxi/parallel.hpp>
+#include <base/mesh/Size.hpp>
+// base/asmb includes
+#include <base/asmb/collectFromDoFs.hpp>
+#include <base/asmb/assembleForces.hpp>
+#include <base/asmb/ForceIntegrator.hpp>
+// base/dof includes
+#include <base/dof/Distribute.hpp>
+// base/kernel includes
+#include <base/kernel/Mass.hpp>
+
+//------------------------------------------------------------------------------
+namespace base{
+    namespace time{
+
+        //! Choice of the diagonalisation of the mass matrix
+        enum MassLumping
+        {
+            ROW_SUM, //!< Sum of every row of the consistent matrix
+            HRZ      //!< Scaled diagonal (Hinton, Rock, Zienkiewicz)
+        };
+
+        template<typename QUAD, typename SOLVER, typename FIELDTUPLE>
+        class LumpedMass;
+
+        class CentralDifference;
+
+        //----------------------------------------------------------------------
+        /** Convenience function for the lumped mass matrix.
+         *  The diagonal of the lumped mass matrix is assembled to the RHS
+         *  storage of the given solver.
+         *  \tparam FIELDTUPLEBINDER Binding of the right field tuple
+         *  \tparam QUADRATURE       Type of quadrature
+         *  \tparam SOLVER           Type of solver (as storage)
+         *  \tparam FIELDBINDER      Type of field compound
+         */
+        template<typename FIELDTUPLEBINDER,
+                 typename QUADRATURE, typename SOLVER, typename FIELDBINDER>
+        void computeLumpedMass( const QUADRATURE&  quadrature,
+                                SOLVER&            solver,
+                                const FIELDBINDER& fieldBinder,
+                                const double       density,
+                                const MassLumping  lumping = ROW_SUM )
+        {
+            typedef LumpedMass<QUADRATURE,SOLVER,
+                               typename FIELDTUPLEBINDER::Tuple> LM;
+            LM lumpedMass( quadrature, solver, density, lumping );
+            base::auxi::applyToAllFieldTuple<FIELDTUPLEBINDER>( fieldBinder,
+                                                                lumpedMass );
+        }
+
+        //----------------------------------------------------------------------
+        /** Residual forces for an explicit step, assembled in parallel.
+         *  Same as base::asmb::computeResidualForces, but the elements are
+         *  processed in parallel, therefore the kernel has to be thread-safe.
+         *  \tparam FIELDTUPLEBINDER Binding of the right field tuple
+         *  \tparam QUADRATURE       Type of quadrature
+         *  \tparam SOLVER           Type of solver (as storage)
+         *  \tparam FIELDBINDER      Type of field compound
+         *  \tparam KERNEL           Type of object with residualForce
+         */
+        template<typename FIELDTUPLEBINDER,
+                 typename QUADRATURE, typename SOLVER,
+                 typename FIELDBINDER, typename KERNEL>
+        void computeExplicitForces( const QUADRATURE&  quadrature,
+                                    SOLVER&            solver,
+                                    const FIELDBINDER& fieldBinder,
+                                    const KERNEL&      kernelObj )
+        {
+            typedef base::asmb::ForceIntegrator<QUADRATURE,SOLVER,
+                                                typename FIELDTUPLEBINDER::Tuple>
+                ForceIntegrator;
+
+            typename ForceIntegrator::ForceKernel
+                residualForce = boost::bind( &KERNEL::residualForce,
+                                             &kernelObj, _1, _2, _3, _4 );
+
+            // Note the -1 for moving the forces to the RHS of the system
+            ForceIntegrator forceInt( residualForce, quadrature, solver, -1.0 );
+
+            base::auxi::applyToAllFieldTuple<FIELDTUPLEBINDER>( fieldBinder,
+                                                                forceInt );
+        }
+
+        //----------------------------------------------------------------------
+        /** Estimate of the critical step size of an explicit scheme.
+         *  The Courant condition for the central difference scheme with a
+         *  lumped mass matrix reads
+         *  \f[
+         *       \Delta t \leq \min_e \frac{h_e}{p c}
+         *  \f]
+         *  with the speed \f$ c \f$ of the fastest wave (e.g. the dilatational
+         *  wave speed \f$ \sqrt{(\lambda + 2\mu)/\rho} \f$ of a solid), the
+         *  element size \f$ h_e \f$ and the polynomial degree \f$ p \f$ of
+         *  the field, i.e. the nodal spacing \f$ h_e / p \f$ is used. Here,
+         *  the shortest edge of the element (base::mesh::MinimalEdgeLength)
+         *  is taken for \f$ h_e \f$.
+         *
+         *  \note This is an estimate and not a bound: the actual limit
+         *        \f$ 2 / \omega_{max} \f$ depends on the element shape and
+         *        the lumping scheme, e.g. HRZ-lumped quadratic elements can
+         *        be considerably more restrictive than \f$ h_e/(p c) \f$.
+         *        The caller has to apply a safety factor less than one and
+         *        choose it according to the discretisation.
+         *  \tparam MESH  Type of mesh
+         *  \param[in] mesh        Mesh of the domain
+         *  \param[in] waveSpeed   Speed of the fastest wave
+         *  \param[in] fieldDegree Polynomial degree of the field
+         *  \return    Estimate of the critical step size
+         */
+        template<typename MESH>
+        double criticalStepSize( const MESH& mesh, const double waveSpeed,
+                                 const unsigned fieldDegree = 1 )
+        {
+            VERIFY_MSG( fieldDegree > 0, "Field degree has to be positive" );
+
+            double minSize = std::numeric_limits<double>::max();
+            typename MESH::ElementPtrConstIter eIter = mesh.elementsBegin();
+            typename MESH::ElementPtrConstIter eEnd  = mesh.elementsEnd();
+            for ( ; eIter != eEnd; ++eIter )
+                minSize = std::min( minSize,
+                                    base::mesh::minimalEdgeLength( *eIter ) );
+
+            return minSize / ( static_cast<double>( fieldDegree ) * waveSpeed );
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+/** Element-wise computation of a lumped mass matrix.
+ *  The consistent element mass matrix
+ *  \f[
+ *      M_{ij} = \int_{\Omega_e} \rho \phi_i \phi_j dx
+ *  \f]
+ *  (see base::kernel::Mass) is integrated and replaced by a diagonal matrix
+ *  with either the row sums \f$ m_i = \sum_j M_{ij} \f$ or, following
+ *  Hinton, Rock and Zienkiewicz (HRZ), the diagonal entries scaled such that
+ *  the element mass is preserved
+ *  \f[
+ *      m_i = M_{ii} \frac{\sum_{jk} M_{jk}}{\sum_j M_{jj}}
+ *  \f]
+ *  The row sum is negative for some functions of higher order (e.g.,
+ *  the vertex functions of quadratic triangles), the HRZ scheme always gives
+ *  positive entries. The diagonal is assembled like a force vector, i.e. to
+ *  the RHS storage of the solver.
+ *  \tparam QUAD         Quadrature
+ *  \tparam SOLVER       Solver (as storage)
+ *  \tparam FIELDTUPLE   Tuple of field element pointers
+ */
+template<typename QUAD, typename SOLVER, typename FIELDTUPLE>
+class base::time::LumpedMass
+    : public boost::function<void( const FIELDTUPLE& )>
+{
+public:
+    //! @name Template parameter
+    //@{
+    typedef QUAD          Quadrature;
+    typedef SOLVER        Solver;
+    typedef FIELDTUPLE    FieldTuple;
+    //@}
+
+    //! Kernel of the consistent mass matrix
+    typedef base::kernel::Mass<FieldTuple> MassKernel;
+
+    //! Constructor with quadrature, solver and mass density
+    LumpedMass( const Quadrature&  quadrature,
+                Solver&            solver,
+                const double       density,
+                const base::time::MassLumping lumping = base::time::ROW_SUM )
+        : quadrature_( quadrature ),
+          solver_(     solver ),
+          mass_(       density ),
+          lumping_(    lumping )
+    { }
+
+    //--------------------------------------------------------------------------
+    void operator()( const FieldTuple& fieldTuple )
+    {
+        // dof activities and IDs
+        std::vector<base::dof::DoFStatus> doFStatus;
+        std::vector<std::size_t> doFIDs;
+        std::vector<base::number> prescribedValues; // placeholder
+        base::asmb::ElementConstraints constraints;
+
+        const bool doSomething =
+            base::asmb::collectFromDoFs( fieldTuple.testElementPtr(),
+                                         doFStatus, doFIDs,
+                                         prescribedValues, constraints, false );
+        if ( not doSomething ) return;
+
+        // consistent element mass matrix
+        base::MatrixD matrix = base::MatrixD::Zero( doFIDs.size(),
+                                                    doFIDs.size() );
+        MatrixKernel_ kernel =
+            boost::bind( &MassKernel::tangentStiffness, &mass_, _1, _2, _3, _4 );
+        quadrature_.apply( kernel, fieldTuple, matrix );
+
+        // diagonalisation
+        base::VectorD lumped;
+        if ( lumping_ == base::time::ROW_SUM )
+            lumped = matrix.rowwise().sum();
+        else {
+            lumped = matrix.diagonal();
+            lumped *= matrix.sum() / lumped.sum();
+        }
+
+        base::asmb::assembleForces( lumped, doFStatus, doFIDs, constraints,
+                                    solver_ );
+    }
+
+private:
+    //! Type of the kernel function of the element matrix
+    typedef boost::function<void( const FieldTuple&,
+                                  const typename Quadrature::VecDim&,
+                                  const double,
+                                  base::MatrixD& )> MatrixKernel_;
+
+    const Quadrature&              quadrature_; //!< Quadrature
+    Solver&                        solver_;     //!< Storage of the result
+    const MassKernel               mass_;       //!< Consistent mass kernel
+    const base::time::MassLumping  lumping_;    //!< Choice of lumping
+};
+
+//------------------------------------------------------------------------------
+/** Explicit time integration by the central difference method.
+ *  For the semi-discrete equations of motion
+ *  \f[
+ *       M \ddot{u} = F^{ext}(t) - F^{int}(u)
+ *  \f]
+ *  with a diagonal (lumped) mass matrix \f$ M \f$, the central difference
+ *  method in its leap-frog form reads
+ *  \f[
+ *       v^{n+1/2} = v^{n-1/2} + \Delta t M^{-1} F^n, \quad
+ *       u^{n+1}   = u^n + \Delta t v^{n+1/2}
+ *  \f]
+ *  where \f$ F^n \f$ is the total force evaluated with \f$ u^n \f$ and the
+ *  first step uses \f$ \Delta t / 2 \f$ in the velocity update in order to
+ *  get \f$ v^{1/2} \f$ from the initial velocity \f$ v^0 \f$. No linear
+ *  system has to be solved, a step consists of a residual assembly to the
+ *  RHS storage of a solver (e.g., via base::time::computeExplicitForces)
+ *  and a call to advance(). The scheme is only conditionally stable, see
+ *  base::time::criticalStepSize.
+ *
+ *  The lumped mass is passed once by setMass(), e.g. after
+ *  base::time::computeLumpedMass. The values are stored by the global DoF
+ *  indices and passed to the field by distribute(), which also evaluates
+ *  the constraints of the field, i.e. prescribed displacements are taken
+ *  from the constraint values at every step.
+ */
+class base::time::CentralDifference
+{
+public:
+    //! Constructor with the number of unknowns and the step size
+    CentralDifference( const std::size_t numDoFs, const double stepSize )
+        : stepSize_( stepSize ),
+          numSteps_( 0 ),
+          invMass_(  numDoFs, 0. ),
+          u_(        numDoFs, 0. ),
+          v_(        numDoFs, 0. )
+    { }
+
+    //--------------------------------------------------------------------------
+    //! Take the lumped mass from the RHS storage of the solver
+    template<typename SOLVER>
+    void setMass( const SOLVER& solver )
+    {
+        for ( std::size_t i = 0; i < invMass_.size(); i++ ) {
+            const double m = solver.getValue( i );
+            VERIFY_MSG( m > 0., "Lumped mass has to be positive" );
+            invMass_[i] = 1. / m;
+        }
+    }
+
+    //! Take the initial values from the active components of a field
+    template<typename FIELD>
+    void setInitialValues( const FIELD& field )
+    {
+        this -> fromField_( field, u_ );
+    }
+
+    //! Take the initial velocities from the active components of a field
+    template<typename FIELD>
+    void setInitialVelocities( const FIELD& field )
+    {
+        this -> fromField_( field, v_ );
+    }
+
+    //--------------------------------------------------------------------------
+    //! Advance by one step with the forces in the RHS storage of the solver
+    template<typename SOLVER>
+    void advance( const SOLVER& solver )
+    {
+        const double velocityStep =
+            ( numSteps_ == 0 ? 0.5 * stepSize_ : stepSize_ );
+
+        Advance_<SOLVER> op( *this, solver, velocityStep );
+        base::auxi::applyToAllIndices( u_.size(), op );
+
+        numSteps_++;
+    }
+
+    //! Pass the current values to the field and evaluate its constraints
+    template<typename FIELD>
+    void distribute( FIELD& field ) const
+    {
+        base::dof::Distribute<typename FIELD::DegreeOfFreedom,
+                              CentralDifference,base::dof::SET> dist( *this );
+        dist.apply( field );
+    }
+
+    //--------------------------------------------------------------------------
+    //! @name Access
+    //@{
+    //! Value as source for base::dof::Distribute
+    number getValue( const std::size_t index ) const { return u_[ index ]; }
+
+    //! Velocity at the last half step
+    number getVelocity( const std::size_t index ) const { return v_[ index ]; }
+
+    double   getStepSize() const { return stepSize_; }
+    unsigned getNumSteps() const { return numSteps_; }
+    double   getTime()     const { return numSteps_ * stepSize_; }
+    //@}
+
+private:
+    //! Collect the values of all active DoF components of a field
+    template<typename FIELD>
+    void fromField_( const FIELD& field, std::vector<number>& values ) const
+    {
+        typedef typename FIELD::DegreeOfFreedom DoF;
+        typename FIELD::DoFPtrConstIter dIter = field.doFsBegin();
+        typename FIELD::DoFPtrConstIter dEnd  = field.doFsEnd();
+        for ( ; dIter != dEnd; ++dIter ) {
+            for ( unsigned d = 0; d < DoF::size; d++ )
+                if ( (*dIter) -> isActive( d ) )
+                    values[ (*dIter) -> getIndex( d ) ] = (*dIter) -> getValue( d );
+        }
+    }
+
+    //! Update of one unknown, every index refers to different data
+    template<typename SOLVER>
+    class Advance_
+    {
+    public:
+        Advance_( CentralDifference& cd, const SOLVER& solver,
+                  const double velocityStep )
+            : cd_( cd ), solver_( solver ), velocityStep_( velocityStep )
+        { }
+
+        void operator()( const std::size_t i ) const
+        {
+            cd_.v_[i] += velocityStep_ * cd_.invMass_[i] * solver_.getValue( i );
+            cd_.u_[i] += cd_.stepSize_ * cd_.v_[i];
+        }
+
+    private:
+        CentralDifference& cd_;
+        const SOLVER&      solver_;
+        const double       velocityStep_;
+    };
+
+private:
+    const double        stepSize_;  //!< Constant step size
+    unsigned            numSteps_;  //!< Number of steps taken
+
+    std::vector<number> invMass_;   //!< Inverse of the lumped mass
+    std::vector<number> u_;         //!< Values at the current step
+    std::vector<number> v_;         //!< Velocities at the last half step
+};
+
+#endif
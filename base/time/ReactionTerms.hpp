@@ -42,14 +42,16 @@ namespace base{
                                    const FIELDBINDER& fieldBinder,
                                    const double stepSize,
                                    const unsigned step, 
-                                   const bool incremental = true )
+                                   const bool incremental = true,
+                                   const MSM& method = MSM() )
         {
             typedef typename FIELDTUPLEBINDER::Tuple ElementPtrTuple;
             typedef base::time::ReactionTerms<QUADRATURE,SOLVER,MSM,ElementPtrTuple> RT;
             typename RT::Kernel kernelFun = boost::bind( &KERNEL::tangentStiffness,
                                                          &kernel, _1, _2, _3, _4 );
 
-            RT rt( kernelFun, quadrature, solver, stepSize, step, incremental );
+            RT rt( kernelFun, quadrature, solver, stepSize, step, incremental,
+                   method );
 
             base::auxi::applyToAllFieldTuple<FIELDTUPLEBINDER>( fieldBinder, rt );
 
@@ -71,7 +73,8 @@ namespace base{
                                   const double stepSize,
                                   const unsigned step, 
                                   const double density,
-                                  const bool incremental = true )
+                                  const bool incremental = true,
+                                  const MSM& method = MSM() )
         {
             typedef typename FIELDTUPLEBINDER::Tuple ElementPtrTuple;
             
@@ -79,7 +82,8 @@ namespace base{
             typedef base::time::ReactionTerms<QUADRATURE,SOLVER,MSM,ElementPtrTuple> RT;
             typename RT::Kernel kernelFun = boost::bind( mass, _1, _2, _3, _4 );
 
-            RT rt( kernelFun, quadrature, solver, stepSize, step, incremental );
+            RT rt( kernelFun, quadrature, solver, stepSize, step, incremental,
+                   method );
             base::auxi::applyToAllFieldTuple<FIELDTUPLEBINDER>( fieldBinder, rt );
 
             // Apply to all elements
@@ -219,19 +223,24 @@ public:
                                   const double,
                                   base::MatrixD& ) >  Kernel;
 
-    //! Constructor with use-provided kernel function
+    /** Constructor with use-provided kernel function
+     *  The time stepping method object is only needed for methods with a
+     *  state, e.g. base::time::VariableStep, otherwise the default applies.
+     */
     ReactionTerms( const Kernel&        kernel, 
                    const Quadrature&    quadrature,
                    Solver&              solver,
                    const double         stepSize, 
                    const unsigned       step,
-                   const bool           incremental = true )
+                   const bool           incremental = true,
+                   const TimeSteppingMethod& method = TimeSteppingMethod() )
         : kernel_(          kernel ), 
           quadrature_(      quadrature ),
           solver_(          solver ),
           stepSize_(        stepSize ),
           step_(            step ),
-          incremental_( incremental )
+          incremental_( incremental ),
+          method_(          method )
     { }
 
     //--------------------------------------------------------------------------
@@ -256,9 +265,7 @@ public:
         std::vector<number> rowDoFValues, colDoFValues;
 
         // dof constraints
-        typedef std::pair<unsigned, std::vector< std::pair<base::number,std::size_t> > >
-            WeightedDoFIDs;
-        std::vector<WeightedDoFIDs> rowConstraints, colConstraints;
+        base::asmb::ElementConstraints rowConstraints, colConstraints;
 
         // Collect dof entities from element
         base::asmb::collectFromDoFs( testEp, rowDoFStatus,
@@ -269,7 +276,6 @@ public:
             colDoFStatus   = rowDoFStatus;
             colDoFIDs      = rowDoFIDs;
             colDoFValues   = rowDoFValues;
-            colConstraints = rowConstraints;
         }
         else
             base::asmb::collectFromDoFs( trialEp, colDoFStatus,
@@ -287,7 +293,7 @@ public:
         // LHS
         {
             // LHS weight
-            const double alpha = TimeSteppingMethod::systemMassWeight( step_ );
+            const double alpha = method_.systemMassWeight( step_ );
 
             const base::MatrixD lhsMatrix = (alpha/stepSize_) * elemMat;
         
@@ -296,7 +302,8 @@ public:
                                         rowDoFStatus, colDoFStatus,
                                         rowDoFIDs, colDoFIDs,
                                         colDoFValues,
-                                        rowConstraints, colConstraints, 
+                                        rowConstraints,
+                                        ( isBubnov ? rowConstraints : colConstraints ),
                                         solver_, isBubnov );
         }
 
@@ -304,7 +311,7 @@ public:
         {
             // RHS weights for reaction terms
             std::vector<double> reactionWeights;
-            TimeSteppingMethod::reactionWeights( step_, reactionWeights );
+            method_.reactionWeights( step_, reactionWeights );
 
             // divide weights by step size
             for ( unsigned s = 0; s < reactionWeights.size(); s++ )
@@ -362,6 +369,8 @@ private:
     const double         stepSize_;    //!< Time step size
     const unsigned       step_;        //!< Number of time step
     const bool           incremental_; //!< True for incremental analysis
+
+    const TimeSteppingMethod method_;  //!< Time stepping method
 };
 
 #endif
@@ -35,10 +35,11 @@ namespace base{
                                           const QUADRATURE& quadrature,
                                           SOLVER&           solver,
                                           FIELDBINDER&      fieldBinder, 
-                                          const unsigned step )
+                                          const unsigned step,
+                                          const MSM& method = MSM() )
         {
             base::time::ResidualForceHistory<KERNEL,QUADRATURE,SOLVER,MSM>
-                rfh( kernel, quadrature, solver,  step );
+                rfh( kernel, quadrature, solver,  step, method );
             
             // Apply to all elements
             typename FIELDBINDER::FieldIterator iter = fieldBinder.elementsBegin();
@@ -183,15 +184,17 @@ public:
     STATIC_ASSERT_MSG( nHist >= TimeSteppingMethod::numSteps,
                        "History storage of DoFs too small" );
 
-    //! Constructor
+    //! Constructor, the method object is only needed if it has a state
     ResidualForceHistory( const Kernel&       kernel,
                           const Quadrature&    quadrature,
                           Solver&              solver,
-                          const unsigned       step )
+                          const unsigned       step,
+                          const TimeSteppingMethod& method = TimeSteppingMethod() )
         : kernel_(     kernel ),
           quadrature_( quadrature ),
           solver_(     solver ),
-          step_(       step )
+          step_(       step ),
+          method_(     method )
     { }
 
     //--------------------------------------------------------------------------
@@ -211,9 +214,7 @@ public:
         std::vector<base::number> prescribedValues;
 
         // linear constraints on the dofs
-        std::vector<
-            std::pair<unsigned,std::vector<std::pair<base::number,std::size_t> > >
-            > constraints;
+        base::asmb::ElementConstraints constraints;
 
         // collect from element's dofs
         base::asmb::collectFromDoFs( testEp, doFStatus, doFIDs,
@@ -221,7 +222,7 @@ public:
 
         // RHS weights for reaction terms
         std::vector<double> forceWeights;
-        TimeSteppingMethod::forceWeights( step_, forceWeights );
+        method_.forceWeights( step_, forceWeights );
 
         // negative weights for moving the forces to the right hand side
         for ( unsigned w = 0; w < forceWeights.size(); w++ )
@@ -250,6 +251,7 @@ private:
     const Quadrature&    quadrature_;  //!< Quadrature object
     Solver&              solver_;      //!< Solver object
     const unsigned       step_;        //!< Number of time step
+    const TimeSteppingMethod method_;  //!< Time stepping method
 };
 
 #endif
@@ -0,0 +1,138 @@
+//------------------------------------------------------------------------------
+// <preamble>
+// </preamble>
+//------------------------------------------------------------------------------
+
+//! @file   StepSizeController.hpp
+//! @author agent
+//! @date   2026
+
+#ifndef base_time_stepsizecontroller_hpp
+#define base_time_stepsizecontroller_hpp
+
+//------------------------------------------------------------------------------
+// std includes
+#include <cmath>
+#include <limits>
+#include <algorithm>
+// base includes
+#include <base/verify.hpp>
+
+//------------------------------------------------------------------------------
+namespace base{
+    namespace time{
+
+        class StepSizeController;
+    }
+}
+
+//------------------------------------------------------------------------------
+/** Selection of the next time step size from an error estimate.
+ *  Given the scaled norm \f$ \| e \| \f$ of the local error of a step with
+ *  size \f$ \Delta t \f$ (see base::time::localErrorNorm), the step is
+ *  accepted if \f$ \| e \| \le 1 \f$. The next step size is
+ *  \f[
+ *      \Delta t^{new} = \Delta t \, \rho \,
+ *      \| e \|^{-\alpha} \, \| e^{old} \|^{\beta}
+ *  \f]
+ *  with a safety factor \f$ \rho < 1 \f$ and the norm of the previously
+ *  accepted step \f$ \| e^{old} \| \f$. With
+ *  \f$ \alpha = 0.7 / (q+1) \f$ and \f$ \beta = 0.4 / (q+1) \f$ this is the
+ *  PI-controller of Gustafsson, which gives smoother step size sequences than
+ *  the elementary choice \f$ \alpha = 1/(q+1) \f$, \f$ \beta = 0 \f$, used
+ *  here after rejected steps. The ratio of new and old step size is limited
+ *  to \f$ [r_{min}, r_{max}] \f$, the default \f$ r_{max} = 2 \f$ keeps the
+ *  variable step BDF methods zero-stable. After a rejection the step size is
+ *  not increased. Finally, the step size is bounded by the given minimal and
+ *  maximal values.
+ */
+class base::time::StepSizeController
+{
+public:
+    //! Constructor with the controller parameters
+    StepSizeController( const double safety    = 0.9,
+                        const double minFactor = 0.2,
+                        const double maxFactor = 2.0,
+                        const double minStep   = 0.,
+                        const double maxStep   =
+                        std::numeric_limits<double>::max() )
+        : safety_( safety ), minFactor_( minFactor ), maxFactor_( maxFactor ),
+          minStep_( minStep ), maxStep_( maxStep ),
+          oldError_( -1. ), rejected_( false ),
+          numAccepted_( 0 ), numRejected_( 0 )
+    {
+        VERIFY_MSG( (safety > 0.) and (safety <= 1.),
+                    "Safety factor must be in (0,1]" );
+        VERIFY_MSG( (minFactor < 1.) and (maxFactor > 1.),
+                    "Invalid bounds of step size ratio" );
+    }
+
+    //! Check the error norm, i.e. \f$ \| e \| \le 1 \f$
+    bool accept( const double error ) const { return error <= 1.; }
+
+    /** Proposal for the next step size
+     *  \param[in] stepSize Size of the step which has been checked
+     *  \param[in] error    Its scaled error norm
+     *  \param[in] order    Order \f$ q \f$ of the method used in that step
+     *  \return             Size of the next (or repeated) step
+     */
+    double nextStepSize( const double stepSize, const double error,
+                         const unsigned order )
+    {
+        const double expo = 1. / static_cast<double>( order + 1 );
+
+        // guard against a vanishing error
+        const double err = std::max( error, 1.e-10 );
+
+        double factor;
+        if ( this -> accept( error ) ) {
+            if ( oldError_ > 0. )  // PI controller
+                factor = safety_ * std::pow( err, -0.7 * expo )
+                    * std::pow( oldError_, 0.4 * expo );
+            else
+                factor = safety_ * std::pow( err, -expo );
+
+            // no increase directly after a rejection
+            if ( rejected_ ) factor = std::min( factor, 1. );
+
+            oldError_ = err;
+            rejected_ = false;
+            numAccepted_++;
+        }
+        else {
+            factor = std::min( safety_ * std::pow( err, -expo ), 1. );
+            rejected_ = true;
+            numRejected_++;
+        }
+
+        factor = std::max( minFactor_, std::min( maxFactor_, factor ) );
+
+        const double newStepSize =
+            std::max( minStep_, std::min( maxStep_, factor * stepSize ) );
+
+        VERIFY_MSG( this -> accept( error ) or (newStepSize < stepSize),
+                    "Step size reached its minimum but error is too large" );
+
+        return newStepSize;
+    }
+
+    //! @name Statistics
+    //@{
+    unsigned numAccepted() const { return numAccepted_; }
+    unsigned numRejected() const { return numRejected_; }
+    //@}
+
+private:
+    const double safety_;     //!< Safety factor
+    const double minFactor_;  //!< Minimal ratio of new and old step size
+    const double maxFactor_;  //!< Maximal ratio of new and old step size
+    const double minStep_;    //!< Minimal step size
+    const double maxStep_;    //!< Maximal step size
+
+    double   oldError_;       //!< Error norm of last accepted step
+    bool     rejected_;       //!< Last step has been rejected
+    unsigned numAccepted_;    //!< Number of accepted steps
+    unsigned numRejected_;    //!< Number of rejected steps
+};
+
+#endif
@@ -0,0 +1,393 @@
+//------------------------------------------------------------------------------
+// <preamble>
+// </preamble>
+//------------------------------------------------------------------------------
+
+//! @file   VariableStep.hpp
+//! @author agent
+//! @date   2026
+
+#ifndef base_time_variablestep_hpp
+#define base_time_variablestep_hpp
+
+//------------------------------------------------------------------------------
+// std includes
+#include <vector>
+#include <algorithm>
+#include <cmath>
+// base includes
+#include <base/verify.hpp>
+// base/time includes
+#include <base/time/BDF.hpp>
+#include <base/time/AdamsMoulton.hpp>
+
+//------------------------------------------------------------------------------
+namespace base{
+    namespace time{
+
+        template<unsigned ORDER, template<unsigned> class METHOD>
+        class VariableStep;
+
+        namespace detail_{
+
+            //------------------------------------------------------------------
+            /** Derivative of the s-th Lagrange polynomial at x[0].
+             *  The polynomial interpolates the nodes x[0],...,x[n-1].
+             */
+            inline double lagrangeDerivativeAtFirst( const std::vector<double>& x,
+                                                     const unsigned n,
+                                                     const unsigned s )
+            {
+                if ( s == 0 ) {
+                    double sum = 0.;
+                    for ( unsigned j = 1; j < n; j++ )
+                        sum += 1. / ( x[0] - x[j] );
+                    return sum;
+                }
+
+                double result = 1. / ( x[s] - x[0] );
+                for ( unsigned j = 1; j < n; j++ )
+                    if ( j != s ) result *= ( x[0] - x[j] ) / ( x[s] - x[j] );
+                return result;
+            }
+
+            //------------------------------------------------------------------
+            //! Value of the s-th Lagrange polynomial of the nodes x[b,...,e-1]
+            inline double lagrangeValue( const std::vector<double>& x,
+                                         const unsigned b, const unsigned e,
+                                         const unsigned s, const double y )
+            {
+                double result = 1.;
+                for ( unsigned j = b; j < e; j++ )
+                    if ( j != s ) result *= ( y - x[j] ) / ( x[s] - x[j] );
+                return result;
+            }
+
+            //------------------------------------------------------------------
+            /** Rules for the variable step-size version of a multi-step method.
+             *  Specialisations provide the startup order, the number of stored
+             *  steps, the number of interpolation nodes for a given order and
+             *  the LHS and RHS weights for a given set of normalised
+             *  time nodes \f$ x_s = (t^{n+1-s} - t^{n+1}) / \Delta t^{n+1} \f$.
+             */
+            template<template<unsigned> class METHOD>
+            struct VariableRule;
+
+            //------------------------------------------------------------------
+            //! BDF: weights from the derivative of the interpolant at x_0
+            template<>
+            struct VariableRule<base::time::BDF>
+            {
+                template<unsigned Q>
+                struct NumSteps { static const unsigned value = Q; };
+
+                static unsigned order( const unsigned maxOrder,
+                                       const unsigned step )
+                {
+                    return std::min( maxOrder, step + 1 );
+                }
+
+                static unsigned numNodes( const unsigned q ) { return q + 1; }
+
+                static void lhsWeights( const std::vector<double>& x,
+                                        const unsigned q,
+                                        std::vector<double>& a )
+                {
+                    a.resize( q+1 );
+                    for ( unsigned s = 0; s < q+1; s++ )
+                        a[s] = lagrangeDerivativeAtFirst( x, q+1, s );
+                }
+
+                static void rhsWeights( const std::vector<double>& x,
+                                        const unsigned q,
+                                        std::vector<double>& b )
+                {
+                    b.assign( 1, 1.0 );
+                }
+
+                //! Error constants of the uniform BDF-q, 1/((q+1) sum_j 1/j)
+                static double errorConstant( const unsigned q )
+                {
+                    static const double c[] = { 0., 1./2., 2./9., 3./22., 12./125.,
+                                                10./137., 20./343. };
+                    return c[q];
+                }
+
+                //! Error constant for the nodes x_0,...,x_q
+                static double errorConstant( const std::vector<double>& x,
+                                             const unsigned q )
+                {
+                    double product = 1.;
+                    for ( unsigned j = 1; j <= q; j++ )
+                        product *= -x[j] / static_cast<double>( j+1 );
+                    return product / lagrangeDerivativeAtFirst( x, q+1, 0 );
+                }
+            };
+
+            //------------------------------------------------------------------
+            //! Adams-Moulton: weights from the integral of the interpolant
+            template<>
+            struct VariableRule<base::time::AdamsMoulton>
+            {
+                template<unsigned Q>
+                struct NumSteps { static const unsigned value = (Q > 1 ? Q-1 : 1); };
+
+                static unsigned order( const unsigned maxOrder,
+                                       const unsigned step )
+                {
+                    return std::min( maxOrder, step + 2 );
+                }
+
+                static unsigned numNodes( const unsigned q ) { return q; }
+
+                static void lhsWeights( const std::vector<double>& x,
+                                        const unsigned q,
+                                        std::vector<double>& a )
+                {
+                    a.resize( 2 );
+                    a[0] =  1.0;
+                    a[1] = -1.0;
+                }
+
+                static void rhsWeights( const std::vector<double>& x,
+                                        const unsigned q,
+                                        std::vector<double>& b )
+                {
+                    // 3-point Gauss-Legendre on [-1,0], exact up to degree 5
+                    static const double gp[3] = { -0.5 - 0.5 * std::sqrt( 0.6 ),
+                                                  -0.5,
+                                                  -0.5 + 0.5 * std::sqrt( 0.6 ) };
+                    static const double gw[3] = { 5./18., 8./18., 5./18. };
+
+                    b.assign( q, 0. );
+                    for ( unsigned s = 0; s < q; s++ )
+                        for ( unsigned g = 0; g < 3; g++ )
+                            b[s] += gw[g] * lagrangeValue( x, 0, q, s, gp[g] );
+                }
+
+                //! Error constants of the uniform AM-q
+                static double errorConstant( const unsigned q )
+                {
+                    static const double c[] = { 0., 1./2., 1./12., 1./24., 19./720.,
+                                                3./160., 863./60480. };
+                    return c[q];
+                }
+
+                //! Uniform error constant, the nodes are not used
+                static double errorConstant( const std::vector<double>& x,
+                                             const unsigned q )
+                {
+                    return errorConstant( q );
+                }
+            };
+
+        } // namespace detail_
+    }
+}
+
+//------------------------------------------------------------------------------
+/** Linear multi-step method with variable step sizes.
+ *  The weights of base::time::BDF and base::time::AdamsMoulton are tabulated
+ *  for constant step sizes \f$ \Delta t \f$. If the step size changes from
+ *  step to step, the weights depend on the ratios of the step sizes and are
+ *  computed here from the underlying polynomial interpolation of the
+ *  solution history. With the normalised nodes
+ *  \f[
+ *      x_s = \frac{t^{n+1-s} - t^{n+1}}{\Delta t^{n+1}}, \quad
+ *      \Delta t^{n+1} = t^{n+1} - t^n
+ *  \f]
+ *  and the Lagrange polynomials \f$ l_s(x) \f$ of these nodes, one gets
+ *   - BDF:           \f$ a_s = l_s^\prime(0) \f$ and \f$ b_0 = 1 \f$,
+ *   - Adams-Moulton: \f$ a_0 = 1, a_1 = -1 \f$ and
+ *                    \f$ b_s = \int_{-1}^0 l_s(x) dx \f$.
+ *
+ *  For equidistant nodes these are identical to the tabulated weights.
+ *  Since the weights refer to the current step size \f$ \Delta t^{n+1} \f$,
+ *  this value has to be passed as step size to base::time::ReactionTerms.
+ *
+ *  Other than the methods with fixed step size, this object has a state
+ *  (the sizes of the past steps) and therefore the assembly routines
+ *  base::time::computeReactionTerms, base::time::computeInertiaTerms and
+ *  base::time::computeResidualForceHistory take it as an optional argument.
+ *  A time loop has the structure
+ *  \code{.cpp}
+ *  base::time::VariableStep<2,base::time::BDF> method;
+ *  base::time::StepSizeController controller;
+ *  for ( ; time < finalTime; ) {
+ *      method.setStepSize( dt );
+ *      // Newton iterations with
+ *      //   computeReactionTerms<FTB,MSM>( ..., dt, step, true, method );
+ *      const double error = base::time::localErrorNorm( field, method, step,
+ *                                                      absTol, relTol );
+ *      if ( controller.accept( error ) ) {
+ *          method.acceptStep();
+ *          std::for_each( field.doFsBegin(), field.doFsEnd(),
+ *                         boost::bind( &DoF::pushHistory, _1 ) );
+ *          time += dt; step++;
+ *      }
+ *      // else: DoF histories unchanged, repeat with smaller step
+ *      dt = controller.nextStepSize( dt, error, method.order( step ) );
+ *  }
+ *  \endcode
+ *
+ *  \par Startup
+ *  As for the fixed step methods, the order is reduced during the first
+ *  steps such that only the available history is used.
+ *
+ *  \tparam ORDER  The (maximal) order of the method
+ *  \tparam METHOD Either base::time::BDF or base::time::AdamsMoulton
+ */
+template<unsigned ORDER, template<unsigned> class METHOD>
+class base::time::VariableStep
+{
+public:
+    //! Rules for the weight computation
+    typedef detail_::VariableRule<METHOD> Rule;
+
+    //! Maximal order of the method
+    static const unsigned maxOrder = ORDER;
+
+    //! For introspection
+    static const bool isImplicit = true;
+
+    //! Number of history steps required
+    static const unsigned numSteps = Rule::template NumSteps<ORDER>::value;
+
+    //! Number of stored step sizes, enough for error estimation
+    static const unsigned numStepSizes = ORDER + 2;
+
+    //! Quadrature and error constants are prepared up to order 6
+    STATIC_ASSERT_MSG( (ORDER >= 1) and (ORDER <= 6),
+                       "Order of variable step method not supported" );
+
+    //! Constructor with an optional initial step size
+    VariableStep( const double stepSize = 1.0 )
+        : stepSizes_( 1, stepSize )
+    { }
+
+    //! @name Step size management
+    //@{
+    //! Set the size of the current step \f$ \Delta t^{n+1} \f$
+    void setStepSize( const double stepSize )
+    {
+        VERIFY_MSG( stepSize > 0., "Step size must be positive" );
+        stepSizes_[0] = stepSize;
+    }
+
+    //! Size of the current step
+    double getStepSize() const { return stepSizes_[0]; }
+
+    //! Keep the current step size in the history and start a new step
+    void acceptStep()
+    {
+        stepSizes_.insert( stepSizes_.begin(), stepSizes_[0] );
+        if ( stepSizes_.size() > numStepSizes )
+            stepSizes_.resize( numStepSizes );
+    }
+
+    //! Number of available step sizes including the current one
+    unsigned numAvailableSteps() const
+    {
+        return static_cast<unsigned>( stepSizes_.size() );
+    }
+
+    /** Normalised time nodes \f$ x_s \f$ of the current step
+     *  \param[in]  num Number of nodes (at most numAvailableSteps()+1)
+     *  \param[out] x   Nodes \f$ x_0 = 0, x_1 = -1, \ldots \f$
+     */
+    void normalisedNodes( const unsigned num, std::vector<double>& x ) const
+    {
+        VERIFY_MSG( num <= stepSizes_.size() + 1, "Not enough step sizes" );
+        x.assign( num, 0. );
+        for ( unsigned s = 1; s < num; s++ )
+            x[s] = x[s-1] - stepSizes_[s-1] / stepSizes_[0];
+    }
+
+    //! Order used in the given step (reduced during startup)
+    unsigned order( const unsigned step ) const
+    {
+        // reduce further if not enough step sizes are available
+        unsigned q = Rule::order( maxOrder, step );
+        while ( (q > 1) and
+                (Rule::numNodes( q ) > this -> numAvailableSteps() + 1) ) q--;
+        return q;
+    }
+
+    //! Error constant of the method with given order and uniform steps
+    static double errorConstant( const unsigned q )
+    {
+        return Rule::errorConstant( q );
+    }
+
+    /** Error constant of the given step with the current step sizes.
+     *  For BDF, the constant follows from the interpolation error of the
+     *  nodes \f$ x_0, \ldots, x_q \f$, for Adams-Moulton the uniform
+     *  constant is used.
+     */
+    double stepErrorConstant( const unsigned step ) const
+    {
+        const unsigned q = this -> order( step );
+        std::vector<double> x;
+        this -> normalisedNodes( Rule::numNodes( q ), x );
+        return Rule::errorConstant( x, q );
+    }
+    //@}
+
+    //! @name Interface of base::time::MultiStep
+    //@{
+    //! Weight for the system mass matrix
+    double systemMassWeight( const unsigned step ) const
+    {
+        std::vector<double> lhs, rhs;
+        this -> weights_( step, lhs, rhs );
+        return lhs[0] / rhs[0];
+    }
+
+    //! Weights for the reaction terms
+    void reactionWeights( const unsigned step,
+                          std::vector<double>& weights ) const
+    {
+        std::vector<double> rhs;
+        this -> weights_( step, weights, rhs );
+        for ( unsigned s = 0; s < weights.size(); s++ )
+            weights[s] /= rhs[0];
+    }
+
+    //! Weights for the force terms
+    void forceWeights( const unsigned step,
+                       std::vector<double>& weights ) const
+    {
+        std::vector<double> lhs, rhs;
+        this -> weights_( step, lhs, rhs );
+        weights.resize( rhs.size() - 1 );
+        for ( unsigned s = 0; s < weights.size(); s++ )
+            weights[s] = rhs[s+1] / rhs[0];
+    }
+
+    //! Weights for the derivative computation
+    void derivativeWeights( const unsigned step,
+                            std::vector<double>& weights ) const
+    {
+        std::vector<double> rhs;
+        this -> weights_( step, weights, rhs );
+    }
+    //@}
+
+private:
+    //! Compute LHS and RHS weights for the current step sizes
+    void weights_( const unsigned step,
+                   std::vector<double>& lhs, std::vector<double>& rhs ) const
+    {
+        const unsigned q = this -> order( step );
+        std::vector<double> x;
+        this -> normalisedNodes( Rule::numNodes( q ), x );
+        Rule::lhsWeights( x, q, lhs );
+        Rule::rhsWeights( x, q, rhs );
+    }
+
+private:
+    //! Current step size followed by the past step sizes
+    std::vector<double> stepSizes_;
+};
+
+#endif
@@ -126,12 +126,49 @@ namespace base{
                 FIELDELEMENT::DegreeOfFreedom::nHist;
 
             // use BDF for approximation of the time derivative 
-            std::vector<double> bdfWeights;
-            base::time::BDF<evalOrder>::derivativeWeights( step, bdfWeights );
+            return evaluateTimeDerivative( geomElemPtr, fieldElemPtr, xi,
+                                           stepSize, step,
+                                           base::time::BDF<evalOrder>() );
+        }
+
+        //----------------------------------------------------------------------
+        /** Evaluate the first time derivative of a field with a given method.
+         *  Same as above, but the weights are provided by the derivativeWeights
+         *  of the given method object. This is needed for methods with a state,
+         *  like base::time::VariableStep, in which case stepSize has to be the
+         *  size of the current step.
+         *  \tparam GEOMELEMENT  Type of geometry element
+         *  \tparam FIELDELEMENT Type of field element
+         *  \tparam MSM          Type of multi-step method
+         *  \param[in] geomElemPtr  Pointer to geometry element
+         *  \param[in] fieldElemPtr Pointer to field element
+         *  \param[in] xi           Local evaluation coordinate
+         *  \param[in] stepSize     Size of the time step
+         *  \param[in] step         Number of step (needed for the startup)
+         *  \param[in] method       Multi-step method object
+         *  \return                 Approximate time derivative of the field
+         */
+        template<typename GEOMELEMENT, typename FIELDELEMENT, typename MSM>
+        typename base::Vector<FIELDELEMENT::DegreeOfFreedom::size,
+                                  base::number>::Type
+        evaluateTimeDerivative( const GEOMELEMENT*  geomElemPtr,
+                                const FIELDELEMENT* fieldElemPtr,
+                                const typename FIELDELEMENT::FEFun::VecDim& xi,
+                                const double stepSize, 
+                                const unsigned step,
+                                const MSM& method )
+        {
+            // number of available history terms
+            static const unsigned nHist = FIELDELEMENT::DegreeOfFreedom::nHist;
+
+            std::vector<double> weights;
+            method.derivativeWeights( step, weights );
+            VERIFY_MSG( weights.size() <= nHist+1,
+                        "History storage of DoFs too small" );
             
             // divide by step size
-            for ( unsigned s = 0; s < bdfWeights.size(); s++ )
-                bdfWeights[s] /= stepSize;
+            for ( unsigned s = 0; s < weights.size(); s++ )
+                weights[s] /= stepSize;
 
             // initialise result with zero
             typename base::Vector<FIELDELEMENT::DegreeOfFreedom::size,
@@ -141,10 +178,10 @@ namespace base{
 
             // make recursive call
             detail_::WeightedFieldValue<GEOMELEMENT,FIELDELEMENT,
-                                        evalOrder>::apply( geomElemPtr,
-                                                           fieldElemPtr,
-                                                           xi, bdfWeights,
-                                                           result );
+                                        nHist>::apply( geomElemPtr,
+                                                       fieldElemPtr,
+                                                       xi, weights,
+                                                       result );
 
             return result;
         }
@@ -0,0 +1,120 @@
+//------------------------------------------------------------------------------
+// <preamble>
+// </preamble>
+//------------------------------------------------------------------------------
+
+//! @file   localError.hpp
+//! @author agent
+//! @date   2026
+
+#ifndef base_time_localerror_hpp
+#define base_time_localerror_hpp
+
+//------------------------------------------------------------------------------
+// std includes
+#include <vector>
+#include <algorithm>
+#include <cmath>
+// base/time includes
+#include <base/time/VariableStep.hpp>
+
+//------------------------------------------------------------------------------
+namespace base{
+    namespace time{
+
+        //----------------------------------------------------------------------
+        /** Estimate of the local truncation error of a time step.
+         *  After the solution \f$ y^{n+1} \f$ of the current step has been
+         *  computed, the stored history \f$ y^n, \ldots, y^{n+1-k} \f$ of the
+         *  degrees of freedom is extrapolated to \f$ t^{n+1} \f$ giving the
+         *  predictor \f$ y_P^{n+1} \f$. Following Milne's device, the local
+         *  error of the method with error constant \f$ C \f$ is then
+         *  \f[
+         *      e = \frac{C}{C + C_P} ( y^{n+1} - y_P^{n+1} )
+         *  \f]
+         *  with the error constant \f$ C_P \f$ of the extrapolation. Both
+         *  constants are computed for the actual step sizes. The
+         *  returned value is the weighted root-mean-square norm
+         *  \f[
+         *      \| e \| = \sqrt{ \frac{1}{N} \sum_i
+         *      \left( \frac{e_i}{\tau_a + \tau_r |y_i^{n+1}|} \right)^2 }
+         *  \f]
+         *  over all active components of the field, such that the step is
+         *  acceptable for \f$ \| e \| \le 1 \f$.
+         *
+         *  The extrapolation uses \f$ k = \min(q+1, H) \f$ history values,
+         *  where \f$ q \f$ is the current order of the method and \f$ H \f$
+         *  the history storage of the DoFs. For \f$ k = q+1 \f$ the estimate
+         *  is of the same order as the local error, i.e. the DoFs should store
+         *  one more history value than the method itself requires. Otherwise
+         *  the error is overestimated which leads to smaller steps.
+         *
+         *  \tparam FIELD  Type of field
+         *  \tparam METHOD Variable step method, see base::time::VariableStep
+         *  \param[in] field   Field with current solution and history
+         *  \param[in] method  Method with step size history
+         *  \param[in] step    Number of the current step
+         *  \param[in] absTol  Absolute tolerance \f$ \tau_a \f$
+         *  \param[in] relTol  Relative tolerance \f$ \tau_r \f$
+         *  \return            Scaled norm of the local error estimate
+         */
+        template<typename FIELD, typename METHOD>
+        double localErrorNorm( const FIELD&   field,
+                               const METHOD&  method,
+                               const unsigned step,
+                               const double   absTol,
+                               const double   relTol )
+        {
+            typedef typename FIELD::DegreeOfFreedom DoF;
+
+            // no history, no estimate
+            const unsigned q = method.order( step );
+            const unsigned nHist = DoF::nHist;
+            const unsigned k = std::min( std::min( q+1, nHist ),
+                                         std::min( step+1,
+                                                   method.numAvailableSteps() ) );
+            if ( k == 0 ) return 0.;
+
+            // extrapolation from the nodes x_1,...,x_k to x_0 = 0
+            std::vector<double> x;
+            method.normalisedNodes( k+1, x );
+            std::vector<double> c( k+1, 0. );
+            double errorConstantP = 1.;
+            for ( unsigned s = 1; s <= k; s++ ) {
+                c[s] = detail_::lagrangeValue( x, 1, k+1, s, 0. );
+                errorConstantP *= -x[s] / static_cast<double>( s );
+            }
+
+            // Milne's factor
+            const double errorConstant = method.stepErrorConstant( step );
+            const double factor =
+                errorConstant / ( errorConstant + errorConstantP );
+
+            // weighted RMS norm over all active components
+            double sum = 0.;
+            std::size_t num = 0;
+            typename FIELD::DoFPtrConstIter doFIter = field.doFsBegin();
+            typename FIELD::DoFPtrConstIter doFEnd  = field.doFsEnd();
+            for ( ; doFIter != doFEnd; ++doFIter ) {
+                for ( unsigned d = 0; d < DoF::size; d++ ) {
+                    if ( not (*doFIter) -> isActive( d ) ) continue;
+
+                    const double y = (*doFIter) -> getValue( d );
+                    double yP = 0.;
+                    for ( unsigned s = 1; s <= k; s++ )
+                        yP += c[s] * (*doFIter) -> getHistoryValue( s, d );
+
+                    const double e = factor * ( y - yP ) /
+                        ( absTol + relTol * std::abs( y ) );
+                    sum += e * e;
+                    num++;
+                }
+            }
+
+            return ( num > 0 ? std::sqrt( sum / static_cast<double>( num ) ) : 0. );
+        }
+
+    }
+}
+
+#endif
@@ -0,0 +1,80 @@
+#include <vector>
+#include <cmath>
+#include <boost/test/minimal.hpp>
+
+#include <base/dof/DegreeOfFreedom.hpp>
+#include <base/dof/Field.hpp>
+#include <base/time/VariableStep.hpp>
+#include <base/time/localError.hpp>
+
+//! \cond SKIPDOX
+// minimal element type which only provides the DoF type to the field
+struct Element
+{
+    typedef base::dof::DegreeOfFreedom<1,7> DegreeOfFreedom;
+    void setID( const std::size_t ) { }
+};
+
+typedef base::dof::Field<Element> Field;
+
+// exact solution of y' = lambda y, y(0) = 1
+const double lambda = -2.0;
+double exact( const double t ) { return std::exp( lambda * t ); }
+
+/** Ratio of the estimated and the true local error of one step.
+ *  The history holds the exact solution at the times given by the step
+ *  sizes, the current value is the result of one step of the method.
+ */
+template<typename METHOD>
+double errorRatio( const unsigned step, const double h )
+{
+    METHOD method( h );
+    for ( unsigned s = 0; s < step + 1; s++ ) {
+        // some variation of the step size
+        method.setStepSize( h * ( 1. + 0.3 * std::sin( 1. + s ) ) );
+        if ( s < step ) method.acceptStep();
+    }
+    const double dt = method.getStepSize();
+
+    // times t^{n+1-s}
+    std::vector<double> x;
+    method.normalisedNodes( method.numAvailableSteps() + 1, x );
+    const double t = 1.0;
+
+    Field field;
+    field.addDoFs( 1 );
+    Field::DegreeOfFreedom* doF = field.doFPtr( 0 );
+    for ( unsigned s = 1; s < x.size(); s++ )
+        doF -> setHistoryValue( s, 0, exact( t + dt * x[s] ) );
+
+    // one BDF step: sum_s a_s y^{n+1-s} / dt = lambda y^{n+1}
+    std::vector<double> a;
+    method.derivativeWeights( step, a );
+    double rhs = 0.;
+    for ( unsigned s = 1; s < a.size(); s++ )
+        rhs -= a[s] * doF -> getHistoryValue( s, 0 ) / dt;
+    const double y = rhs / ( a[0] / dt - lambda );
+    doF -> setValue( 0, y );
+
+    const double estimate =
+        base::time::localErrorNorm( field, method, step, 1.0, 0.0 );
+    return estimate / std::abs( exact( t ) - y );
+}
+
+int test_main( int, char *[] )            
+{
+    // the variable constants reduce to the uniform ones
+    base::time::VariableStep<3,base::time::BDF> uniform( 0.1 );
+    for ( unsigned s = 0; s < 4; s++ ) uniform.acceptStep();
+    BOOST_CHECK( std::abs( uniform.stepErrorConstant( 5 ) - 3./22. ) < 1.e-14 );
+
+    // the estimate is close to the true error for all orders
+    const double h = 1.e-2;
+    BOOST_CHECK( std::abs( errorRatio<base::time::VariableStep<1,base::time::BDF> >( 5, h ) - 1. ) < 0.05 );
+    BOOST_CHECK( std::abs( errorRatio<base::time::VariableStep<2,base::time::BDF> >( 5, h ) - 1. ) < 0.05 );
+    BOOST_CHECK( std::abs( errorRatio<base::time::VariableStep<3,base::time::BDF> >( 5, h ) - 1. ) < 0.05 );
+    BOOST_CHECK( std::abs( errorRatio<base::time::VariableStep<4,base::time::BDF> >( 6, h ) - 1. ) < 0.05 );
+
+    return 0;
+}
+//! \endcond
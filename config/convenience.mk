@@ -8,12 +8,21 @@ SOLVER   ?= EIGEN
 APPFLAGS ?=
 NTHREADS ?= 1
 VTK      ?= NO
+MPI      ?= NO
+PROFILE  ?= NO
 
 # compile/link executables and flags
 SHELL = /bin/bash
 CXX   = $(CPLUSPLUS)
 CC    = $(CPLUSPLUS)
 
+# MPI: compile and link with the wrapper of the MPI installation
+MPICPLUSPLUS ?= mpicxx
+ifeq ($(strip $(MPI)),YES)
+	CXX = $(MPICPLUSPLUS)
+	CC  = $(MPICPLUSPLUS)
+endif
+
 # includes
 INCLUDES ?=
 INCLUDES += $(SYSINCLUDES)
@@ -34,6 +43,16 @@ else
 	LDFLAGS  += $(RELLDFLAGS)
 endif
 
+# only the C interface of MPI is used, skip the deprecated C++ bindings
+ifeq ($(strip $(MPI)),YES)
+	CPPFLAGS += -DOMPI_SKIP_MPICXX -DMPICH_SKIP_MPICXX
+endif
+
+# profiling of the regions marked with PROFILE_REGION (see base/auxi/Profiler.hpp)
+ifeq ($(strip $(PROFILE)),YES)
+	CPPFLAGS += -DPROFILING
+endif
+
 ################################################################################
 # set flags depending on solver choice
 
@@ -11,10 +11,13 @@
 #define galerkinleastsquares_hpp
 
 //------------------------------------------------------------------------------
+// std includes
+#include <vector>
 // base includes
 #include <base/geometry.hpp>
 #include <base/linearAlgebra.hpp>
 #include <base/mesh/Size.hpp>
+#include <base/mesh/GeometryCache.hpp>
 // base/aux includes
 #include <base/auxi/EqualPointers.hpp>
 // base/post includes
@@ -36,6 +39,64 @@ namespace fluid{
         template<typename FIELDTUPLE, typename EVALUATEPOLICY> class BodyForce1;
         template<typename FIELDTUPLE, typename EVALUATEPOLICY> class BodyForce2;
 
+        //----------------------------------------------------------------------
+        namespace detail_{
+
+            /** Flag for shape functions with a vanishing Hessian.
+             *  Linear functions on simplex elements (see base::mesh::IsAffine)
+             *  have a vanishing parametric Hessian and, if the geometry is
+             *  affine too, the terms due to the derivatives of the tangent
+             *  vectors vanish as well. Then all stabilisation terms with a
+             *  second derivative of this function are zero and the kernels
+             *  return without any evaluation.
+             *  \tparam GEOMELEMENT Type of geometry element
+             *  \tparam FEELEMENT   Type of field element
+             */
+            template<typename GEOMELEMENT, typename FEELEMENT>
+            struct HessianVanishes
+            {
+                static const bool value =
+                    base::mesh::IsAffine<typename GEOMELEMENT::GeomFun>::value and
+                    base::mesh::IsAffine<typename FEELEMENT::FEFun>::value;
+            };
+
+            /** Laplacians of the shape functions, i.e. the traces of their
+             *  Hessians, computed once per evaluation point.
+             */
+            template<typename HESSIAN>
+            void laplacians( const std::vector<HESSIAN>& hessians,
+                             std::vector<double>& result )
+            {
+                result.resize( hessians.size() );
+                for ( std::size_t M = 0; M < hessians.size(); M++ )
+                    result[M] = hessians[M].trace();
+            }
+
+            /** Divergence of the symmetric gradient applied to the shape
+             *  functions.
+             *  For a vector-valued function \f$ v = \phi e_i \f$ one gets
+             *  \f[
+             *     2 \nabla \cdot \varepsilon(\phi e_i) =
+             *       ( \nabla^2 \phi I + \nabla \otimes \nabla \phi ) e_i
+             *       =: S \, e_i
+             *  \f]
+             *  and the matrix \f$ S \f$ of every shape function is shared by
+             *  all blocks of the stabilisation (fluid::gls::StressDivergence,
+             *  fluid::gls::PressureGradient2 and fluid::gls::BodyForce1) instead
+             *  of re-assembling it from the Hessian for every matrix entry.
+             */
+            template<typename HESSIAN>
+            void stressDivergenceOperators( const std::vector<HESSIAN>& hessians,
+                                            std::vector<HESSIAN>& result )
+            {
+                result.resize( hessians.size() );
+                for ( std::size_t M = 0; M < hessians.size(); M++ ) {
+                    result[M] = hessians[M];
+                    result[M].diagonal().array() += hessians[M].trace();
+                }
+            }
+        }
+
 
         //----------------------------------------------------------------------
         // Computation of body force terms with given force function f(x)
@@ -149,6 +210,12 @@ namespace fluid{
  *  All these terms receive a global stabilisation mulitplier \f$ \alpha \f$, 
  *  some a boolean for the choice between GLS+ and GLS- options.
  *
+ *  The terms with second derivatives vanish for linear simplex elements
+ *  with an affine geometry and are skipped at compile time (see
+ *  detail_::HessianVanishes). Otherwise, the Laplacian and the operator of
+ *  the stress divergence are computed once per shape function and
+ *  evaluation point.
+ *
  */
 template<typename T>
 class fluid::gls::GalerkinLeastSquares
@@ -186,6 +253,11 @@ public:
 
     typedef typename base::Matrix<globalDim,globalDim>::Type        Hessian;
 
+    //! Term vanishes if test or trial functions have a vanishing Hessian
+    static const bool isVoid =
+        detail_::HessianVanishes<GeomElement,TestElement>::value or
+        detail_::HessianVanishes<GeomElement,TrialElement>::value;
+
     //! Constructor with form and test functions 
     StressDivergence( const double stabil,
                       const double viscosity,
@@ -201,6 +273,8 @@ public:
                            const double       weight,
                            base::MatrixD&     matrix ) const
     {
+        if ( isVoid ) return;
+
         // Extract element pointer from tuple
         const GeomElement*  geomEp  = fieldTuple.geomElementPtr();
         const TestElement*  testEp  = fieldTuple.testElementPtr();
@@ -234,37 +308,22 @@ public:
             (douglasWang_ ? 1.0 : -1.0) *
             stabil_ * viscosity_ * viscosity_ * h * h * detJ * weight;
         
+        // divergence of symmetric gradient of every shape function
+        std::vector<Hessian> testS, trialS;
+        detail_::stressDivergenceOperators( testHessX, testS );
+        if ( isBubnov ) trialS = testS;
+        else detail_::stressDivergenceOperators( trialHessX, trialS );
+
         //
         for ( unsigned M = 0; M < numRowBlocks; M ++ ) {
             for ( unsigned N = 0; N < numColBlocks; N ++ ) {
 
-                // dot-product of the laplacian of the shape functions
-                double laplaceTest  = 0.;
-                double laplaceTrial = 0.;
-                Hessian gradGrad = base::constantMatrix<globalDim,globalDim>( 0. );
-                
-                for ( unsigned k = 0; k < globalDim; k ++ ) {
-                    laplaceTest  +=  testHessX[M](k,k);
-                    laplaceTrial += trialHessX[N](k,k);
-
-                    for ( unsigned i = 0; i < globalDim; i++ ) {
-                        for ( unsigned j = 0; j < globalDim; j++ ) {
-                            gradGrad(i,j) += testHessX[M](k,i) * trialHessX[N](k,j);
-                        }
-                    }
-                }
+                // product of the operators applied to test and trial functions
+                const Hessian block = testS[M].transpose() * trialS[N];
 
-                // add to matrix block's diagonal entries
-                for ( unsigned i = 0; i < globalDim; i++ ) {
-                    for ( unsigned j = 0; j < globalDim; j++ ) {
-
-                        matrix( M*globalDim + i, N*globalDim + j ) +=
-                            scalar * ( (i==j? laplaceTest * laplaceTrial : 0.) +
-                                       laplaceTest * trialHessX[N](i,j) +
-                                       testHessX[M](i,j) * laplaceTrial +
-                                       gradGrad(i,j) );
-                    }
-                }
+                // add to matrix block
+                matrix.block( M*globalDim, N*globalDim,
+                              globalDim, globalDim ) += scalar * block;
             }
         }
 
@@ -304,6 +363,11 @@ public:
 
     typedef typename base::Matrix<globalDim,globalDim>::Type        Hessian;
 
+    //! Term vanishes if test or trial functions have a vanishing Hessian
+    static const bool isVoid =
+        detail_::HessianVanishes<GeomElement,TestElement>::value or
+        detail_::HessianVanishes<GeomElement,TrialElement>::value;
+
     //! Constructor with form and test functions 
     VectorLaplace( const double stabil,
                    const double viscosity,
@@ -319,6 +383,8 @@ public:
                            const double       weight,
                            base::MatrixD&     matrix ) const
     {
+        if ( isVoid ) return;
+
         // Extract element pointer from tuple
         const GeomElement*  geomEp  = fieldTuple.geomElementPtr();
         const TestElement*  testEp  = fieldTuple.testElementPtr();
@@ -352,23 +418,20 @@ public:
             (douglasWang_ ? 1.0 : -1.0) *
             stabil_ * viscosity_ * viscosity_ * h * h * detJ * weight;
         
+        // laplacians of the shape functions
+        std::vector<double> laplaceTest, laplaceTrial;
+        detail_::laplacians( testHessX, laplaceTest );
+        if ( isBubnov ) laplaceTrial = laplaceTest;
+        else detail_::laplacians( trialHessX, laplaceTrial );
+
         //
         for ( unsigned M = 0; M < numRowBlocks; M ++ ) {
             for ( unsigned N = 0; N < numColBlocks; N ++ ) {
 
-                // dot-product of the laplacian of the shape functions
-                double laplaceTest  = 0.;
-                double laplaceTrial = 0.;
-                
-                for ( unsigned k = 0; k < globalDim; k ++ ) {
-                    laplaceTrial += trialHessX[N](k,k);
-                    laplaceTest  +=  testHessX[M](k,k);
-                }
-
                 // add to matrix block's diagonal entries
+                const double entry = scalar * laplaceTest[M] * laplaceTrial[N];
                 for ( unsigned d = 0; d < globalDim; d++ )
-                    matrix( M*globalDim + d, N*globalDim + d ) +=
-                        scalar * laplaceTest * laplaceTrial;
+                    matrix( M*globalDim + d, N*globalDim + d ) += entry;
             }
         }
 
@@ -407,6 +470,10 @@ public:
 
     typedef typename base::Matrix<globalDim,globalDim>::Type        Hessian;
 
+    //! Term vanishes if the test functions have a vanishing Hessian
+    static const bool isVoid =
+        detail_::HessianVanishes<GeomElement,TestElement>::value;
+
     //! Constructor with form and test functions
     PressureGradient( const double stabil,
                       const double viscosity,
@@ -422,6 +489,8 @@ public:
                            const double       weight,
                            base::MatrixD&     matrix ) const
     {
+        if ( isVoid ) return;
+
         // Extract element pointer from tuple
         const GeomElement*  geomEp  = fieldTuple.geomElementPtr();
         const TestElement*  testEp  = fieldTuple.testElementPtr();
@@ -448,15 +517,16 @@ public:
         const double scalar =
             (douglasWang_? -1.0 : 1.0 ) * stabil_ * h * h * viscosity_ * detJ * weight;
 
+        // laplacians of the test functions
+        std::vector<double> laplaceTest;
+        detail_::laplacians( testHessX, laplaceTest );
+
         // compute entries
         for ( unsigned M = 0; M < numRowBlocks; M++ ) {
-            double laplaceTest = 0.;
-            for ( unsigned k = 0; k < globalDim; k++ ) laplaceTest += testHessX[M](k,k);
-
             for ( unsigned N = 0; N < numCols; N++ ) {
                 for ( unsigned i = 0; i < globalDim; i++ )
                     matrix( M*globalDim + i, N ) +=
-                        scalar * laplaceTest * trialGradX[N][i];
+                        scalar * laplaceTest[M] * trialGradX[N][i];
             }
         }
 
@@ -546,6 +616,10 @@ public:
 
     typedef typename base::Matrix<globalDim,globalDim>::Type        Hessian;
 
+    //! Term vanishes if the test functions have a vanishing Hessian
+    static const bool isVoid =
+        detail_::HessianVanishes<GeomElement,TestElement>::value;
+
     //! Constructor with form and test functions
     PressureGradient2( const double stabil,
                        const double viscosity,
@@ -561,6 +635,8 @@ public:
                            const double       weight,
                            base::MatrixD&     matrix ) const
     {
+        if ( isVoid ) return;
+
         // Extract element pointer from tuple
         const GeomElement*  geomEp  = fieldTuple.geomElementPtr();
         const TestElement*  testEp  = fieldTuple.testElementPtr();
@@ -587,23 +663,18 @@ public:
         const double scalar =
             (douglasWang_? -1.0 : 1.0 ) * stabil_ * h * h * viscosity_ * detJ * weight;
 
+        // divergence of symmetric gradient of the test functions
+        std::vector<Hessian> testS;
+        detail_::stressDivergenceOperators( testHessX, testS );
+
         // compute entries
         for ( unsigned M = 0; M < numRowBlocks; M++ ) {
-            double laplaceTest = 0.;
-            for ( unsigned k = 0; k < globalDim; k++ ) laplaceTest += testHessX[M](k,k);
-
             for ( unsigned N = 0; N < numCols; N++ ) {
 
-                GlobalVecDim aux = base::constantVector<globalDim>( 0. );
-                for ( unsigned i = 0; i < globalDim; i++ ) {
-                    for ( unsigned j = 0; j < globalDim; j++ ) {
-                        aux[i] += testHessX[M](i,j) * trialGradX[N][j];
-                    }
-                }
+                const GlobalVecDim aux = testS[M] * trialGradX[N];
                 
                 for ( unsigned i = 0; i < globalDim; i++ )
-                    matrix( M*globalDim + i, N ) +=
-                        scalar * (laplaceTest * trialGradX[N][i] + aux[i]);
+                    matrix( M*globalDim + i, N ) += scalar * aux[i];
             }
         }
 
@@ -791,6 +862,10 @@ class fluid::gls::BodyForce1
 
     typedef typename base::Matrix<globalDim,globalDim>::Type        Hessian;
 
+    //! Term vanishes if the test functions have a vanishing Hessian
+    static const bool isVoid =
+        detail_::HessianVanishes<GeomElement,TestElement>::value;
+
     //! How to evaluate the force function
     typedef typename EvaluatePolicy::Fun ForceFun;
     
@@ -816,6 +891,8 @@ class fluid::gls::BodyForce1
                      const double       weight,
                      base::VectorD&     result ) const
     {
+        if ( isVoid ) return;
+
         // extract test and trial elements from tuple
         const GeomElement* geomEp = fieldTuple.geomElementPtr();
         const TestElement* testEp = fieldTuple.testElementPtr();
@@ -838,22 +915,17 @@ class fluid::gls::BodyForce1
         const double scalar =
             (douglasWang_ ? -1.0 : 1.0) * viscosity_ * stabil_ * weight * detJ * h * h;
 
+        // divergence of symmetric gradient of the test functions
+        std::vector<Hessian> testS;
+        detail_::stressDivergenceOperators( testHessX, testS );
+
         // Loop over shape functions
         for ( unsigned M = 0; M < numFun; M++ ) {
-
-            double laplaceTest = 0.;
-            for ( unsigned k = 0; k < globalDim; k ++ )
-                laplaceTest  +=  testHessX[M](k,k);
-                    
             for ( unsigned i = 0; i < globalDim; i++ ) {
                 for ( unsigned j = 0; j < globalDim; j++ ) {
-
-                    result[ M*globalDim + i ]
-                        += scalar * ( (i==j ? laplaceTest : 0. ) +
-                                      testHessX[M](j,i) ) * f[j];
+                    result[ M*globalDim + i ] += scalar * testS[M](j,i) * f[j];
                 }
             }
-            
         }
                 
         return;
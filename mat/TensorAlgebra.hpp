@@ -11,6 +11,8 @@
 #define mat_tensoralgebra_hpp
 
 //------------------------------------------------------------------------------
+// boost includes
+#include <boost/array.hpp>
 // base includes
 #include <base/verify.hpp>
 #include <base/linearAlgebra.hpp>
@@ -0,0 +1,230 @@
+//------------------------------------------------------------------------------
+// <preamble>
+// </preamble>
+//------------------------------------------------------------------------------
+
+//! @file   TensorBatch.hpp
+//! @author agent
+//! @date   2026
+
+#ifndef mat_tensorbatch_hpp
+#define mat_tensorbatch_hpp
+
+//------------------------------------------------------------------------------
+// std includes
+#include <cmath>
+// Eigen includes
+#include <Eigen/Core>
+// mat includes
+#include <mat/TensorAlgebra.hpp>
+
+//------------------------------------------------------------------------------
+namespace mat{
+
+    //--------------------------------------------------------------------------
+    /** @name Batches of tensors in structure-of-arrays layout.
+     *  A batch holds the tensors of several material points, e.g. all
+     *  quadrature points of an element or of a group of elements. Row \f$ p \f$
+     *  corresponds to the \f$ p \f$-th point and every column to one tensor
+     *  component. Since the storage is column-major, a component is contiguous
+     *  for all points and the evaluation loops over the points vectorise.
+     *  A 2nd-order tensor \f$ A_{ij} \f$ is stored in column \f$ 3i+j \f$, a
+     *  symmetric one in Voigt ordering (see mat::Voigt) and the elasticity
+     *  tensor entry \f$ C_{IJ} \f$ (Voigt indices) in column \f$ 6I+J \f$.
+     */
+    //@{
+    typedef Eigen::Matrix<double,Eigen::Dynamic,9>  TensorBatch;
+    typedef Eigen::Matrix<double,Eigen::Dynamic,6>  SymTensorBatch;
+    typedef Eigen::Matrix<double,Eigen::Dynamic,36> ElastTensorBatch;
+    //@}
+
+    //--------------------------------------------------------------------------
+    //! @name Conversion between batches and single tensors
+    //@{
+
+    //! Store tensor A as p-th entry of the batch
+    inline void setTensor( TensorBatch& batch, const std::size_t p,
+                           const Tensor& A )
+    {
+        for ( unsigned i = 0; i < 3; i++ )
+            for ( unsigned j = 0; j < 3; j++ )
+                batch( p, 3*i+j ) = A( i, j );
+    }
+
+    //! Extract the p-th tensor from the batch
+    inline void getTensor( const TensorBatch& batch, const std::size_t p,
+                           Tensor& A )
+    {
+        for ( unsigned i = 0; i < 3; i++ )
+            for ( unsigned j = 0; j < 3; j++ )
+                A( i, j ) = batch( p, 3*i+j );
+    }
+
+    //! Store elasticity tensor C as p-th entry of the batch
+    inline void setElastTensor( ElastTensorBatch& batch, const std::size_t p,
+                                const ElastTensor& C )
+    {
+        for ( unsigned I = 0; I < 6; I++ )
+            for ( unsigned J = 0; J < 6; J++ )
+                batch( p, 6*I+J ) = C( I, J );
+    }
+
+    //! Extract the p-th elasticity tensor from the batch
+    inline void getElastTensor( const ElastTensorBatch& batch,
+                                const std::size_t p, ElastTensor& C )
+    {
+        for ( unsigned I = 0; I < 6; I++ )
+            for ( unsigned J = 0; J < 6; J++ )
+                C( I, J ) = batch( p, 6*I+J );
+    }
+    //@}
+
+    //--------------------------------------------------------------------------
+    //! @name Closed-form batch algebra
+    //@{
+
+    /** Right Cauchy-Green tensor \f$ C = F^T F \f$ and \f$ J = \det F \f$.
+     *  \param[in]  F   Batch of deformation gradients
+     *  \param[out] C   Batch of symmetric tensors (Voigt ordering)
+     *  \param[out] J   Determinants of F
+     */
+    inline void rightCauchyGreen( const TensorBatch& F,
+                                  SymTensorBatch& C, Eigen::VectorXd& J )
+    {
+        const std::size_t n = static_cast<std::size_t>( F.rows() );
+        C.resize( n, 6 );
+        J.resize( n );
+
+        const double* f[9];
+        for ( unsigned c = 0; c < 9; c++ ) f[c] = F.col( c ).data();
+        double* cc[6];
+        for ( unsigned c = 0; c < 6; c++ ) cc[c] = C.col( c ).data();
+        double* j = J.data();
+
+        for ( std::size_t p = 0; p < n; p++ ) {
+            const double f00 = f[0][p], f01 = f[1][p], f02 = f[2][p];
+            const double f10 = f[3][p], f11 = f[4][p], f12 = f[5][p];
+            const double f20 = f[6][p], f21 = f[7][p], f22 = f[8][p];
+
+            cc[0][p] = f00*f00 + f10*f10 + f20*f20;
+            cc[1][p] = f01*f01 + f11*f11 + f21*f21;
+            cc[2][p] = f02*f02 + f12*f12 + f22*f22;
+            cc[3][p] = f00*f01 + f10*f11 + f20*f21;
+            cc[4][p] = f00*f02 + f10*f12 + f20*f22;
+            cc[5][p] = f01*f02 + f11*f12 + f21*f22;
+
+            j[p] = f00 * (f11*f22 - f12*f21)
+                -  f01 * (f10*f22 - f12*f20)
+                +  f02 * (f10*f21 - f11*f20);
+        }
+    }
+
+    /** Inverse of symmetric tensors via the cofactors.
+     *  \param[in]  C     Batch of symmetric tensors (Voigt ordering)
+     *  \param[in]  detC  Their determinants
+     *  \param[out] Cinv  Batch of inverses (Voigt ordering)
+     */
+    inline void symmetricInverse( const SymTensorBatch& C,
+                                  const Eigen::VectorXd& detC,
+                                  SymTensorBatch& Cinv )
+    {
+        const std::size_t n = static_cast<std::size_t>( C.rows() );
+        Cinv.resize( n, 6 );
+
+        const double* c[6];
+        for ( unsigned k = 0; k < 6; k++ ) c[k] = C.col( k ).data();
+        double* ci[6];
+        for ( unsigned k = 0; k < 6; k++ ) ci[k] = Cinv.col( k ).data();
+        const double* d = detC.data();
+
+        for ( std::size_t p = 0; p < n; p++ ) {
+            const double c00 = c[0][p], c11 = c[1][p], c22 = c[2][p];
+            const double c01 = c[3][p], c02 = c[4][p], c12 = c[5][p];
+            const double invDet = 1. / d[p];
+
+            ci[0][p] = (c11*c22 - c12*c12) * invDet;
+            ci[1][p] = (c00*c22 - c02*c02) * invDet;
+            ci[2][p] = (c00*c11 - c01*c01) * invDet;
+            ci[3][p] = (c02*c12 - c01*c22) * invDet;
+            ci[4][p] = (c01*c12 - c02*c11) * invDet;
+            ci[5][p] = (c01*c02 - c00*c12) * invDet;
+        }
+    }
+
+    /** Expand a batch of symmetric tensors to the full storage.
+     *  \param[in]  A     Symmetric tensors (Voigt ordering)
+     *  \param[in]  scale Scaling factor for every point
+     *  \param[in]  shift Added to the diagonal for every point
+     *  \param[out] B     Full storage of \f$ scale \cdot A + shift \cdot I \f$
+     */
+    inline void expandSymmetric( const SymTensorBatch& A,
+                                 const Eigen::VectorXd& scale,
+                                 const Eigen::VectorXd& shift,
+                                 TensorBatch& B )
+    {
+        const std::size_t n = static_cast<std::size_t>( A.rows() );
+        B.resize( n, 9 );
+        for ( unsigned i = 0; i < 3; i++ ) {
+            for ( unsigned j = 0; j < 3; j++ ) {
+                const double* a = A.col( Voigt::apply( i, j ) ).data();
+                double* b = B.col( 3*i+j ).data();
+                if ( i == j )
+                    for ( std::size_t p = 0; p < n; p++ )
+                        b[p] = scale[p] * a[p] + shift[p];
+                else
+                    for ( std::size_t p = 0; p < n; p++ )
+                        b[p] = scale[p] * a[p];
+            }
+        }
+    }
+    //@}
+
+    //--------------------------------------------------------------------------
+    /** Voigt index pairs: the inverse of the map mat::Voigt.
+     *  \param[in]  I    Voigt index
+     *  \param[out] A,B  Corresponding index pair
+     */
+    inline void voigtPair( const unsigned I, unsigned& A, unsigned& B )
+    {
+        static const unsigned first[6]  = { 0, 1, 2, 0, 0, 1 };
+        static const unsigned second[6] = { 0, 1, 2, 1, 2, 2 };
+        A = first[I];
+        B = second[I];
+    }
+
+    //--------------------------------------------------------------------------
+    /** Batch evaluation by calls to the single-point material functions.
+     *  Fallback for materials without a closed-form batch implementation.
+     *  \param[in]  material  Material object
+     *  \param[in]  F         Batch of deformation gradients
+     *  \param[out] S         Batch of 2nd Piola-Kirchhoff stresses
+     *  \param[out] C         Batch of material elasticity tensors
+     */
+    template<typename MATERIAL>
+    void evaluatePointwise( const MATERIAL& material, const TensorBatch& F,
+                            TensorBatch* S, ElastTensorBatch* C )
+    {
+        const std::size_t n = static_cast<std::size_t>( F.rows() );
+        if ( S != NULL ) S -> resize( n, 9 );
+        if ( C != NULL ) C -> resize( n, 36 );
+
+        for ( std::size_t p = 0; p < n; p++ ) {
+            Tensor Fp;
+            getTensor( F, p, Fp );
+
+            if ( S != NULL ) {
+                Tensor Sp;
+                material.secondPiolaKirchhoff( Fp, Sp );
+                setTensor( *S, p, Sp );
+            }
+            if ( C != NULL ) {
+                ElastTensor Cp;
+                material.materialElasticityTensor( Fp, Cp );
+                setElastTensor( *C, p, Cp );
+            }
+        }
+    }
+
+}
+
+#endif
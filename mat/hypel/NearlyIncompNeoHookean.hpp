@@ -11,6 +11,7 @@
 #define mat_hypel_nearlyincompneohookean_hpp
 
 #include <mat/TensorAlgebra.hpp>
+#include <mat/TensorBatch.hpp>
 
 
 //------------------------------------------------------------------------------
@@ -51,6 +52,8 @@ public:
     //@{
     typedef mat::Tensor                     Tensor;
     typedef mat::ElastTensor                ElastTensor;
+    typedef mat::TensorBatch                TensorBatch;
+    typedef mat::ElastTensorBatch           ElastTensorBatch;
     //@}
     
     //! Construct with Lame parameters
@@ -200,6 +203,74 @@ public:
         
     }
 
+    //--------------------------------------------------------------------------
+    /** Iso-choric stresses and elasticity tensors for a batch of points.
+     *  Same expressions as in secondPiolaKirchhoff() and
+     *  materialElasticityTensor(), but with the closed-form inverse of
+     *  \f$ C \f$ computed once per point for all points of the batch.
+     *  \param[in]  F    Batch of deformation gradients
+     *  \param[out] S    Batch of 2nd Piola-Kirchhoff stresses (if not NULL)
+     *  \param[out] elC  Batch of elasticity tensors (if not NULL)
+     */
+    void evaluateBatch( const TensorBatch& F, TensorBatch* S,
+                        ElastTensorBatch* elC ) const
+    {
+        const std::size_t n = static_cast<std::size_t>( F.rows() );
+
+        // Cauchy-Green tensor, its inverse and J = det F
+        mat::SymTensorBatch CG, Cinv;
+        Eigen::VectorXd J;
+        mat::rightCauchyGreen( F, CG, J );
+        const Eigen::VectorXd detC = J.cwiseProduct( J );
+        mat::symmetricInverse( CG, detC, Cinv );
+
+        // mu J^{-2/3} and tr C
+        Eigen::VectorXd fac( n ), trC( n );
+        for ( std::size_t p = 0; p < n; p++ ) {
+            fac[p] = mu_ * std::pow( J[p], -2./3. );
+            trC[p] = CG(p,0) + CG(p,1) + CG(p,2);
+        }
+
+        // S = mu J^{-2/3} ( I - tr C / 3 C^{-1} )
+        if ( S != NULL ) {
+            const Eigen::VectorXd scale = -fac.cwiseProduct( trC ) / 3.;
+            mat::expandSymmetric( Cinv, scale, fac, *S );
+        }
+
+        if ( elC == NULL ) return;
+        elC -> resize( n, 36 );
+
+        for ( unsigned I = 0; I < 6; I++ ) {
+            unsigned A, B;
+            mat::voigtPair( I, A, B );
+            const double deltaAB = (A==B? 1. : 0.);
+            
+            for ( unsigned K = 0; K < 6; K++ ) {
+                unsigned C, D;
+                mat::voigtPair( K, C, D );
+                const double deltaCD = (C==D? 1. : 0.);
+
+                const double* ciAB = Cinv.col( I ).data();
+                const double* ciCD = Cinv.col( K ).data();
+                const double* ciAC = Cinv.col( mat::Voigt::apply( A, C ) ).data();
+                const double* ciBD = Cinv.col( mat::Voigt::apply( B, D ) ).data();
+                const double* ciAD = Cinv.col( mat::Voigt::apply( A, D ) ).data();
+                const double* ciBC = Cinv.col( mat::Voigt::apply( B, C ) ).data();
+                double* entry = elC -> col( 6*I+K ).data();
+
+                for ( std::size_t p = 0; p < n; p++ ) {
+                    const double iABCD =
+                        0.5 * ( ciAC[p] * ciBD[p] + ciAD[p] * ciBC[p] );
+                    entry[p] = 2. * fac[p] *
+                        ( trC[p]/3. * iABCD -
+                          1.0/3. * deltaAB * ciCD[p] -
+                          1.0/3. * ciAB[p] * deltaCD +
+                          trC[p]/9. * ciAB[p] * ciCD[p] );
+                }
+            }
+        }
+    }
+
     //--------------------------------------------------------------------------
     /** Ratio of first to second derivative of the volume energy.
      *  Returns
@@ -11,6 +11,7 @@
 #define mat_hypel_neohookeancompressible_hpp
 
 #include <mat/TensorAlgebra.hpp>
+#include <mat/TensorBatch.hpp>
 
 //------------------------------------------------------------------------------
 namespace mat{
@@ -31,6 +32,8 @@ public:
     //@{
     typedef mat::Tensor                     Tensor;
     typedef mat::ElastTensor                ElastTensor;
+    typedef mat::TensorBatch                TensorBatch;
+    typedef mat::ElastTensorBatch           ElastTensorBatch;
     //@}
     
     //! Construct with Lame parameters
@@ -223,6 +226,63 @@ public:
         return;
     }
 
+    //--------------------------------------------------------------------------
+    /** Stresses and elasticity tensors for a batch of deformation gradients.
+     *  Same expressions as in secondPiolaKirchhoff() and
+     *  materialElasticityTensor(), but \f$ C^{-1} \f$ and \f$ \log J \f$ are
+     *  computed only once per point, in closed form and for all points of the
+     *  batch at a time.
+     *  \param[in]  F    Batch of deformation gradients
+     *  \param[out] S    Batch of 2nd Piola-Kirchhoff stresses (if not NULL)
+     *  \param[out] elC  Batch of elasticity tensors (if not NULL)
+     */
+    void evaluateBatch( const TensorBatch& F, TensorBatch* S,
+                        ElastTensorBatch* elC ) const
+    {
+        const std::size_t n = static_cast<std::size_t>( F.rows() );
+
+        // Cauchy-Green tensor, its inverse and J = det F
+        mat::SymTensorBatch CG, Cinv;
+        Eigen::VectorXd J;
+        mat::rightCauchyGreen( F, CG, J );
+        const Eigen::VectorXd detC = J.cwiseProduct( J );
+        mat::symmetricInverse( CG, detC, Cinv );
+
+        // factor lambda log J - mu
+        Eigen::VectorXd fac( n );
+        for ( std::size_t p = 0; p < n; p++ )
+            fac[p] = lambda_ * std::log( J[p] ) - mu_;
+
+        // S = (lambda log J - mu) C^{-1} + mu I
+        if ( S != NULL )
+            mat::expandSymmetric( Cinv, fac,
+                                  Eigen::VectorXd::Constant( n, mu_ ), *S );
+
+        if ( elC == NULL ) return;
+        elC -> resize( n, 36 );
+
+        for ( unsigned I = 0; I < 6; I++ ) {
+            unsigned A, B;
+            mat::voigtPair( I, A, B );
+            for ( unsigned K = 0; K < 6; K++ ) {
+                unsigned C, D;
+                mat::voigtPair( K, C, D );
+
+                const double* ciAB = Cinv.col( I ).data();
+                const double* ciCD = Cinv.col( K ).data();
+                const double* ciAC = Cinv.col( mat::Voigt::apply( A, C ) ).data();
+                const double* ciBD = Cinv.col( mat::Voigt::apply( B, D ) ).data();
+                const double* ciAD = Cinv.col( mat::Voigt::apply( A, D ) ).data();
+                const double* ciBC = Cinv.col( mat::Voigt::apply( B, C ) ).data();
+                double* entry = elC -> col( 6*I+K ).data();
+
+                // note that mu - lambda log J = -fac
+                for ( std::size_t p = 0; p < n; p++ )
+                    entry[p] = lambda_ * ciAB[p] * ciCD[p] -
+                        fac[p] * ( ciAC[p] * ciBD[p] + ciAD[p] * ciBC[p] );
+            }
+        }
+    }
     
 private:
     //! @name Lame parameters
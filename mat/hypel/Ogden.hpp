@@ -15,6 +15,7 @@
 #include <boost/math/special_functions/cbrt.hpp>
 // material includes
 #include <mat/TensorAlgebra.hpp>
+#include <mat/TensorBatch.hpp>
 
 //------------------------------------------------------------------------------
 namespace mat{
@@ -40,6 +41,8 @@ public:
     //@{
     typedef mat::Tensor                     Tensor;
     typedef mat::ElastTensor                ElastTensor;
+    typedef mat::TensorBatch                TensorBatch;
+    typedef mat::ElastTensorBatch           ElastTensorBatch;
     //@}
 
     //! Array of material parameters
@@ -146,60 +149,22 @@ public:
      */
     void secondPiolaKirchhoff( const Tensor& F, Tensor& S ) const
     {
-        // compute Right Cauchy-Green deformation tensor
-        Tensor C;
-        mat::rightCauchyGreen( F, C );
-
-        // get eigen-pairs of C
-        Tensor eVec;
-        const Vector eVal = base::eigenPairs( C, eVec );
-        
-
-        // compute determinant of F and its logarithm
-        const double J = mat::determinant( F );
-
-        // scale of the stretches
-        const double scale = boost::math::cbrt( 1./ J );
-
-        // compute principal stretches
-        boost::array<double,3> princStretch;
-        for ( unsigned a = 0; a < 3; a++ ) {
-            princStretch[a] = scale * std::sqrt( eVal[a] );
-        }
-        
-        // get all partial derivatives
-        boost::array<double,3> partialEnergyDerivatives;
-        double sumPartial = 0.;
-        for ( unsigned a = 0; a < 3; a++ ) {
-            partialEnergyDerivatives[a] =
-                this -> partialPsiIsoPartialLambdaBar_( princStretch[a] );
-            sumPartial += partialEnergyDerivatives[a];
-        }
-
-        // computation via principal components and directions
-        S = Tensor::Zero();
-        for ( unsigned a = 0; a < 3; a ++ ) {
-            const double SisoA =
-                (1./eVal[a]) * (partialEnergyDerivatives[a] - sumPartial/3.);
-            S += SisoA * (eVec.col(a) * (eVec.col(a)).transpose());
-        }
-        
-
+        Principal_ principal;
+        this -> principal_( F, false, principal );
+        this -> stress_( principal, S );
     }
 
-    
-public:
     //--------------------------------------------------------------------------
     /** The iso-choric elasticity tensor in material description.
      *  \f[
      *       C^{iso} = A_{ab}   N_a \otimes N_a \otimes N_b \otimes N_b +
-     *                 B_{ab} ( N_a \otimes N_b \otimes N_b \otimes N_a +
-     *                          N_a \otimes N_b \otimes N_a \otimes N_b )
+     *                 B_{ab} ( N_a \otimes N_b \otimes N_a \otimes N_b +
+     *                          N_a \otimes N_b \otimes N_b \otimes N_a )
      *  \f]
      *  with the components
      *  \f{eqnarray*}{
-     *    A_{ab} &=& \frac{1}{\lambda_b}{\partial S^{iso}_a}{\partial \lambda_b}
-     *           \cr
+     *    A_{ab} &=& \frac{1}{\lambda_b}
+     *               \frac{\partial S^{iso}_a}{\partial \lambda_b} \cr
      *    B_{ab} &=& (1-\delta_{ab})
      *                 \frac{S^{iso}_b - S^{iso}_a}{\lambda_b^2 - \lambda_a^2}
      *  \f}
@@ -209,6 +174,7 @@ public:
      *             \mu_p \alpha_p  \left(
      *          C_{ab}^p + \frac{1}{9} \sum_{c=1}^3 \bar{\lambda}_c^{\alpha_p}
      *                            \right)
+     *           - 2 \delta_{ab} \frac{S^{iso}_a}{\lambda_a^2}
      *  \f]
      *  with
      *  \f{eqnarray*}{
@@ -231,14 +197,91 @@ public:
      *  \param[out] elC  Elasticity tensor
      */
     void materialElasticityTensor( const Tensor& F, ElastTensor& elC ) const
+    {
+        Principal_ principal;
+        this -> principal_( F, true, principal );
+        this -> elasticity_( principal, elC );
+    }
+
+    //--------------------------------------------------------------------------
+    /** Stress and elasticity tensor from a single spectral decomposition.
+     *  Equivalent to the calls of secondPiolaKirchhoff() and
+     *  materialElasticityTensor(), which decompose \f$ C \f$ each.
+     *  \param[in]  F    Deformation gradient
+     *  \param[out] S    2nd Piola-Kirchhoff stress tensor (iso-choric part)
+     *  \param[out] elC  Elasticity tensor
+     */
+    void stressAndElasticityTensor( const Tensor& F, Tensor& S,
+                                    ElastTensor& elC ) const
+    {
+        Principal_ principal;
+        this -> principal_( F, true, principal );
+        this -> stress_(     principal, S );
+        this -> elasticity_( principal, elC );
+    }
+
+    //--------------------------------------------------------------------------
+    /** Iso-choric stresses and elasticity tensors for a batch of points.
+     *  The spectral decomposition is carried out once per point.
+     *  \param[in]  F    Batch of deformation gradients
+     *  \param[out] S    Batch of 2nd Piola-Kirchhoff stresses (if not NULL)
+     *  \param[out] elC  Batch of elasticity tensors (if not NULL)
+     */
+    void evaluateBatch( const TensorBatch& F, TensorBatch* S,
+                        ElastTensorBatch* elC ) const
+    {
+        const std::size_t n = static_cast<std::size_t>( F.rows() );
+        if ( S   != NULL ) S   -> resize( n, 9 );
+        if ( elC != NULL ) elC -> resize( n, 36 );
+
+        for ( std::size_t p = 0; p < n; p++ ) {
+            Tensor Fp;
+            mat::getTensor( F, p, Fp );
+
+            Principal_ principal;
+            this -> principal_( Fp, (elC != NULL), principal );
+
+            if ( S != NULL ) {
+                Tensor Sp;
+                this -> stress_( principal, Sp );
+                mat::setTensor( *S, p, Sp );
+            }
+            if ( elC != NULL ) {
+                ElastTensor Cp;
+                this -> elasticity_( principal, Cp );
+                mat::setElastTensor( *elC, p, Cp );
+            }
+        }
+    }
+    
+private:
+    //--------------------------------------------------------------------------
+    //! Principal values and directions shared by stress and elasticity
+    struct Principal_
+    {
+        Tensor directions; //!< Principal directions as columns
+        Vector lambda2;    //!< Squared principal stretches, eigenvalues of C
+        Vector S;          //!< Principal stresses \f$ S^{iso}_a \f$
+        Tensor A;          //!< Components \f$ A_{ab} \f$
+        Tensor B;          //!< Components \f$ B_{ab} \f$
+    };
+
+    //--------------------------------------------------------------------------
+    /** Spectral decomposition of \f$ C \f$ and principal components.
+     *  \param[in]  F          Deformation gradient
+     *  \param[in]  tangent    Flag for the computation of A and B
+     *  \param[out] principal  Result
+     */
+    void principal_( const Tensor& F, const bool tangent,
+                     Principal_& principal ) const
     {
         // compute Right Cauchy-Green deformation tensor
         Tensor C;
         mat::rightCauchyGreen( F, C );
 
         // get eigen-pairs of C
-        Tensor eVec;
-        const Vector eVal = base::eigenPairs( C, eVec );
+        const Vector& eVal = principal.lambda2 =
+            base::eigenPairs( C, principal.directions );
 
         // compute determinant of F and its logarithm
         const double J = mat::determinant( F );
@@ -262,72 +305,83 @@ public:
         }
 
         // compute components of S in principal directions
-        Vector SisoPrinc;
-        // go through principal directions
         for ( unsigned a = 0; a < 3; a++ ) {
-            SisoPrinc[a] = (1./eVal[a]) * ( partialEnergyDerivatives[a] - sumPartial/3.);
+            principal.S[a] =
+                (1./eVal[a]) * ( partialEnergyDerivatives[a] - sumPartial/3.);
+        }
+
+        if ( not tangent ) return;
+
+        // powers of the stretches and their sums
+        boost::array<boost::array<double,3>,nParam> stretchPower;
+        boost::array<double,nParam> sumPower;
+        for ( unsigned p = 0; p < nParam; p++ ) {
+            sumPower[p] = 0.;
+            for ( unsigned c = 0; c < 3; c++ ) {
+                stretchPower[p][c] = std::pow( princStretch[c], alpha_[p] );
+                sumPower[p] += stretchPower[p][c];
+            }
         }
 
         // compute partial derivatives of S in principal directions
-        Tensor partialSisoPrinc; // components A_{ab} above
-        
-        // go through principal directions
         for ( unsigned a = 0; a < 3; a++ ) {
             for ( unsigned b = 0; b < 3; b++ ) {
                 const double factor = 1./eVal[a]/eVal[b];
 
                 double outerSum = 0.;
                 for ( unsigned p = 0; p < nParam; p++ ) {
-                    double innerSum = 0.;
-                    for ( unsigned c = 0; c < 3; c ++ ) {
-                        innerSum += std::pow( princStretch[c], alpha_[p] );
-                    }
-
                     const double aux =
                         ( a==b ?
-                          std::pow(  princStretch[a], alpha_[p] ) / 3. :
-                          -std::pow( princStretch[a], alpha_[p] ) / 3.
-                          -std::pow( princStretch[b], alpha_[p] ) / 3. );
+                          stretchPower[p][a] / 3. :
+                          -stretchPower[p][a] / 3. - stretchPower[p][b] / 3. );
                     
-                    outerSum += mu_[p] * alpha_[p] * (aux + innerSum/9.);
+                    outerSum += mu_[p] * alpha_[p] * (aux + sumPower[p]/9.);
                 }
 
-                partialSisoPrinc(a,b) = factor * outerSum;
+                principal.A(a,b) = factor * outerSum -
+                    ( a==b ? 2. * principal.S[a] / eVal[a] : 0. );
             }
         }
 
         // compute divided difference terms
-        Tensor dividedDifference; // compute B_{ab} above
+        const double tol = tol_ * eVal.cwiseAbs().maxCoeff();
         for ( unsigned a = 0; a < 3; a++ ) {
             for ( unsigned b = 0; b < 3; b++ ) {
 
-                if ( a != b ) {
-                    
-                    // squares of stretches
-                    const double lamA2 = eVal[a];
-                    const double lamB2 = eVal[b];
-
-                    // tolerance check
-                    if ( std::abs( lamB2 - lamA2 ) > tol_ ) {
-                        // regular expression
-                        dividedDifference(a,b) =
-                            (SisoPrinc[b] - SisoPrinc[a]) /
-                            (lamB2        - lamB2);
-                    }
-                    else{
-                        // limit expression a l'Hopital
-                        dividedDifference(a,b) = 
-                            0.5 * ( partialSisoPrinc(b,b) -
-                                    partialSisoPrinc(a,b) );
-                    }
-
+                if ( a == b ) {
+                    principal.B(a,b) = 0.;
+                }
+                else if ( std::abs( eVal[b] - eVal[a] ) > tol ) {
+                    // regular expression
+                    principal.B(a,b) =
+                        (principal.S[b] - principal.S[a]) / (eVal[b] - eVal[a]);
+                }
+                else {
+                    // limit expression a l'Hopital
+                    principal.B(a,b) = 
+                        0.5 * ( principal.A(b,b) - principal.A(a,b) );
                 }
-                dividedDifference(a,b) = 0.;
             }
         }
-        
+    }
+
+    //--------------------------------------------------------------------------
+    //! Stress tensor from principal stresses and directions
+    void stress_( const Principal_& principal, Tensor& S ) const
+    {
+        S = Tensor::Zero();
+        for ( unsigned a = 0; a < 3; a ++ ) {
+            S += principal.S[a] *
+                (principal.directions.col(a) * (principal.directions.col(a)).transpose());
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    //! Elasticity tensor from principal components and directions
+    void elasticity_( const Principal_& principal, ElastTensor& elC ) const
+    {
+        const Tensor& X = principal.directions;
 
-        // Insert into storage matrix
         // go through all indices
         for ( unsigned A = 0; A < 3; A++ ) {
             for ( unsigned B = A; B < 3; B++ ) {
@@ -347,14 +401,14 @@ public:
                             for ( unsigned b = 0; b < 3; b++ ) {
 
                                 // A_{ab} term
-                                cEntry += partialSisoPrinc(a,b) *
-                                    (eVec(a,A) * eVec(a,B) * eVec(b,C) * eVec(b,D));
+                                cEntry += principal.A(a,b) *
+                                    (X(A,a) * X(B,a) * X(C,b) * X(D,b));
 
                                 // B_{ab} term
                                 if ( a != b ) {
-                                    cEntry += dividedDifference(a,b) * 
-                                        ( (eVec(a,A) * eVec(b,B) * eVec(a,C) * eVec(b,D)) +
-                                          (eVec(a,A) * eVec(b,B) * eVec(b,C) * eVec(a,D)) );
+                                    cEntry += principal.B(a,b) * 
+                                        ( (X(A,a) * X(B,b) * X(C,a) * X(D,b)) +
+                                          (X(A,a) * X(B,b) * X(C,b) * X(D,a)) );
                                 }
                             }
                         }
@@ -367,10 +421,8 @@ public:
                 
             } // B
         } // A
-        
     }
-    
-private:
+
     //--------------------------------------------------------------------------
     /** Partial derivative of the iso-choric energy with respect to principal
      *  stretch. In detail, this function returns
@@ -448,7 +500,7 @@ private:
     const bool   isIncompressible_; //!< Flag to turn on full incompressibility
     //@}
 
-    const double tol_; //!< Evil tolerance for equality of principal stretches
+    const double tol_; //!< Relative tolerance for equal principal stretches
 };
 
 #endif
@@ -15,6 +15,7 @@
 #include <base/verify.hpp>
 // mat includes
 #include <mat/TensorAlgebra.hpp>
+#include <mat/TensorBatch.hpp>
 
 //------------------------------------------------------------------------------
 namespace mat{
@@ -37,6 +38,8 @@ public:
     //@{
     typedef mat::Tensor                     Tensor;
     typedef mat::ElastTensor                ElastTensor;
+    typedef mat::TensorBatch                TensorBatch;
+    typedef mat::ElastTensorBatch           ElastTensorBatch;
     //@}
     
     //! Construct with Lame parameters
@@ -112,7 +115,44 @@ public:
         for ( unsigned i = 0; i < 3; i ++ ) C( i, i ) +=  2. * mu_;
         for ( unsigned i = 3; i < 6; i ++ ) C( i, i ) +=       mu_;
     }
-    
+    //--------------------------------------------------------------------------
+    /** Stresses and elasticity tensors for a batch of deformation gradients.
+     *  With \f$ E = (C-I)/2 \f$ the stress is rewritten as
+     *  \f$ S = \mu C + (\lambda tr E - \mu) I \f$.
+     *  \param[in]  F    Batch of deformation gradients
+     *  \param[out] S    Batch of 2nd Piola-Kirchhoff stresses (if not NULL)
+     *  \param[out] elC  Batch of elasticity tensors (if not NULL)
+     */
+    void evaluateBatch( const TensorBatch& F, TensorBatch* S,
+                        ElastTensorBatch* elC ) const
+    {
+        const std::size_t n = static_cast<std::size_t>( F.rows() );
+
+        if ( S != NULL ) {
+            mat::SymTensorBatch CG;
+            Eigen::VectorXd J;
+            mat::rightCauchyGreen( F, CG, J );
+
+            Eigen::VectorXd shift( n );
+            for ( std::size_t p = 0; p < n; p++ ) {
+                const double trE = 0.5 * (CG(p,0) + CG(p,1) + CG(p,2) - 3.);
+                shift[p] = lambda_ * trE - mu_;
+            }
+
+            mat::expandSymmetric( CG, Eigen::VectorXd::Constant( n, mu_ ),
+                                  shift, *S );
+        }
+
+        if ( elC == NULL ) return;
+
+        // constant elasticity tensor
+        ElastTensor C;
+        this -> materialElasticityTensor( Tensor::Identity(), C );
+        elC -> resize( n, 36 );
+        for ( unsigned I = 0; I < 6; I++ )
+            for ( unsigned K = 0; K < 6; K++ )
+                elC -> col( 6*I+K ).setConstant( C( I, K ) );
+    }
     
 private:
     //! @name Lame parameters
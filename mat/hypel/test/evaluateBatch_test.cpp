@@ -0,0 +1,101 @@
+#include <cstdlib>
+#include <boost/test/minimal.hpp>
+
+#include <mat/TensorBatch.hpp>
+#include <mat/hypel/StVenant.hpp>
+#include <mat/hypel/NeoHookeanCompressible.hpp>
+#include <mat/hypel/NearlyIncompNeoHookean.hpp>
+#include <mat/hypel/Ogden.hpp>
+
+//! \cond SKIPDOX
+// batch of deformation gradients with a random perturbation of the identity
+mat::TensorBatch makeBatch( const std::size_t n )
+{
+    mat::TensorBatch F( n, 9 );
+    for ( std::size_t p = 0; p < n; p++ ) {
+        mat::Tensor Fp = mat::Tensor::Identity();
+        for ( unsigned i = 0; i < 3; i++ )
+            for ( unsigned j = 0; j < 3; j++ )
+                Fp( i, j ) += 0.3 * ( std::rand() / double( RAND_MAX ) - 0.5 );
+        mat::setTensor( F, p, Fp );
+    }
+    return F;
+}
+
+// maximal relative deviation of the batch from the pointwise evaluation
+template<typename MATERIAL>
+double batchDeviation( const MATERIAL& material, const mat::TensorBatch& F )
+{
+    mat::TensorBatch      S;
+    mat::ElastTensorBatch C;
+    material.evaluateBatch( F, &S, &C );
+
+    double result = 0.;
+    for ( std::size_t p = 0; p < static_cast<std::size_t>( F.rows() ); p++ ) {
+        mat::Tensor Fp, Sp, SBatch;
+        mat::getTensor( F, p, Fp );
+        mat::getTensor( S, p, SBatch );
+        material.secondPiolaKirchhoff( Fp, Sp );
+
+        mat::ElastTensor Cp, CBatch;
+        mat::getElastTensor( C, p, CBatch );
+        material.materialElasticityTensor( Fp, Cp );
+
+        result = std::max( result, ( SBatch - Sp ).norm() / Sp.norm() );
+        result = std::max( result, ( CBatch - Cp ).norm() / Cp.norm() );
+    }
+
+    // the stresses alone are the same
+    mat::TensorBatch SOnly;
+    material.evaluateBatch( F, &SOnly, NULL );
+    result = std::max( result, ( SOnly - S ).norm() / S.norm() );
+
+    return result;
+}
+
+// stresses at a nearly isotropic stretch are finite and continuous
+template<typename MATERIAL>
+bool nearlyIsotropic( const MATERIAL& material )
+{
+    mat::Tensor F = 0.94 * mat::Tensor::Identity();
+    mat::Tensor S0;
+    material.secondPiolaKirchhoff( F, S0 );
+
+    // perturb one entry by up to a few ulps
+    bool result = true;
+    for ( unsigned k = 0; k < 8; k++ ) {
+        F( k % 3, k % 3 ) = nextafter( F( k % 3, k % 3 ), 1. );
+
+        mat::Tensor S;
+        mat::ElastTensor C;
+        material.secondPiolaKirchhoff( F, S );
+        material.materialElasticityTensor( F, C );
+
+        result = result and S.allFinite() and C.allFinite() and
+            ( ( S - S0 ).norm() <= 1.e-12 * ( 1. + S0.norm() ) );
+    }
+    return result;
+}
+
+int test_main( int, char *[] )            
+{
+    const mat::TensorBatch F = makeBatch( 17 );
+    const double tolerance = 1.e-12;
+
+    BOOST_CHECK( batchDeviation( mat::hypel::StVenant( 2.0, 1.5 ), F ) < tolerance );
+    BOOST_CHECK( batchDeviation( mat::hypel::NeoHookeanCompressible( 2.0, 1.5 ), F )
+                 < tolerance );
+    BOOST_CHECK( batchDeviation( mat::hypel::NearlyIncompNeoHookean( 5.0, 1.5 ), F )
+                 < tolerance );
+    BOOST_CHECK( batchDeviation( mat::hypel::NearlyIncompNeoHookean( 5.0, 1.5, true ), F )
+                 < tolerance );
+
+    mat::hypel::Ogden<2>::ParamArray mu, alpha;
+    mu[0] = 1.0; mu[1] = -0.2; alpha[0] = 2.0; alpha[1] = -2.0;
+    BOOST_CHECK( batchDeviation( mat::hypel::Ogden<2>( mu, alpha, 5.0, 9.0 ), F )
+                 < tolerance );
+    BOOST_CHECK( nearlyIsotropic( mat::hypel::Ogden<2>( mu, alpha, 5.0, 9.0 ) ) );
+
+    return 0;
+}
+//! \endcond
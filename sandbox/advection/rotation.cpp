@@ -0,0 +1,167 @@
+// system includes
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <cmath>
+#include <boost/lexical_cast.hpp>
+// mesh related
+#include <base/shape.hpp>
+#include <base/Unstructured.hpp>
+// input/output
+#include <base/io/smf/Reader.hpp>
+#include <base/io/PropertiesParser.hpp>
+#include <base/io/vtk/LegacyWriter.hpp>
+#include <base/io/Format.hpp>
+// FE basis
+#include <base/fe/Basis.hpp>
+// Field and degrees of freedom
+#include <base/Field.hpp>
+#include <base/dof/generate.hpp>
+#include <base/dof/location.hpp>
+// advection
+#include <base/post/SemiLagrangian.hpp>
+// timing
+#include <base/auxi/Timer.hpp>
+
+//------------------------------------------------------------------------------
+// Gaussian hill centred at (0.5,0.75)
+template<unsigned DIM>
+base::Vector<1>::Type hill( const typename base::Vector<DIM>::Type& x )
+{
+    typename base::Vector<DIM>::Type c = base::constantVector<DIM>( 0.5 );
+    c[1] = 0.75;
+    return base::constantVector<1>( std::exp( - ( x - c ).squaredNorm() / 0.01 ) );
+}
+
+// Rigid body rotation around the centre of the unit square, period 1
+template<unsigned DIM>
+typename base::Vector<DIM>::Type rotation( const typename base::Vector<DIM>::Type& x )
+{
+    typename base::Vector<DIM>::Type u = base::constantVector<DIM>( 0. );
+    u[0] = - 2. * M_PI * ( x[1] - 0.5 );
+    u[1] =   2. * M_PI * ( x[0] - 0.5 );
+    return u;
+}
+
+// Set DoF values of a field from a function of the coordinate
+template<typename MESH, typename FIELD, typename FUN>
+void interpolate( const MESH& mesh, FIELD& field, FUN fun )
+{
+    std::vector< std::pair<std::size_t,
+                           typename MESH::Element::GeomFun::VecDim> > location;
+    base::dof::associateLocation( field, location );
+
+    typename FIELD::DoFPtrIter dIter = field.doFsBegin();
+    typename FIELD::DoFPtrIter dEnd  = field.doFsEnd();
+    for ( ; dIter != dEnd; ++dIter ) {
+        const std::size_t id = (*dIter) -> getID();
+        const typename MESH::Node::VecDim x =
+            base::Geometry<typename MESH::Element>()(
+                mesh.elementPtr( location[id].first ), location[id].second );
+        const typename base::Vector<FIELD::DegreeOfFreedom::size>::Type value =
+            fun( x );
+        for ( unsigned d = 0; d < FIELD::DegreeOfFreedom::size; d++ )
+            (*dIter) -> setValue( d, value[d] );
+    }
+}
+
+//------------------------------------------------------------------------------
+int main( int argc, char * argv[] )
+{
+    // usage message
+    if ( argc != 2 ) {
+        std::cout << "Usage:  " << argv[0] << "  input.dat \n";
+        return 0;
+    }
+
+    // basic attributes of the computation
+    const unsigned    geomDeg  = 1;
+    const unsigned    fieldDeg = 1;
+#ifdef SIMPLEX
+    const base::Shape shape    = base::TRI;
+#else
+    const base::Shape shape    = base::QUAD;
+#endif
+
+    // read from input file
+    const std::string inputFile = boost::lexical_cast<std::string>( argv[1] );
+    std::string meshFile;
+    unsigned numSteps, numSubSteps, order;
+    {
+        base::io::PropertiesParser prop;
+        prop.registerPropertiesVar( "meshFile",    meshFile );
+        prop.registerPropertiesVar( "numSteps",    numSteps );
+        prop.registerPropertiesVar( "numSubSteps", numSubSteps );
+        prop.registerPropertiesVar( "order",       order );
+
+        std::ifstream inp( inputFile.c_str()  );
+        VERIFY_MSG( inp.is_open(), "Cannot open input file" );
+        VERIFY_MSG( prop.readValuesAndCheck( inp ), "Input error" );
+        inp.close( );
+    }
+    const std::string baseName = base::io::baseName( meshFile, ".smf" );
+
+    //--------------------------------------------------------------------------
+    typedef base::Unstructured<shape,geomDeg>    Mesh;
+    const unsigned dim = Mesh::Node::dim;
+
+    Mesh mesh;
+    {
+        std::ifstream smf( meshFile.c_str() );
+        VERIFY_MSG( smf.is_open(), "Cannot open mesh file" );
+        base::io::smf::readMesh( smf, mesh );
+        smf.close();
+    }
+
+    // scalar field to advect and velocity field
+    typedef base::fe::Basis<shape,fieldDeg>        FEBasis;
+    typedef base::Field<FEBasis,1>                 Field;
+    typedef base::Field<FEBasis,dim>               Velocity;
+    Field    field;
+    Velocity velocity;
+    base::dof::generate<FEBasis>( mesh, field );
+    base::dof::generate<FEBasis>( mesh, velocity );
+
+    interpolate( mesh, field,    &hill<dim> );
+    interpolate( mesh, velocity, &rotation<dim> );
+
+    // keep the initial state for comparison
+    std::vector<double> initial;
+    for ( Field::DoFPtrIter d = field.doFsBegin(); d != field.doFsEnd(); ++d )
+        initial.push_back( (*d) -> getValue( 0 ) );
+
+    //--------------------------------------------------------------------------
+    // one full revolution
+    base::auxi::Timer timer;
+    base::post::SemiLagrangian<Mesh,Field> semiLagrangian( mesh, field );
+    const double setupTime = timer.seconds();
+
+    const double stepSize = 1. / static_cast<double>( numSteps );
+    timer.reset();
+    for ( unsigned n = 0; n < numSteps; n++ )
+        semiLagrangian.advect( velocity, field, stepSize, numSubSteps, order );
+    const double advectTime = timer.seconds();
+
+    // maximal deviation from the initial state
+    double maxError = 0.;
+    std::size_t i = 0;
+    for ( Field::DoFPtrIter d = field.doFsBegin(); d != field.doFsEnd(); ++d, i++ )
+        maxError = std::max( maxError, std::abs( (*d) -> getValue( 0 ) - initial[i] ) );
+
+    std::cout << "# DoFs " << initial.size()
+              << ", setup " << setupTime << " s"
+              << ", advection " << advectTime / numSteps << " s/step"
+              << ", max. error " << maxError
+              << ", clipped " << semiLagrangian.numClipped() << std::endl;
+
+    {
+        const std::string vtkFile = baseName + ".vtk";
+        std::ofstream vtk( vtkFile.c_str() );
+        base::io::vtk::LegacyWriter vtkWriter( vtk );
+        vtkWriter.writeUnstructuredGrid( mesh );
+        base::io::vtk::writePointData( vtkWriter, mesh, field, "phi" );
+        vtk.close();
+    }
+
+    return 0;
+}
@@ -30,7 +30,7 @@
 #include <fluid/Stokes.hpp>
 #include <fluid/Convection.hpp>
 
-#include "BlockLU.hpp"
+#include <base/solver/BlockSchur.hpp>
 
 #define INCREMENTAL
 
@@ -191,15 +191,18 @@ int main( int argc, char * argv[] )
     const bool incremental = false;
 #endif
 
+    // Create a solver object, its factorisations are re-used
+    typedef base::solver::BlockSchur       Solver;
+    Solver solver( numDoFsU, numDoFsP );
+    unsigned numKrylovIter = 0;
+
     //--------------------------------------------------------------------------
     // Nonlinear iterations
     unsigned iter = 0;
     while( iter < maxIter ) {
 
-        // Create a solver object
-        typedef base::solver::BlockLU          Solver;
-        //Solver solver( numDoFsU + numDoFsP, 0 );
-        Solver solver( numDoFsU, numDoFsP );
+        solver.clearLHS();
+        solver.clearRHS();
 
         std::cout << "Iteration " << iter << ": " << std::flush;
     
@@ -243,9 +246,10 @@ int main( int argc, char * argv[] )
         if ( isConverged ) { std::cout << std::endl; break; }
         prevResNorm = residualNorm;
 
-        // Solve
-        //solver.superLUSolve();
-        solver.umfPackLUSolve();
+        // Solve, re-factorise if the old preconditioner degrades
+        if ( (iter == 0) or (numKrylovIter > 20) ) solver.factorise();
+        numKrylovIter = solver.solveFactorised( 1.e-10 );
+        std::cout << " (" << numKrylovIter << " its)" << std::flush;
 
         // distribute results back to dofs
         if ( incremental ) {
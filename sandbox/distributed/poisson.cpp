@@ -0,0 +1,218 @@
+// system includes
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <cmath>
+#include <boost/lexical_cast.hpp>
+#include <boost/shared_ptr.hpp>
+// mesh related
+#include <base/shape.hpp>
+#include <base/Unstructured.hpp>
+#include <base/mesh/MeshBoundary.hpp>
+// input/output
+#include <base/io/smf/Reader.hpp>
+#include <base/io/PropertiesParser.hpp>
+#include <base/io/vtk/LegacyWriter.hpp>
+#include <base/io/Format.hpp>
+// quadrature
+#include <base/Quadrature.hpp>
+// FE basis
+#include <base/fe/Basis.hpp>
+// Field and degrees of freedom
+#include <base/Field.hpp>
+#include <base/dof/Distribute.hpp>
+#include <base/dof/constrainBoundary.hpp>
+#include <base/dof/generate.hpp>
+// assembly
+#include <base/asmb/FieldBinder.hpp>
+#include <base/asmb/StiffnessMatrix.hpp>
+#include <base/asmb/BodyForce.hpp>
+// kernel
+#include <heat/Laplace.hpp>
+// post-processing
+#include <base/post/ErrorNorm.hpp>
+// distributed memory
+#include <base/mpi/Communicator.hpp>
+#include <base/mpi/partition.hpp>
+#include <base/mpi/numbering.hpp>
+#include <base/mpi/Solver.hpp>
+
+// tolerance for coordinate identification
+static const double coordTol = 1.e-6;
+
+//------------------------------------------------------------------------------
+// Manufactured solution u = exp( x + 2y ) ( 1 + z ) on the unit cube; unlike a
+// product of sines, its load vector is not an eigenvector of the discrete
+// Laplacian and CG needs a representative number of iterations
+template<unsigned DIM>
+typename base::Vector<1>::Type solution( const typename base::Vector<DIM>::Type& x )
+{
+    double u = std::exp( x[0] + 2. * x[1] );
+    if ( DIM > 2 ) u *= ( 1. + x[2] );
+    return base::constantVector<1>( u );
+}
+
+// Corresponding source term f = - Laplace u = -5 u
+template<unsigned DIM>
+typename base::Vector<1>::Type forceFun( const typename base::Vector<DIM>::Type& x )
+{
+    return -5. * solution<DIM>( x );
+}
+
+// Dirichlet conditions with the exact solution on the outer boundary only,
+// the cuts of the local mesh to the other ranks are left free
+template<unsigned DIM, typename DOF>
+void dirichletBC( const typename base::Vector<DIM>::Type& x, DOF* doFPtr )
+{
+    bool onBoundary = false;
+    for ( unsigned d = 0; d < DIM; d++ )
+        onBoundary = onBoundary or ( std::abs( x[d]      ) < coordTol ) or
+                                   ( std::abs( x[d] - 1. ) < coordTol );
+
+    if ( onBoundary and doFPtr -> isActive(0) )
+        doFPtr -> constrainValue( 0, solution<DIM>( x )[0] );
+}
+
+//------------------------------------------------------------------------------
+int main( int argc, char * argv[] )
+{
+    base::mpi::Environment environment( argc, argv );
+    const base::mpi::Communicator comm;
+
+    // usage message
+    if ( argc != 2 ) {
+        if ( comm.rank() == 0 )
+            std::cout << "Usage:  mpirun -np N " << argv[0] << "  input.dat \n";
+        return 0;
+    }
+
+    // basic attributes of the computation
+    const unsigned    geomDeg  = 1;
+    const unsigned    fieldDeg = 1;
+    const base::Shape shape    = base::HEX;
+    const unsigned kernelDegEstimate = 3;
+
+    // read from input file
+    const std::string inputFile = boost::lexical_cast<std::string>( argv[1] );
+    std::string meshFile;
+    double tolerance;
+    {
+        base::io::PropertiesParser prop;
+        prop.registerPropertiesVar( "meshFile",  meshFile );
+        prop.registerPropertiesVar( "tolerance", tolerance );
+
+        std::ifstream inp( inputFile.c_str()  );
+        VERIFY_MSG( inp.is_open(), "Cannot open input file" );
+        VERIFY_MSG( prop.readValuesAndCheck( inp ), "Input error" );
+        inp.close( );
+    }
+    const std::string baseName = base::io::baseName( meshFile, ".smf" );
+
+    //--------------------------------------------------------------------------
+    typedef base::Unstructured<shape,geomDeg>    Mesh;
+    const unsigned dim = Mesh::Node::dim;
+
+    typedef base::fe::Basis<shape,fieldDeg>        FEBasis;
+    typedef base::Field<FEBasis,1>                 Field;
+    typedef Field::DegreeOfFreedom                 DoF;
+
+    // local mesh and field of this rank
+    Mesh mesh;
+    Field field;
+    std::size_t numOwnedElements;
+    boost::shared_ptr<base::mpi::IndexLayout> layout;
+
+    // Every rank reads the complete mesh and extracts its part. The complete
+    // mesh is only needed for the partition and the numbering and is freed
+    // at the end of this scope, but the peak memory per rank is of the
+    // order of the complete mesh (see the todo file for a partitioned input)
+    {
+        Mesh globalMesh;
+        {
+            std::ifstream smf( meshFile.c_str() );
+            base::io::smf::readMesh( smf, globalMesh );
+            smf.close();
+        }
+
+        std::vector<int> partition;
+        base::mpi::partitionElements( globalMesh, comm.size(), partition );
+
+        std::vector<std::size_t> globalElementIDs;
+        numOwnedElements =
+            base::mpi::extractLocalMesh( globalMesh, partition, comm.rank(),
+                                         mesh, globalElementIDs );
+
+        // field on the local mesh
+        base::dof::generate<FEBasis>( mesh, field );
+
+        base::mesh::MeshBoundary meshBoundary;
+        meshBoundary.create( mesh.elementsBegin(), mesh.elementsEnd() );
+        base::dof::constrainBoundary<FEBasis>( meshBoundary.begin(),
+                                               meshBoundary.end(),
+                                               mesh, field,
+                                               boost::bind( &dirichletBC<dim,DoF>,
+                                                            _1, _2 ) );
+
+        // parallel numbering
+        layout = base::mpi::numberDoFs<FEBasis>( comm, globalMesh, partition,
+                                                 globalElementIDs, field );
+    }
+
+    if ( comm.rank() == 0 )
+        std::cout << "# Number of dofs " << layout -> numGlobal()
+                  << " on " << comm.size() << " ranks" << std::endl;
+
+    //--------------------------------------------------------------------------
+    // assembly over owned and ghost elements
+    typedef base::Quadrature<kernelDegEstimate,shape> Quadrature;
+    Quadrature quadrature;
+
+    typedef base::asmb::FieldBinder<Mesh,Field> FieldBinder;
+    FieldBinder fieldBinder( mesh, field );
+    typedef FieldBinder::TupleBinder<1,1>::Type FTB;
+
+    base::mpi::Solver solver( *layout );
+    solver.registerFields<FTB>( fieldBinder );
+
+    base::asmb::bodyForceComputation<FTB>( quadrature, solver, fieldBinder,
+                                           boost::bind( &forceFun<dim>, _1 ) );
+
+    typedef heat::Laplace<FTB::Tuple> Laplace;
+    Laplace laplace( 1. );
+    base::asmb::stiffnessMatrixComputation<FTB>( quadrature, solver,
+                                                 fieldBinder, laplace );
+    solver.finishAssembly();
+
+    const int numIter = solver.cgSolve( tolerance );
+    base::dof::setDoFsFromSolver( solver, field );
+
+    //--------------------------------------------------------------------------
+    // L2-error over the owned elements
+    typedef base::post::ErrorNorm<Mesh::Element,Field::Element,0> ErrorNorm;
+    const ErrorNorm::Reference reference = boost::bind( &solution<dim>, _1 );
+    ErrorNorm errorNorm( reference );
+    double errorSquared = 0.;
+    for ( std::size_t e = 0; e < numOwnedElements; e++ ) {
+        base::asmb::FieldElementPointerTuple<Mesh::Element*,Field::Element*>
+            fept( mesh.elementPtr( e ), field.elementPtr( e ) );
+        quadrature.apply( errorNorm, fept, errorSquared );
+    }
+    const double error = std::sqrt( comm.sum( errorSquared ) );
+
+    if ( comm.rank() == 0 )
+        std::cout << "# CG iterations " << numIter
+                  << ", L2-error " << error << std::endl;
+
+    // one VTK file per rank
+    {
+        const std::string vtkFile =
+            baseName + "." + base::io::leadingZeros( comm.rank() ) + ".vtk";
+        std::ofstream vtk( vtkFile.c_str() );
+        base::io::vtk::LegacyWriter vtkWriter( vtk );
+        vtkWriter.writeUnstructuredGrid( mesh );
+        base::io::vtk::writePointData( vtkWriter, mesh, field, "u" );
+        vtk.close();
+    }
+
+    return 0;
+}
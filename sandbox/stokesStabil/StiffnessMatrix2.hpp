@@ -163,9 +163,7 @@ public:
         std::vector<base::number> rowDoFValues, colDoFValues;
 
         // dof constraints
-        typedef std::pair<unsigned, std::vector< std::pair<base::number,std::size_t> > >
-            WeightedDoFIDs;
-        std::vector<WeightedDoFIDs> rowConstraints, colConstraints;
+        base::asmb::ElementConstraints rowConstraints, colConstraints;
 
         // Collect dof entities from element
         bool doSomething = 
@@ -182,7 +180,6 @@ public:
             colDoFStatus   = rowDoFStatus;
             colDoFIDs      = rowDoFIDs;
             colDoFValues   = rowDoFValues;
-            colConstraints = rowConstraints;
         }
         else // otherwise, collect for trial space
             doSomething =
@@ -206,7 +203,8 @@ public:
                                     rowDoFStatus, colDoFStatus,
                                     rowDoFIDs, colDoFIDs,
                                     colDoFValues,
-                                    rowConstraints, colConstraints,
+                                    rowConstraints,
+                                    ( isBubnov ? rowConstraints : colConstraints ),
                                     solver_, isBubnov );
         return;
     }
@@ -0,0 +1,306 @@
+// system includes
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <cmath>
+#include <boost/lexical_cast.hpp>
+// mesh related
+#include <base/shape.hpp>
+#include <base/Unstructured.hpp>
+#include <base/mesh/MeshBoundary.hpp>
+#include <base/mesh/generateBoundaryMesh.hpp>
+// input/output
+#include <base/io/smf/Reader.hpp>
+#include <base/io/PropertiesParser.hpp>
+#include <base/io/vtk/LegacyWriter.hpp>
+#include <base/io/Format.hpp>
+// quadrature
+#include <base/Quadrature.hpp>
+// FE basis
+#include <base/fe/Basis.hpp>
+// Field and degrees of freedom
+#include <base/Field.hpp>
+#include <base/dof/numbering.hpp>
+#include <base/dof/Distribute.hpp>
+#include <base/dof/constrainBoundary.hpp>
+#include <base/dof/generate.hpp>
+// assembly
+#include <base/asmb/NeumannForce.hpp>
+#include <base/asmb/FieldBinder.hpp>
+#include <base/asmb/SurfaceFieldBinder.hpp>
+// system solver, only as storage of the RHS
+#include <base/solver/Eigen3.hpp>
+// material
+#include <mat/hypel/StVenant.hpp>
+#include <mat/Lame.hpp>
+// integral kernels
+#include <solid/HyperElastic.hpp>
+// time integration
+#include <base/time/CentralDifference.hpp>
+// post processing
+#include <base/post/findLocation.hpp>
+#include <base/post/Monitor.hpp>
+
+// tolerance for coordinate identification
+static const double coordTol = 1.e-5;
+
+// applied traction
+double tractionValue( const double time )
+{
+    return ( time > 0.1 ? -10000.0 : 0.0 );
+}
+
+// Fix left side boundary (x_1=0)
+template<unsigned DIM, typename DOF>
+void dirichletBC( const typename base::Vector<DIM>::Type& x,
+                  DOF* doFPtr )
+{
+    // location at x_1 = 0 or x_1 = 1
+    const bool onLeftBdr  = ( std::abs( x[0] -  0. ) < coordTol );
+
+    // Fix left boundary at x_0 = 0
+    if ( onLeftBdr ) {
+        for ( unsigned d = 0; d < DOF::size; d++ ) {
+            if ( doFPtr -> isActive(d) )
+                doFPtr -> constrainValue( d, 0.0 );
+        }
+    }
+
+    return;
+}
+
+// Apply a normal traction to right side boundary (x_2=0)
+template<unsigned DIM>
+typename base::Vector<DIM>::Type
+neumannBC( const typename base::Vector<DIM>::Type& x,
+           const typename base::Vector<DIM>::Type& normal,
+           const double value )
+{
+    typedef typename base::Vector<DIM>::Type VecDim;
+
+    VecDim result = VecDim::Constant( 0. );
+
+    const bool onRightBdr = ( std::abs( x[0] -  1. ) < coordTol );
+
+    if ( onRightBdr ) result = value * normal;
+
+    return result;
+}
+
+//------------------------------------------------------------------------------
+template<typename MESH, typename FIELD>
+void writeVTKFile( const std::string& baseName,
+                   const unsigned     step,
+                   const MESH&        mesh,
+                   const FIELD&       disp )
+{
+    // create file name with step number
+    const std::string vtkFile =
+        baseName + ".explicit." + base::io::leadingZeros( step ) + ".vtk";
+    std::ofstream vtk( vtkFile.c_str() );
+    base::io::vtk::LegacyWriter vtkWriter( vtk );
+    vtkWriter.writeUnstructuredGrid( mesh );
+
+    base::io::vtk::writePointData( vtkWriter, mesh, disp,  "disp" );
+
+    vtk.close();
+}
+
+
+//------------------------------------------------------------------------------
+int main( int argc, char * argv[] )
+{
+    // usage message
+    if ( argc != 2 ) {
+        std::cout << "Usage:  " << argv[0] << "  input.dat \n";
+        return 0;
+    }
+
+    // basic attributes of the computation
+    const unsigned    geomDeg  = 1;
+    const unsigned    fieldDeg = 1;
+    const base::Shape shape    = base::QUAD;
+    const unsigned kernelDegEstimate = 3;
+
+    // choice of material
+    typedef mat::hypel::StVenant Material;
+
+    // read name of input file
+    const std::string inputFile = boost::lexical_cast<std::string>( argv[1] );
+
+    // read from input file
+    std::string meshFile;
+    double E, nu, density, stepSize, cflFactor;
+    unsigned numSteps;
+    {
+        //Feed properties parser with the variables to be read
+        base::io::PropertiesParser prop;
+        prop.registerPropertiesVar( "meshFile",         meshFile );
+        prop.registerPropertiesVar( "E",                E );
+        prop.registerPropertiesVar( "nu",               nu );
+        prop.registerPropertiesVar( "density",          density );
+        prop.registerPropertiesVar( "stepSize",         stepSize );
+        prop.registerPropertiesVar( "numSteps",         numSteps );
+        prop.registerPropertiesVar( "cflFactor",        cflFactor );
+
+        // Read variables from the input file
+        std::ifstream inp( inputFile.c_str()  );
+        VERIFY_MSG( inp.is_open(), "Cannot open input file" );
+        VERIFY_MSG( prop.readValuesAndCheck( inp ), "Input error" );
+        inp.close( );
+    }
+
+    // find base name from mesh file
+    const std::string baseName = base::io::baseName( meshFile, ".smf" );
+
+    //--------------------------------------------------------------------------
+    // Create a mesh
+    typedef base::Unstructured<shape,geomDeg>    Mesh;
+    const unsigned dim = Mesh::Node::dim;
+
+    Mesh mesh;
+    {
+        std::ifstream smf( meshFile.c_str() );
+        base::io::smf::readMesh( smf, mesh );
+        smf.close();
+    }
+
+    // quadrature objects for volume and surface
+    typedef base::Quadrature<kernelDegEstimate,shape> Quadrature;
+    Quadrature quadrature;
+    typedef base::SurfaceQuadrature<kernelDegEstimate,shape> SurfaceQuadrature;
+    SurfaceQuadrature surfaceQuadrature;
+
+    // Create a field
+    const unsigned    doFSize = dim;
+    typedef base::fe::Basis<shape,fieldDeg>        FEBasis;
+    typedef base::Field<FEBasis,doFSize>           Field;
+    typedef Field::DegreeOfFreedom                 DoF;
+    Field displacement;
+
+    // generate DoFs from mesh
+    base::dof::generate<FEBasis>( mesh, displacement );
+
+    // Creates a list of <Element,faceNo> pairs along the boundary
+    base::mesh::MeshBoundary meshBoundary;
+    meshBoundary.create( mesh.elementsBegin(), mesh.elementsEnd() );
+
+    // constrain the boundary
+    base::dof::constrainBoundary<FEBasis>( meshBoundary.begin(),
+                                           meshBoundary.end(),
+                                           mesh, displacement,
+                                           boost::bind( &dirichletBC<dim,DoF>,
+                                                        _1, _2 ) );
+
+    // Create a boundary mesh from this list
+    typedef base::mesh::BoundaryMeshBinder<Mesh::Element>::Type BoundaryMesh;
+    BoundaryMesh boundaryMesh;
+    {
+        // Create a real mesh object from this list
+        base::mesh::generateBoundaryMesh( meshBoundary.begin(),
+                                          meshBoundary.end(),
+                                          mesh, boundaryMesh );
+    }
+
+    // Bind the fields together
+    typedef base::asmb::FieldBinder<Mesh,Field> FieldBinder;
+    FieldBinder fieldBinder( mesh, displacement );
+    typedef FieldBinder::TupleBinder<1,1>::Type FTB;
+
+    // Bind the field to the boundary mesh
+    typedef base::asmb::SurfaceFieldBinder<BoundaryMesh,Field> SurfaceFieldBinder;
+    SurfaceFieldBinder surfaceFieldBinder( boundaryMesh, displacement );
+    typedef SurfaceFieldBinder::TupleBinder<1>::Type SFTB;
+
+    // material object
+    const double lambda = mat::Lame::lambda( E, nu );
+    const double mu     = mat::Lame::mu(     E, nu );
+    Material material( lambda, mu );
+
+    // residual kernel
+    typedef solid::HyperElastic<Material,FTB::Tuple> HyperElastic;
+    HyperElastic hyperElastic( material );
+
+    // Number the degrees of freedom
+    const std::size_t numDoFs =
+        base::dof::numberDoFsConsecutively( displacement.doFsBegin(), displacement.doFsEnd() );
+    std::cout << "# Number of dofs " << numDoFs << std::endl;
+
+    // step size from the dilatational wave speed
+    const double waveSpeed = std::sqrt( (lambda + 2.*mu) / density );
+    const double explicitStep =
+        cflFactor * base::time::criticalStepSize( mesh, waveSpeed, fieldDeg );
+    const unsigned subSteps =
+        static_cast<unsigned>( std::ceil( stepSize / explicitStep ) );
+    std::cout << "# Explicit step size " << stepSize / subSteps
+              << ", " << subSteps << " steps per output" << std::endl;
+
+    // RHS storage
+    typedef base::solver::Eigen3           Solver;
+    Solver solver( numDoFs );
+
+    // lumped mass, once
+    base::time::computeLumpedMass<FTB>( quadrature, solver, fieldBinder, density );
+
+    base::time::CentralDifference centralDifference( numDoFs, stepSize / subSteps );
+    centralDifference.setMass( solver );
+
+    // write a vtk file
+    writeVTKFile( baseName, 0, mesh, displacement );
+
+    // point to check
+    typedef Mesh::Node::VecDim VecDim;
+    VecDim x;
+    for ( unsigned d = 0; d < dim; d++ ) x[d] = 0.5;
+
+    // find point in mesh
+    std::pair<std::size_t,VecDim> probe;
+    const bool found = base::post::findLocationInMesh( mesh, x, coordTol, 10, probe );
+    VERIFY_MSG( found, "Could not find the point in the mesh" );
+
+    // prepare a monitor
+    base::post::Monitor<Mesh::Element,Field::Element>
+        monitorD( mesh.elementPtr(         probe.first ),
+                  displacement.elementPtr( probe.first ),
+                  probe.second );
+
+    //--------------------------------------------------------------------------
+    // Loop over output steps
+    //--------------------------------------------------------------------------
+    for ( unsigned step = 0; step < numSteps; step++ ) {
+
+        for ( unsigned s = 0; s < subSteps; s++ ) {
+
+            // applied traction
+            const double tracValue = tractionValue( centralDifference.getTime() );
+
+            // total force, no solve
+            solver.clearRHS();
+
+            base::asmb::neumannForceComputation<SFTB>( surfaceQuadrature, solver,
+                                                       surfaceFieldBinder,
+                                                       boost::bind( &neumannBC<dim>,
+                                                                    _1, _2, tracValue ) );
+
+            base::time::computeExplicitForces<FTB>( quadrature, solver,
+                                                    fieldBinder, hyperElastic );
+
+            // update and pass to the field
+            centralDifference.advance( solver );
+            centralDifference.distribute( displacement );
+        }
+
+        // tell user something
+        std::cout << centralDifference.getTime() << "  "
+                  << tractionValue( centralDifference.getTime() ) << "  ";
+        monitorD.solution( std::cout );
+        std::cout << std::endl;
+
+        // write a vtk file
+        writeVTKFile( baseName, step+1, mesh, displacement );
+    }
+    // Finished load steps
+    //--------------------------------------------------------------------------
+
+    return 0;
+}
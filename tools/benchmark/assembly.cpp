@@ -0,0 +1,424 @@
+//------------------------------------------------------------------------------
+// <preamble>
+// </preamble>
+//------------------------------------------------------------------------------
+
+//! @file   assembly.cpp
+//! @author agent
+//! @date   2026
+
+// std includes
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <limits>
+#include <algorithm>
+// boost includes
+#include <boost/lexical_cast.hpp>
+#include <boost/bind.hpp>
+// mesh generation
+#include <tools/meshGeneration/unitCube/unitCube.hpp>
+// mesh related
+#include <base/shape.hpp>
+#include <base/Unstructured.hpp>
+#include <base/mesh/MeshBoundary.hpp>
+#include <base/io/smf/Reader.hpp>
+// quadrature and FE basis
+#include <base/Quadrature.hpp>
+#include <base/fe/Basis.hpp>
+// Field and degrees of freedom
+#include <base/Field.hpp>
+#include <base/dof/numbering.hpp>
+#include <base/dof/generate.hpp>
+#include <base/dof/constrainBoundary.hpp>
+// assembly
+#include <base/asmb/FieldBinder.hpp>
+#include <base/asmb/StiffnessMatrix.hpp>
+#include <base/asmb/BodyForce.hpp>
+// solver
+#include <base/solver/Eigen3.hpp>
+// timing
+#include <base/auxi/Timer.hpp>
+// kernels
+#include <heat/Laplace.hpp>
+#include <fluid/Stokes.hpp>
+#include <fluid/GalerkinLeastSquares.hpp>
+#include <mat/hypel/NeoHookeanCompressible.hpp>
+#include <mat/Lame.hpp>
+#include <solid/HyperElastic.hpp>
+
+//------------------------------------------------------------------------------
+namespace benchmark{
+
+    //--------------------------------------------------------------------------
+    /** One line of the report per measurement.
+     *  The columns are: name of the measurement, element shape, number of
+     *  elements, number of unknowns, number of matrix entries, the minimal
+     *  time over the repetitions and the resulting throughputs. Entries
+     *  which do not apply are written as 0.
+     */
+    class Report
+    {
+    public:
+        Report( std::ostream& out ) : out_( out ) { }
+
+        void header( const unsigned numRepetitions )
+        {
+            out_ << "# inSilico assembly benchmark, " << NTHREADS
+                 << " thread(s), minimum of " << numRepetitions
+                 << " repetition(s)\n"
+                 << "# name shape elements dofs nnz seconds elements/s nnz/s\n";
+        }
+
+        void operator()( const std::string& name, const std::string& shape,
+                         const std::size_t numElements,
+                         const std::size_t numDoFs,
+                         const std::size_t numNonZeros,
+                         const double      seconds )
+        {
+            const double t = std::max( seconds, 1.e-9 );
+            out_ << name << " " << shape << " " << numElements << " "
+                 << numDoFs << " " << numNonZeros << " " << seconds << " "
+                 << static_cast<double>( numElements ) / t << " "
+                 << static_cast<double>( numNonZeros ) / t << std::endl;
+        }
+
+    private:
+        std::ostream& out_;
+    };
+
+    //--------------------------------------------------------------------------
+    //! Fix all components of a boundary DoF to zero
+    template<unsigned DIM, typename DOF>
+    void fixBoundary( const typename base::Vector<DIM>::Type& x, DOF* doFPtr )
+    {
+        for ( unsigned d = 0; d < DOF::size; d++ )
+            if ( doFPtr -> isActive( d ) ) doFPtr -> constrainValue( d, 0. );
+    }
+
+    //! Unit body force
+    template<unsigned DIM, unsigned SIZE>
+    typename base::Vector<SIZE>::Type unitForce(
+        const typename base::Vector<DIM>::Type& x )
+    {
+        return base::constantVector<SIZE>( 1. );
+    }
+
+    //! Update the minimum of measured times
+    inline void keepMinimum( double& minTime, const base::auxi::Timer& timer )
+    {
+        minTime = std::min( minTime, timer.seconds() );
+    }
+
+    //--------------------------------------------------------------------------
+    /** Benchmark of all phases for a given element shape.
+     *  Hexahedra give a structured mesh, tetrahedra the unstructured one
+     *  obtained by decomposition of every hexahedron.
+     */
+    template<base::Shape SHAPE>
+    class Suite
+    {
+    public:
+        static const unsigned dim = base::ShapeDim<SHAPE>::value;
+        static const bool simplex = ( SHAPE == base::SimplexShape<dim>::value );
+
+        typedef base::Unstructured<SHAPE,1>           Mesh;
+        typedef base::Quadrature<3,SHAPE>             Quadrature;
+        typedef base::fe::Basis<SHAPE,1>              FEBasis;
+
+        Suite( const unsigned numPerDir, const unsigned numRepetitions,
+               Report& report )
+            : numRep_( numRepetitions ), report_( report ),
+              shape_( base::ShapeName<SHAPE>::apply() )
+        {
+            // generate the unit cube in SMF format and read it
+            std::stringstream smf;
+            tools::meshGeneration::unitCube::SMF<dim,simplex,1>::apply(
+                numPerDir, numPerDir, numPerDir, smf );
+            base::io::smf::readMesh( smf, mesh_ );
+
+            numElements_ = std::distance( mesh_.elementsBegin(),
+                                          mesh_.elementsEnd() );
+            meshBoundary_.create( mesh_.elementsBegin(), mesh_.elementsEnd() );
+        }
+
+        //----------------------------------------------------------------------
+        /** Scalar Laplace problem.
+         *  Timings of DoF generation, pattern registration, assembly,
+         *  finishAssembly and of all solver backends.
+         */
+        void laplace()
+        {
+            typedef base::Field<FEBasis,1>                     Field;
+            typedef base::asmb::FieldBinder<Mesh,Field>        FieldBinder;
+            typedef typename FieldBinder::template TupleBinder<1,1>::Type FTB;
+            typedef heat::Laplace<typename FTB::Tuple>         Laplace;
+
+            // DoF generation, constraints and numbering
+            Field field;
+            std::size_t numDoFs = 0;
+            double tDoFs = std::numeric_limits<double>::max();
+            for ( unsigned r = 0; r < numRep_; r++ ) {
+                Field tmp;
+                base::auxi::Timer timer;
+                base::dof::generate<FEBasis>( mesh_, tmp );
+                base::dof::constrainBoundary<FEBasis>(
+                    meshBoundary_.begin(), meshBoundary_.end(), mesh_, tmp,
+                    boost::bind( &fixBoundary<dim,typename Field::DegreeOfFreedom>,
+                                 _1, _2 ) );
+                numDoFs = base::dof::numberDoFsConsecutively( tmp.doFsBegin(),
+                                                              tmp.doFsEnd() );
+                keepMinimum( tDoFs, timer );
+            }
+            base::dof::generate<FEBasis>( mesh_, field );
+            base::dof::constrainBoundary<FEBasis>(
+                meshBoundary_.begin(), meshBoundary_.end(), mesh_, field,
+                boost::bind( &fixBoundary<dim,typename Field::DegreeOfFreedom>,
+                             _1, _2 ) );
+            base::dof::numberDoFsConsecutively( field.doFsBegin(), field.doFsEnd() );
+
+            FieldBinder fieldBinder( mesh_, field );
+            Quadrature quadrature;
+            Laplace kernel( 1. );
+
+            // pattern, assembly and conversion
+            base::solver::Eigen3 solver( numDoFs );
+            const double tRegister = this -> registerFields_<FTB>( solver, fieldBinder );
+
+            double tAssembly = std::numeric_limits<double>::max();
+            double tFinish   = std::numeric_limits<double>::max();
+            for ( unsigned r = 0; r < numRep_; r++ ) {
+                solver.clearLHS();
+                base::auxi::Timer timer;
+                base::asmb::stiffnessMatrixComputation<FTB>( quadrature, solver,
+                                                             fieldBinder, kernel );
+                keepMinimum( tAssembly, timer );
+                timer.reset();
+                solver.finishAssembly( false );
+                keepMinimum( tFinish, timer );
+            }
+            const std::size_t nnz = solver.numNonZeros();
+
+            report_( "dofs:laplace",     shape_, numElements_, numDoFs, 0,   tDoFs     );
+            report_( "register:laplace", shape_, numElements_, numDoFs, nnz, tRegister );
+            report_( "assembly:laplace", shape_, numElements_, numDoFs, nnz, tAssembly );
+            report_( "finish:laplace",   shape_, numElements_, numDoFs, nnz, tFinish   );
+
+            // solver backends, every run with a fresh right hand side
+            const char* names[] = { "solve:cg", "solve:biCGStab", "solve:cholesky",
+                                    "solve:lu", "solve:mixedPrecision" };
+            for ( unsigned s = 0; s < 5; s++ ) {
+                double tSolve = std::numeric_limits<double>::max();
+                for ( unsigned r = 0; r < numRep_; r++ ) {
+                    solver.clearRHS();
+                    base::asmb::bodyForceComputation<FTB>(
+                        quadrature, solver, fieldBinder,
+                        boost::bind( &unitForce<dim,1>, _1 ) );
+
+                    base::auxi::Timer timer;
+                    switch ( s ) {
+                    case 0: solver.cgSolve( 1.e-10 );          break;
+                    case 1: solver.biCGStabSolve( 1.e-10 );    break;
+                    case 2: solver.choleskySolve();            break;
+                    case 3: solver.luSolve();                  break;
+                    case 4: solver.mixedPrecisionSolve( true ); break;
+                    }
+                    keepMinimum( tSolve, timer );
+                }
+                report_( names[s], shape_, numElements_, numDoFs, nnz, tSolve );
+            }
+        }
+
+        //----------------------------------------------------------------------
+        //! Equal-order Stokes problem with GLS stabilisation
+        void stokesGLS()
+        {
+            typedef base::Field<FEBasis,dim>                   Velocity;
+            typedef base::Field<FEBasis,1>                     Pressure;
+            typedef base::asmb::FieldBinder<Mesh,Velocity,Pressure> FieldBinder;
+            typedef typename FieldBinder::template TupleBinder<1,1>::Type TopLeft;
+            typedef typename FieldBinder::template TupleBinder<1,2>::Type TopRight;
+            typedef typename FieldBinder::template TupleBinder<2,1>::Type BotLeft;
+            typedef typename FieldBinder::template TupleBinder<2,2>::Type BotRight;
+
+            Velocity velocity;
+            Pressure pressure;
+            base::dof::generate<FEBasis>( mesh_, velocity );
+            base::dof::generate<FEBasis>( mesh_, pressure );
+            base::dof::constrainBoundary<FEBasis>(
+                meshBoundary_.begin(), meshBoundary_.end(), mesh_, velocity,
+                boost::bind( &fixBoundary<dim,typename Velocity::DegreeOfFreedom>,
+                             _1, _2 ) );
+            const std::size_t numDoFsU =
+                base::dof::numberDoFsConsecutively( velocity.doFsBegin(),
+                                                    velocity.doFsEnd() );
+            const std::size_t numDoFsP =
+                base::dof::numberDoFsConsecutively( pressure.doFsBegin(),
+                                                    pressure.doFsEnd(), numDoFsU );
+            const std::size_t numDoFs = numDoFsU + numDoFsP;
+
+            FieldBinder fieldBinder( mesh_, velocity, pressure );
+            Quadrature quadrature;
+
+            const double viscosity = 1.;
+            const double alpha     = 1. / 12.;
+            fluid::VectorLaplace<     typename TopLeft::Tuple>  vecLaplace( viscosity );
+            fluid::PressureGradient< typename TopRight::Tuple>  gradP;
+            fluid::VelocityDivergence<typename BotLeft::Tuple>  divU;
+            fluid::gls::VectorLaplace<      typename TopLeft::Tuple>
+                vecLaplaceStabil( alpha, viscosity, false );
+            fluid::gls::PressureGradient<   typename TopRight::Tuple>
+                gradPStabil(      alpha, viscosity, false );
+            fluid::gls::VelocityDivergence< typename BotLeft::Tuple>
+                divUStabil(       alpha, viscosity );
+            fluid::gls::PressureLaplace<    typename BotRight::Tuple>
+                pressureLaplace(  alpha );
+
+            base::solver::Eigen3 solver( numDoFs );
+            double tRegister = this -> registerFields_<TopLeft>(  solver, fieldBinder );
+            tRegister       += this -> registerFields_<TopRight>( solver, fieldBinder );
+            tRegister       += this -> registerFields_<BotLeft>(  solver, fieldBinder );
+            tRegister       += this -> registerFields_<BotRight>( solver, fieldBinder );
+
+            double tAssembly = std::numeric_limits<double>::max();
+            double tFinish   = std::numeric_limits<double>::max();
+            for ( unsigned r = 0; r < numRep_; r++ ) {
+                solver.clearLHS();
+                base::auxi::Timer timer;
+                base::asmb::stiffnessMatrixComputation<TopLeft>(
+                    quadrature, solver, fieldBinder, vecLaplace );
+                base::asmb::stiffnessMatrixComputation<TopRight>(
+                    quadrature, solver, fieldBinder, gradP );
+                base::asmb::stiffnessMatrixComputation<BotLeft>(
+                    quadrature, solver, fieldBinder, divU );
+                base::asmb::stiffnessMatrixComputation<TopLeft>(
+                    quadrature, solver, fieldBinder, vecLaplaceStabil );
+                base::asmb::stiffnessMatrixComputation<TopRight>(
+                    quadrature, solver, fieldBinder, gradPStabil );
+                base::asmb::stiffnessMatrixComputation<BotLeft>(
+                    quadrature, solver, fieldBinder, divUStabil );
+                base::asmb::stiffnessMatrixComputation<BotRight>(
+                    quadrature, solver, fieldBinder, pressureLaplace );
+                keepMinimum( tAssembly, timer );
+                timer.reset();
+                solver.finishAssembly( false );
+                keepMinimum( tFinish, timer );
+            }
+            const std::size_t nnz = solver.numNonZeros();
+
+            report_( "register:stokesGLS", shape_, numElements_, numDoFs, nnz, tRegister );
+            report_( "assembly:stokesGLS", shape_, numElements_, numDoFs, nnz, tAssembly );
+            report_( "finish:stokesGLS",   shape_, numElements_, numDoFs, nnz, tFinish   );
+        }
+
+        //----------------------------------------------------------------------
+        //! Compressible Neo-Hookean material, tangent in the reference state
+        void hyperElastic()
+        {
+            typedef base::Field<FEBasis,dim>                   Field;
+            typedef base::asmb::FieldBinder<Mesh,Field>        FieldBinder;
+            typedef typename FieldBinder::template TupleBinder<1,1>::Type FTB;
+            typedef mat::hypel::NeoHookeanCompressible         Material;
+            typedef solid::HyperElastic<Material,typename FTB::Tuple> HyperElastic;
+
+            Field displacement;
+            base::dof::generate<FEBasis>( mesh_, displacement );
+            base::dof::constrainBoundary<FEBasis>(
+                meshBoundary_.begin(), meshBoundary_.end(), mesh_, displacement,
+                boost::bind( &fixBoundary<dim,typename Field::DegreeOfFreedom>,
+                             _1, _2 ) );
+            const std::size_t numDoFs =
+                base::dof::numberDoFsConsecutively( displacement.doFsBegin(),
+                                                    displacement.doFsEnd() );
+
+            FieldBinder fieldBinder( mesh_, displacement );
+            Quadrature quadrature;
+
+            Material material( mat::Lame::lambda( 1., 0.3 ), mat::Lame::mu( 1., 0.3 ) );
+            HyperElastic kernel( material );
+
+            base::solver::Eigen3 solver( numDoFs );
+            const double tRegister = this -> registerFields_<FTB>( solver, fieldBinder );
+
+            double tAssembly = std::numeric_limits<double>::max();
+            double tFinish   = std::numeric_limits<double>::max();
+            for ( unsigned r = 0; r < numRep_; r++ ) {
+                solver.clearLHS();
+                base::auxi::Timer timer;
+                base::asmb::stiffnessMatrixComputation<FTB>( quadrature, solver,
+                                                             fieldBinder, kernel );
+                keepMinimum( tAssembly, timer );
+                timer.reset();
+                solver.finishAssembly( false );
+                keepMinimum( tFinish, timer );
+            }
+            const std::size_t nnz = solver.numNonZeros();
+
+            report_( "register:hyperElastic", shape_, numElements_, numDoFs, nnz, tRegister );
+            report_( "assembly:hyperElastic", shape_, numElements_, numDoFs, nnz, tAssembly );
+            report_( "finish:hyperElastic",   shape_, numElements_, numDoFs, nnz, tFinish   );
+        }
+
+    private:
+        //! Time the registration of a block's pattern
+        template<typename FTB, typename FIELDBINDER>
+        static double registerFields_( base::solver::Eigen3& solver,
+                                       const FIELDBINDER& fieldBinder )
+        {
+            base::auxi::Timer timer;
+            solver.registerFields<FTB>( fieldBinder );
+            return timer.seconds();
+        }
+
+        const unsigned           numRep_;
+        Report&                  report_;
+        const std::string        shape_;
+        Mesh                     mesh_;
+        std::size_t              numElements_;
+        base::mesh::MeshBoundary meshBoundary_;
+    };
+
+    //--------------------------------------------------------------------------
+    //! Run the complete suite for one shape
+    template<base::Shape SHAPE>
+    void runSuite( const unsigned numPerDir, const unsigned numRepetitions,
+                   Report& report )
+    {
+        Suite<SHAPE> suite( numPerDir, numRepetitions, report );
+        suite.laplace();
+        suite.stokesGLS();
+        suite.hyperElastic();
+    }
+}
+
+//------------------------------------------------------------------------------
+/** Micro-benchmarks of the assembly and solution phases.
+ *  On a unit cube with N elements per direction, a structured mesh of
+ *  hexahedra and an unstructured mesh of tetrahedra are generated. For each
+ *  mesh the DoF generation, the pattern registration, the assembly of the
+ *  Laplace, GLS-stabilised Stokes and hyperelastic kernels, the conversion
+ *  by finishAssembly and the solver backends (Laplace system only) are
+ *  timed. Every measurement is repeated and the minimal time is written
+ *  to stdout, one line per measurement with whitespace separated columns,
+ *  such that the results of different commits can be compared directly.
+ */
+int main( int argc, char* argv[] )
+{
+    // usage message
+    if ( ( argc < 2 ) or ( argc > 3 ) ) {
+        std::cout << "Usage:  " << argv[0] << " N  [numRepetitions] \n";
+        return 0;
+    }
+
+    const unsigned numPerDir      = boost::lexical_cast<unsigned>( argv[1] );
+    const unsigned numRepetitions =
+        ( argc > 2 ? boost::lexical_cast<unsigned>( argv[2] ) : 3 );
+
+    benchmark::Report report( std::cout );
+    report.header( numRepetitions );
+
+    benchmark::runSuite<base::HEX>( numPerDir, numRepetitions, report );
+    benchmark::runSuite<base::TET>( numPerDir, numRepetitions, report );
+
+    return 0;
+}